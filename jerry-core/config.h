@@ -34,14 +34,35 @@
  */
 #define CONFIG_MEM_POOL_CHUNK_SIZE (8)
 
+/**
+ * Number of pool chunk size classes
+ *
+ * The i-th class serves chunks of (CONFIG_MEM_POOL_CHUNK_SIZE << i) bytes,
+ * i.e. 8, 16, 32 and 64 byte chunks by default.
+ */
+#ifndef CONFIG_MEM_POOLS_CLASS_COUNT
+# define CONFIG_MEM_POOLS_CLASS_COUNT (4)
+#endif /* !CONFIG_MEM_POOLS_CLASS_COUNT */
+
 /**
  * Size of heap
+ *
+ * In the large heap profile (CONFIG_MEM_LARGE_HEAP) compressed pointers are 32-bit wide,
+ * so the heap can be up to 2 gigabytes.
  */
-#ifndef CONFIG_MEM_HEAP_AREA_SIZE
-# define CONFIG_MEM_HEAP_AREA_SIZE (512 * 1024)
-#elif CONFIG_MEM_HEAP_AREA_SIZE > (512 * 1024)
-# error "Currently, maximum 512 kilobytes heap size is supported"
-#endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#ifdef CONFIG_MEM_LARGE_HEAP
+# ifndef CONFIG_MEM_HEAP_AREA_SIZE
+#  define CONFIG_MEM_HEAP_AREA_SIZE (256 * 1024 * 1024)
+# elif CONFIG_MEM_HEAP_AREA_SIZE > (2047 * 1024 * 1024)
+#  error "Currently, maximum 2 gigabytes heap size is supported in the large heap profile"
+# endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#else /* !CONFIG_MEM_LARGE_HEAP */
+# ifndef CONFIG_MEM_HEAP_AREA_SIZE
+#  define CONFIG_MEM_HEAP_AREA_SIZE (512 * 1024)
+# elif CONFIG_MEM_HEAP_AREA_SIZE > (512 * 1024)
+#  error "Currently, maximum 512 kilobytes heap size is supported"
+# endif /* !CONFIG_MEM_HEAP_AREA_SIZE */
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Max heap usage limit
@@ -53,6 +74,35 @@
  */
 #define CONFIG_MEM_HEAP_DESIRED_LIMIT (JERRY_MIN (CONFIG_MEM_HEAP_AREA_SIZE / 32, CONFIG_MEM_HEAP_MAX_LIMIT))
 
+/**
+ * Number of segregated free lists (quick lists) of the heap
+ *
+ * Freed blocks, which are not larger than (CONFIG_MEM_HEAP_QUICK_LIST_COUNT * 8) bytes, are kept in
+ * per-size lists, so that blocks of these sizes are allocated and freed without walking the free region list.
+ */
+#ifndef CONFIG_MEM_HEAP_QUICK_LIST_COUNT
+# define CONFIG_MEM_HEAP_QUICK_LIST_COUNT (8)
+#endif /* !CONFIG_MEM_HEAP_QUICK_LIST_COUNT */
+
+/**
+ * Minimum size of heap blocks, that are considered large
+ *
+ * Large blocks are allocated from the top of the heap, and the rest of the blocks - from the bottom,
+ * so that freeing the large blocks leaves contiguous free space instead of fragmenting the heap.
+ */
+#ifndef CONFIG_MEM_HEAP_LARGE_BLOCK_SIZE
+# define CONFIG_MEM_HEAP_LARGE_BLOCK_SIZE (256)
+#endif /* !CONFIG_MEM_HEAP_LARGE_BLOCK_SIZE */
+
+/**
+ * Size of chunks of the heap, that are returned to the OS, if they are entirely free after garbage collection
+ *
+ * Used only if JERRY_ENABLE_HEAP_RELEASE is defined. The value should be a multiple of the OS page size.
+ */
+#ifndef CONFIG_MEM_HEAP_RELEASE_CHUNK_SIZE
+# define CONFIG_MEM_HEAP_RELEASE_CHUNK_SIZE (16 * 1024)
+#endif /* !CONFIG_MEM_HEAP_RELEASE_CHUNK_SIZE */
+
 /**
  * Log2 of maximum possible offset in the heap
  *
@@ -63,7 +113,11 @@
  *
  * On the other hand, value 2 ^ CONFIG_MEM_HEAP_OFFSET_LOG should not be less than CONFIG_MEM_HEAP_AREA_SIZE.
  */
-#define CONFIG_MEM_HEAP_OFFSET_LOG (19)
+#ifdef CONFIG_MEM_LARGE_HEAP
+# define CONFIG_MEM_HEAP_OFFSET_LOG (31)
+#else /* !CONFIG_MEM_LARGE_HEAP */
+# define CONFIG_MEM_HEAP_OFFSET_LOG (19)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Number of lower bits in key of literal hash table.
@@ -128,13 +182,143 @@
 // #define CONFIG_ECMA_LCACHE_DISABLE
 
 /**
- * Share of newly allocated since last GC objects among all currently allocated objects,
+ * Number of rows in the ECMA lookup cache, as a power of two
+ *
+ * The row of an (object, property name) pair is selected by the low bits of the name's hash,
+ * combined with the object's compressed pointer, so the value should not be greater than
+ * the number of bits in the hash of a string.
+ */
+#ifndef CONFIG_ECMA_LCACHE_HASH_BITS
+# define CONFIG_ECMA_LCACHE_HASH_BITS (9)
+#endif /* !CONFIG_ECMA_LCACHE_HASH_BITS */
+
+/**
+ * Number of entries in a row of the ECMA lookup cache (associativity of the cache)
+ *
+ * Each lookup scans the entries of a row, so long rows slow down the hits.
+ */
+#ifndef CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH
+# define CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH (2)
+#endif /* !CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH */
+
+/**
+ * Number of entries in the prototype chain cache of the ECMA lookup cache, as a power of two
+ *
+ * The prototype chain cache stores the result of looking up a property name
+ * along the prototype chain of an object (including the absence of the property).
+ */
+#ifndef CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS
+# define CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS (7)
+#endif /* !CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS */
+
+/**
+ * Disable inline caches of property access instructions
+ */
+// #define CONFIG_ECMA_INLINE_CACHE_DISABLE
+
+/**
+ * Disable dispatching of byte code instructions with computed goto
+ *
+ * Computed goto (the labels as values extension of GCC) is only used with compilers supporting it,
+ * otherwise the instructions are dispatched by a switch statement.
+ */
+// #define CONFIG_VM_COMPUTED_GOTO_DISABLE
+
+/**
+ * Growth of the heap since last GC (in percents of the heap usage after the GC),
  * after achieving which, GC is started upon low severity try-give-memory-back requests.
  *
- * Share is calculated as the following:
- *                1.0 / CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC
+ * The value can be changed at runtime (see also: jerry_api_set_gc_policy).
+ */
+#ifndef CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT
+# define CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT (25)
+#endif /* !CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT */
+
+/**
+ * Minimum growth of the heap since last GC (in bytes), which is required to start GC
+ * upon low severity try-give-memory-back requests.
+ *
+ * The value can be changed at runtime (see also: jerry_api_set_gc_policy).
+ */
+#ifndef CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES
+# define CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES (CONFIG_MEM_HEAP_DESIRED_LIMIT)
+#endif /* !CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES */
+
+/**
+ * Number of entries of the GC mark stack
+ *
+ * Objects, which are found to be reachable, are pushed onto the stack until their references are traversed.
+ * If the stack overflows, the reachable objects are rescanned after the stack is emptied.
+ */
+#ifndef CONFIG_ECMA_GC_MARK_STACK_SIZE
+# define CONFIG_ECMA_GC_MARK_STACK_SIZE (128)
+#endif /* !CONFIG_ECMA_GC_MARK_STACK_SIZE */
+
+/**
+ * Maximum number of objects processed by a step of the incremental garbage collector,
+ * which is performed upon low severity try-give-memory-back requests, if JERRY_ENABLE_INCREMENTAL_GC is defined
+ */
+#ifndef CONFIG_ECMA_GC_STEP_BUDGET
+# define CONFIG_ECMA_GC_STEP_BUDGET (2048)
+#endif /* !CONFIG_ECMA_GC_STEP_BUDGET */
+
+/**
+ * Number of young objects (allocated since the last garbage collection), which triggers a minor garbage collection
+ *
+ * Minor garbage collection frees unreachable young objects, and promotes the surviving ones to old objects.
+ */
+#ifndef CONFIG_ECMA_GC_NURSERY_SIZE
+# define CONFIG_ECMA_GC_NURSERY_SIZE (1024)
+#endif /* !CONFIG_ECMA_GC_NURSERY_SIZE */
+
+/**
+ * Maximum number of old objects, which can reference young objects (remembered set)
+ *
+ * If the remembered set overflows, all young objects are promoted without garbage collection.
+ */
+#ifndef CONFIG_ECMA_GC_REMEMBERED_SET_SIZE
+# define CONFIG_ECMA_GC_REMEMBERED_SET_SIZE (64)
+#endif /* !CONFIG_ECMA_GC_REMEMBERED_SET_SIZE */
+
+/**
+ * Maximum number of properties of an object, which are laid out according to a shape (hidden class)
+ *
+ * Objects with more properties (e.g. objects, which are used as dictionaries) store their properties
+ * in the property pairs list.
+ */
+#ifndef CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT
+# define CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT (32)
+#endif /* !CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT */
+
+/**
+ * Maximum number of shapes, which are transitioned from a shape by adding different properties
+ *
+ * Objects, which would need a new transition from a shape with the maximum number of transitions,
+ * store their properties in the property pairs list.
+ */
+#ifndef CONFIG_ECMA_SHAPE_MAX_TRANSITION_COUNT
+# define CONFIG_ECMA_SHAPE_MAX_TRANSITION_COUNT (64)
+#endif /* !CONFIG_ECMA_SHAPE_MAX_TRANSITION_COUNT */
+
+/**
+ * Minimum number of properties in a property pair list, for which a property name hash map is created
+ *
+ * The hash map is created when a property lookup walks through at least this many properties,
+ * so the properties of objects, which are used as dictionaries, are found in constant time.
+ */
+#ifndef CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT
+# define CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT (32)
+#endif /* !CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT */
+
+/**
+ * Maximum number of elements in the fast (contiguous) element storage of an array
+ *
+ * The element storage is a single heap block, so arrays, which would need a larger storage,
+ * store their elements as named properties.
  */
-#define CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC (16)
+#ifndef CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY
+# define CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY (CONFIG_MEM_HEAP_AREA_SIZE / 64)
+#endif /* !CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY */
 
 /**
  * Link Global Environment to an empty declarative lexical environment
@@ -158,6 +342,7 @@
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_DATE_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
 #define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_ANNEXB_BUILTIN
+#define CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
 #endif /* CONFIG_ECMA_COMPACT_PROFILE */
 
 /**
@@ -25,6 +25,19 @@ JERRY_STATIC_ASSERT (sizeof (ecma_property_value_t) == sizeof (ecma_value_t),
                      size_of_ecma_property_value_t_must_be_equal_to_size_of_ecma_value_t);
 JERRY_STATIC_ASSERT (((sizeof (ecma_property_value_t) - 1) & sizeof (ecma_property_value_t)) == 0,
                      size_of_ecma_property_value_t_must_be_power_of_2);
+#ifdef CONFIG_MEM_LARGE_HEAP
+
+JERRY_STATIC_ASSERT (sizeof (ecma_property_pair_t) == sizeof (uint64_t) * 3,
+                     size_of_ecma_property_pair_t_must_be_equal_to_24_bytes);
+
+JERRY_STATIC_ASSERT (sizeof (ecma_object_t) == sizeof (uint64_t) * 2,
+                     size_of_ecma_object_t_must_be_equal_to_16_bytes);
+
+JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint32_t) * 3,
+                     size_of_ecma_collection_header_t_must_be_equal_to_12_bytes);
+
+#else /* !CONFIG_MEM_LARGE_HEAP */
+
 JERRY_STATIC_ASSERT (sizeof (ecma_property_pair_t) == sizeof (uint64_t) * 2,
                      size_of_ecma_property_pair_t_must_be_equal_to_16_bytes);
 
@@ -33,6 +46,16 @@ JERRY_STATIC_ASSERT (sizeof (ecma_object_t) <= sizeof (uint64_t),
 
 JERRY_STATIC_ASSERT (sizeof (ecma_collection_header_t) == sizeof (uint64_t),
                      size_of_ecma_collection_header_t_must_be_less_than_or_equal_to_8_bytes);
+
+#endif /* CONFIG_MEM_LARGE_HEAP */
+
+JERRY_STATIC_ASSERT (sizeof (ecma_property_slots_t) == sizeof (ecma_property_header_t),
+                     size_of_ecma_property_slots_t_must_be_equal_to_size_of_ecma_property_header_t);
+JERRY_STATIC_ASSERT (offsetof (ecma_property_group_t, values) == sizeof (ecma_property_header_t),
+                     values_of_ecma_property_group_t_must_follow_the_space_of_ecma_property_header_t);
+JERRY_STATIC_ASSERT (sizeof (ecma_array_elements_t) % sizeof (ecma_property_value_t) == 0,
+                     size_of_ecma_array_elements_t_must_be_a_multiple_of_size_of_ecma_property_value_t);
+
 JERRY_STATIC_ASSERT (sizeof (ecma_collection_chunk_t) == sizeof (uint64_t),
                      size_of_ecma_collection_chunk_t_must_be_less_than_or_equal_to_8_bytes);
 JERRY_STATIC_ASSERT (sizeof (ecma_string_t) == sizeof (uint64_t),
@@ -59,13 +82,37 @@ JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t)
  *     else - shutdown engine.
  */
 
+/**
+ * Allocate a block for the specified ecma-type.
+ *
+ * Types, whose size doesn't match a pool chunk size (e.g. property pairs in the large heap profile),
+ * are allocated on the heap.
+ */
+#define ECMA_ALLOC_BLOCK(ecma_type) \
+  (MEM_POOLS_IS_CHUNK_SIZE (sizeof (ecma_ ## ecma_type ## _t)) \
+   ? mem_pools_alloc (sizeof (ecma_ ## ecma_type ## _t)) \
+   : mem_heap_alloc_block (sizeof (ecma_ ## ecma_type ## _t)))
+
+/**
+ * Free a block of the specified ecma-type.
+ */
+#define ECMA_FREE_BLOCK(ecma_type, block_p) \
+  if (MEM_POOLS_IS_CHUNK_SIZE (sizeof (ecma_ ## ecma_type ## _t))) \
+  { \
+    mem_pools_free ((uint8_t *) (block_p), sizeof (ecma_ ## ecma_type ## _t)); \
+  } \
+  else \
+  { \
+    mem_heap_free_block ((block_p), sizeof (ecma_ ## ecma_type ## _t)); \
+  }
+
 /**
  * Template of an allocation routine.
  */
 #define ALLOC(ecma_type) ecma_ ## ecma_type ## _t * \
   ecma_alloc_ ## ecma_type (void) \
 { \
-  ecma_ ## ecma_type ## _t *p ## ecma_type = (ecma_ ## ecma_type ## _t *) mem_pools_alloc (); \
+  ecma_ ## ecma_type ## _t *p ## ecma_type = (ecma_ ## ecma_type ## _t *) ECMA_ALLOC_BLOCK (ecma_type); \
   \
   JERRY_ASSERT (p ## ecma_type != NULL); \
   \
@@ -78,7 +125,7 @@ JERRY_STATIC_ASSERT (sizeof (ecma_getter_setter_pointers_t) <= sizeof (uint64_t)
 #define DEALLOC(ecma_type) void \
   ecma_dealloc_ ## ecma_type (ecma_ ## ecma_type ## _t *p ## ecma_type) \
 { \
-  mem_pools_free ((uint8_t *) p ## ecma_type); \
+  ECMA_FREE_BLOCK (ecma_type, p ## ecma_type); \
 }
 
 /**
@@ -96,25 +143,239 @@ DECLARE_ROUTINES_FOR (string)
 DECLARE_ROUTINES_FOR (getter_setter_pointers)
 DECLARE_ROUTINES_FOR (external_pointer)
 
+DECLARE_ROUTINES_FOR (property_pair)
+
+/**
+ * Allocate memory for slot array of an object with shape
+ *
+ * @return pointer to allocated memory
+ */
+ecma_property_slots_t *
+ecma_alloc_property_slots (size_t size) /**< size of the slot array */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return (ecma_property_slots_t *) mem_pools_alloc (size);
+  }
+
+  return (ecma_property_slots_t *) mem_heap_alloc_block (size);
+} /* ecma_alloc_property_slots */
+
+/**
+ * Dealloc memory from slot array of an object with shape
+ */
+void
+ecma_dealloc_property_slots (ecma_property_slots_t *slots_p, /**< slot array */
+                             size_t size) /**< size of the slot array */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free ((uint8_t *) slots_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (slots_p, size);
+  }
+} /* ecma_dealloc_property_slots */
+
+/**
+ * Allocate memory for shape
+ *
+ * @return pointer to allocated memory
+ */
+ecma_shape_t *
+ecma_alloc_shape (size_t size) /**< size of the shape */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return (ecma_shape_t *) mem_pools_alloc (size);
+  }
+
+  return (ecma_shape_t *) mem_heap_alloc_block (size);
+} /* ecma_alloc_shape */
+
+/**
+ * Dealloc memory from shape
+ */
+void
+ecma_dealloc_shape (ecma_shape_t *shape_p, /**< shape */
+                    size_t size) /**< size of the shape */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free ((uint8_t *) shape_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (shape_p, size);
+  }
+} /* ecma_dealloc_shape */
+
+/**
+ * Allocate memory for property name hash map
+ *
+ * @return pointer to allocated memory
+ */
+ecma_property_hashmap_t *
+ecma_alloc_property_hashmap (size_t size) /**< size of the hash map */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return (ecma_property_hashmap_t *) mem_pools_alloc (size);
+  }
+
+  return (ecma_property_hashmap_t *) mem_heap_alloc_block (size);
+} /* ecma_alloc_property_hashmap */
+
+/**
+ * Dealloc memory from property name hash map
+ */
+void
+ecma_dealloc_property_hashmap (ecma_property_hashmap_t *hashmap_p, /**< hash map */
+                               size_t size) /**< size of the hash map */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free ((uint8_t *) hashmap_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (hashmap_p, size);
+  }
+} /* ecma_dealloc_property_hashmap */
+
+/**
+ * Allocate memory for element storage of an array
+ *
+ * @return pointer to allocated memory
+ */
+ecma_array_elements_t *
+ecma_alloc_array_elements (size_t size) /**< size of the element storage */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return (ecma_array_elements_t *) mem_pools_alloc (size);
+  }
+
+  return (ecma_array_elements_t *) mem_heap_alloc_block (size);
+} /* ecma_alloc_array_elements */
+
+/**
+ * Dealloc memory from element storage of an array
+ */
+void
+ecma_dealloc_array_elements (ecma_array_elements_t *elements_p, /**< element storage */
+                             size_t size) /**< size of the element storage */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free ((uint8_t *) elements_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (elements_p, size);
+  }
+} /* ecma_dealloc_array_elements */
+
+/**
+ * Allocate memory for the data block of an ArrayBuffer
+ *
+ * @return pointer to allocated memory
+ */
+ecma_arraybuffer_t *
+ecma_alloc_arraybuffer (size_t size) /**< size of the header and the (inline) bytes */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return (ecma_arraybuffer_t *) mem_pools_alloc (size);
+  }
+
+  return (ecma_arraybuffer_t *) mem_heap_alloc_block (size);
+} /* ecma_alloc_arraybuffer */
+
 /**
- * Allocate memory for ecma-property pair
+ * Dealloc memory from the data block of an ArrayBuffer
+ */
+void
+ecma_dealloc_arraybuffer (ecma_arraybuffer_t *arraybuffer_p, /**< data block */
+                          size_t size) /**< size of the header and the (inline) bytes */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free ((uint8_t *) arraybuffer_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (arraybuffer_p, size);
+  }
+} /* ecma_dealloc_arraybuffer */
+
+/**
+ * Allocate memory for the view of a typed array or a DataView
  *
  * @return pointer to allocated memory
  */
-ecma_property_pair_t *
-ecma_alloc_property_pair (void)
+ecma_typedarray_t *
+ecma_alloc_typedarray (void)
 {
-  return mem_heap_alloc_block (sizeof (ecma_property_pair_t));
-} /* ecma_alloc_property_pair */
+  if (MEM_POOLS_IS_CHUNK_SIZE (sizeof (ecma_typedarray_t)))
+  {
+    return (ecma_typedarray_t *) mem_pools_alloc (sizeof (ecma_typedarray_t));
+  }
+
+  return (ecma_typedarray_t *) mem_heap_alloc_block (sizeof (ecma_typedarray_t));
+} /* ecma_alloc_typedarray */
+
+/**
+ * Dealloc memory from the view of a typed array or a DataView
+ */
+void
+ecma_dealloc_typedarray (ecma_typedarray_t *typedarray_p) /**< view */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (sizeof (ecma_typedarray_t)))
+  {
+    mem_pools_free ((uint8_t *) typedarray_p, sizeof (ecma_typedarray_t));
+  }
+  else
+  {
+    mem_heap_free_block (typedarray_p, sizeof (ecma_typedarray_t));
+  }
+} /* ecma_dealloc_typedarray */
+
+/**
+ * Allocate memory for the character data of an ecma-string
+ *
+ * Small buffers, whose size matches a pool chunk size, are allocated from the pools.
+ *
+ * @return pointer to allocated memory
+ */
+void *
+ecma_alloc_string_buffer (size_t size) /**< size of the buffer */
+{
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    return mem_pools_alloc (size);
+  }
+
+  return mem_heap_alloc_block (size);
+} /* ecma_alloc_string_buffer */
 
 /**
- * Dealloc memory from an ecma-property
+ * Dealloc memory of the character data of an ecma-string
  */
-extern void
-ecma_dealloc_property_pair (ecma_property_pair_t *property_pair_p) /**< property pair to be freed */
+void
+ecma_dealloc_string_buffer (void *buffer_p, /**< buffer to be freed */
+                            size_t size) /**< size of the buffer */
 {
-  mem_heap_free_block (property_pair_p, sizeof (ecma_property_pair_t));
-} /* ecma_dealloc_property_pair */
+  if (MEM_POOLS_IS_CHUNK_SIZE (size))
+  {
+    mem_pools_free (buffer_p, size);
+  }
+  else
+  {
+    mem_heap_free_block (buffer_p, size);
+  }
+} /* ecma_dealloc_string_buffer */
 
 /**
  * @}
@@ -121,6 +121,90 @@ extern ecma_property_pair_t *ecma_alloc_property_pair (void);
  */
 extern void ecma_dealloc_property_pair (ecma_property_pair_t *);
 
+/**
+ * Allocate memory for slot array of an object with shape
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_property_slots_t *ecma_alloc_property_slots (size_t);
+
+/**
+ * Dealloc memory from slot array of an object with shape
+ */
+extern void ecma_dealloc_property_slots (ecma_property_slots_t *, size_t);
+
+/**
+ * Allocate memory for shape
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_shape_t *ecma_alloc_shape (size_t);
+
+/**
+ * Dealloc memory from shape
+ */
+extern void ecma_dealloc_shape (ecma_shape_t *, size_t);
+
+/**
+ * Allocate memory for property name hash map
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_property_hashmap_t *ecma_alloc_property_hashmap (size_t);
+
+/**
+ * Dealloc memory from property name hash map
+ */
+extern void ecma_dealloc_property_hashmap (ecma_property_hashmap_t *, size_t);
+
+/**
+ * Allocate memory for element storage of an array
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_array_elements_t *ecma_alloc_array_elements (size_t);
+
+/**
+ * Dealloc memory from element storage of an array
+ */
+extern void ecma_dealloc_array_elements (ecma_array_elements_t *, size_t);
+
+/**
+ * Allocate memory for the data block of an ArrayBuffer
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_arraybuffer_t *ecma_alloc_arraybuffer (size_t);
+
+/**
+ * Dealloc memory from the data block of an ArrayBuffer
+ */
+extern void ecma_dealloc_arraybuffer (ecma_arraybuffer_t *, size_t);
+
+/**
+ * Allocate memory for the view of a typed array or a DataView
+ *
+ * @return pointer to allocated memory
+ */
+extern ecma_typedarray_t *ecma_alloc_typedarray (void);
+
+/**
+ * Dealloc memory from the view of a typed array or a DataView
+ */
+extern void ecma_dealloc_typedarray (ecma_typedarray_t *);
+
+/**
+ * Allocate memory for the character data of an ecma-string
+ *
+ * @return pointer to allocated memory
+ */
+extern void *ecma_alloc_string_buffer (size_t);
+
+/**
+ * Dealloc memory of the character data of an ecma-string
+ */
+extern void ecma_dealloc_string_buffer (void *, size_t);
+
 /**
  * @}
  * @}
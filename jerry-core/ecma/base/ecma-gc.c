@@ -21,7 +21,10 @@
 #include "ecma-globals.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lcache.h"
+#include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "jrt-bit-fields.h"
@@ -46,8 +49,19 @@
  *
  * Tri-color marking:
  *   WHITE_GRAY, unvisited -> WHITE // not referenced by a live object or the reference not found yet
- *   WHITE_GRAY, visited   -> GRAY  // referenced by some live object
- *   BLACK                 -> BLACK // all referenced objects are gray or black
+ *   WHITE_GRAY, visited   -> GRAY or BLACK // referenced by some live object
+ *                                          // (gray objects are on the mark stack)
+ *   BLACK                 -> BLACK // survived the sweep of the current GC session
+ *
+ * Objects, which are allocated during a GC session, are not freed by the session.
+ *
+ * Generations:
+ *   Objects, which are allocated while no GC session is in progress, are young, until the next
+ *   minor or full GC session. Young objects are kept on a separate list, and are in visited state
+ *   (while old objects are unvisited) outside of GC sessions.
+ *
+ *   Minor GC session marks young objects, which are reachable from roots or from old objects
+ *   of the remembered set, frees the unreachable young objects and promotes the surviving ones.
  */
 typedef enum
 {
@@ -56,6 +70,19 @@ typedef enum
   ECMA_GC_COLOR__COUNT /**< number of colors */
 } ecma_gc_color_t;
 
+/**
+ * Phase of the current GC session
+ *
+ * A GC session is performed either at once (see also: ecma_gc_run), or incrementally,
+ * in steps interleaved with execution of the engine (see also: ecma_gc_step).
+ */
+typedef enum
+{
+  ECMA_GC_PHASE_IDLE, /**< no GC session is in progress */
+  ECMA_GC_PHASE_MARK, /**< marking reachable objects */
+  ECMA_GC_PHASE_SWEEP /**< freeing unreachable objects */
+} ecma_gc_phase_t;
+
 /**
  * List of marked (visited during current GC session) and umarked objects
  */
@@ -77,13 +104,155 @@ static bool ecma_gc_visited_flip_flag = false;
 static size_t ecma_gc_objects_number = 0;
 
 /**
- * Number of newly allocated objects since last GC session
+ * Size of the heap usage after last GC session
+ */
+static size_t ecma_gc_heap_size_after_last_gc = 0;
+
+/**
+ * Minimum growth of the heap since last GC session (in bytes), which is required to start a new one
+ */
+static size_t ecma_gc_min_allocated_bytes = CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES;
+
+/**
+ * Growth of the heap since last GC session (in percents of the heap usage after the session),
+ * after achieving which, a new session is started
+ */
+static uint32_t ecma_gc_heap_growth_percent = CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT;
+
+/**
+ * Statistics of the garbage collector (the numbers of objects are not maintained here)
+ */
+static ecma_gc_stats_t ecma_gc_stats;
+
+/**
+ * Total counters upon start of current GC pause
+ */
+static ecma_gc_counters_t ecma_gc_pause_start_totals;
+
+/**
+ * Heap usage upon start of current GC pause
+ */
+static size_t ecma_gc_pause_start_heap_size;
+
+/**
+ * Number of invalidated LCache entries upon start of current GC pause
+ */
+static size_t ecma_gc_pause_start_lcache_invalidations;
+
+/**
+ * Number of entries of the mark stack
+ */
+#define ECMA_GC_MARK_STACK_SIZE (CONFIG_ECMA_GC_MARK_STACK_SIZE)
+
+/**
+ * Stack of objects, which are visited, but their references are not traversed yet
+ */
+static mem_cpointer_t ecma_gc_mark_stack[ECMA_GC_MARK_STACK_SIZE];
+
+/**
+ * Number of objects on the mark stack
+ */
+static size_t ecma_gc_mark_stack_depth = 0;
+
+/**
+ * Flag that indicates whether some visited object was not pushed onto the mark stack, because it was full
+ */
+static bool ecma_gc_mark_stack_overflowed = false;
+
+/**
+ * Phase of the current GC session
+ */
+static ecma_gc_phase_t ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+
+/**
+ * Next object of the white-gray list to scan during marking
  */
-static size_t ecma_gc_new_objects_since_last_gc = 0;
+static ecma_object_t *ecma_gc_scan_cursor_p = NULL;
+
+/**
+ * Flag that indicates whether the white-gray list is scanned for visited objects to rescan their references
+ * (after an overflow of the mark stack), instead of root objects
+ */
+static bool ecma_gc_is_rescan = false;
+
+/**
+ * List of young objects
+ */
+static ecma_object_t *ecma_gc_young_objects_list = NULL;
+
+/**
+ * Number of young objects
+ */
+static size_t ecma_gc_young_objects_number = 0;
+
+/**
+ * Number of entries of the remembered set
+ */
+#define ECMA_GC_REMEMBERED_SET_SIZE (CONFIG_ECMA_GC_REMEMBERED_SET_SIZE)
+
+/**
+ * Old objects, which might reference young objects (remembered set)
+ *
+ * Note:
+ *      objects of the remembered set are in visited state, like young objects,
+ *      so the write barrier does not add them to the set again.
+ */
+static mem_cpointer_t ecma_gc_remembered_set[ECMA_GC_REMEMBERED_SET_SIZE];
+
+/**
+ * Number of objects in the remembered set
+ */
+static size_t ecma_gc_remembered_set_size = 0;
 
 static void ecma_gc_mark (ecma_object_t *object_p);
 static void ecma_gc_sweep (ecma_object_t *object_p);
 
+/**
+ * Start a GC pause
+ *
+ * Note:
+ *      the GC callback is notified about start of the pause, so that its duration could be measured
+ *      by the embedder (see also: jerry_dispatch_gc_callback)
+ */
+static void
+ecma_gc_pause_start (ecma_gc_pause_kind_t kind) /**< kind of the pause */
+{
+  ecma_gc_pause_start_totals = ecma_gc_stats.totals;
+  ecma_gc_pause_start_heap_size = mem_heap_get_allocated_size ();
+  ecma_gc_pause_start_lcache_invalidations = ecma_lcache_get_invalidations_number ();
+
+  jerry_dispatch_gc_callback (kind, false, NULL);
+} /* ecma_gc_pause_start */
+
+/**
+ * Finish a GC pause, accounting its work in the total counters
+ */
+static void
+ecma_gc_pause_finish (ecma_gc_pause_kind_t kind) /**< kind of the pause */
+{
+  ecma_gc_counters_t *totals_p = &ecma_gc_stats.totals;
+  size_t heap_size = mem_heap_get_allocated_size ();
+
+  if (heap_size < ecma_gc_pause_start_heap_size)
+  {
+    totals_p->freed_bytes += ecma_gc_pause_start_heap_size - heap_size;
+  }
+
+  totals_p->lcache_invalidations += (ecma_lcache_get_invalidations_number ()
+                                     - ecma_gc_pause_start_lcache_invalidations);
+
+  ecma_gc_counters_t pause_counters;
+  pause_counters.marked_objects = totals_p->marked_objects - ecma_gc_pause_start_totals.marked_objects;
+  pause_counters.swept_objects = totals_p->swept_objects - ecma_gc_pause_start_totals.swept_objects;
+  pause_counters.freed_bytes = totals_p->freed_bytes - ecma_gc_pause_start_totals.freed_bytes;
+  pause_counters.lcache_invalidations = (totals_p->lcache_invalidations
+                                         - ecma_gc_pause_start_totals.lcache_invalidations);
+  pause_counters.regexp_cache_entries_freed = (totals_p->regexp_cache_entries_freed
+                                               - ecma_gc_pause_start_totals.regexp_cache_entries_freed);
+
+  jerry_dispatch_gc_callback (kind, true, &pause_counters);
+} /* ecma_gc_pause_finish */
+
 /**
  * Get next object in list of objects with same generation.
  */
@@ -139,25 +308,213 @@ ecma_gc_set_object_visited (ecma_object_t *object_p, /**< object */
   }
 } /* ecma_gc_set_object_visited */
 
+/**
+ * Mark object as visited and push it onto the mark stack, if it was not visited yet.
+ *
+ * Note:
+ *      if the mark stack is full, the object is only marked as visited,
+ *      and its references are traversed during rescan (see also: ecma_gc_run).
+ */
+static void
+ecma_gc_set_object_gray (ecma_object_t *object_p) /**< object */
+{
+  if (ecma_gc_is_object_visited (object_p))
+  {
+    return;
+  }
+
+  ecma_gc_set_object_visited (object_p, true);
+
+  if (likely (ecma_gc_mark_stack_depth < ECMA_GC_MARK_STACK_SIZE))
+  {
+    ECMA_SET_NON_NULL_POINTER (ecma_gc_mark_stack[ecma_gc_mark_stack_depth], object_p);
+    ecma_gc_mark_stack_depth++;
+  }
+  else
+  {
+    ecma_gc_mark_stack_overflowed = true;
+  }
+} /* ecma_gc_set_object_gray */
+
+/**
+ * Promote all young objects to old objects without garbage collection
+ */
+static void
+ecma_gc_promote_young_objects (void)
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+
+  for (size_t i = 0; i < ecma_gc_remembered_set_size; i++)
+  {
+    ecma_gc_set_object_visited (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]), false);
+  }
+
+  ecma_gc_remembered_set_size = 0;
+
+  ecma_object_t *obj_p = ecma_gc_young_objects_list;
+
+  while (obj_p != NULL)
+  {
+    ecma_object_t *next_obj_p = ecma_gc_get_object_next (obj_p);
+
+    ecma_gc_set_object_visited (obj_p, false);
+    ecma_gc_set_object_next (obj_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
+    ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_p;
+
+    obj_p = next_obj_p;
+  }
+
+  ecma_gc_young_objects_list = NULL;
+  ecma_gc_young_objects_number = 0;
+} /* ecma_gc_promote_young_objects */
+
+/**
+ * Run minor garbage collection
+ *
+ * Note:
+ *      old objects are not freed by minor garbage collection, so the cost of the session
+ *      depends only on the number of young objects and the size of the remembered set.
+ */
+static void
+ecma_gc_run_minor (void)
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_IDLE);
+  JERRY_ASSERT (ecma_gc_mark_stack_depth == 0 && !ecma_gc_mark_stack_overflowed);
+
+  ecma_gc_pause_start (ECMA_GC_PAUSE_MINOR);
+
+  /* Old objects become visited, so marking does not traverse them, while young objects become unvisited */
+  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+
+  for (size_t i = 0; i < ecma_gc_remembered_set_size; i++)
+  {
+    ecma_gc_set_object_gray (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]));
+  }
+
+  for (ecma_object_t *obj_p = ecma_gc_young_objects_list;
+       obj_p != NULL;
+       obj_p = ecma_gc_get_object_next (obj_p))
+  {
+    if (obj_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    {
+      /* the object is referenced from stack or globals (i.e. it is root) */
+      ecma_gc_set_object_gray (obj_p);
+    }
+  }
+
+  while (true)
+  {
+    while (ecma_gc_mark_stack_depth > 0)
+    {
+      ecma_gc_mark_stack_depth--;
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_mark_stack[ecma_gc_mark_stack_depth]));
+    }
+
+    if (likely (!ecma_gc_mark_stack_overflowed))
+    {
+      break;
+    }
+
+    ecma_gc_mark_stack_overflowed = false;
+
+    for (size_t i = 0; i < ecma_gc_remembered_set_size; i++)
+    {
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_remembered_set[i]));
+    }
+
+    for (ecma_object_t *obj_p = ecma_gc_young_objects_list;
+         obj_p != NULL;
+         obj_p = ecma_gc_get_object_next (obj_p))
+    {
+      if (ecma_gc_is_object_visited (obj_p))
+      {
+        ecma_gc_mark (obj_p);
+      }
+    }
+  }
+
+  ecma_lcache_invalidate_unreachable (ecma_gc_is_object_visited);
+
+  /* Sweeping unmarked young objects, and moving the marked ones to the list of old objects */
+  ecma_object_t *obj_p = ecma_gc_young_objects_list;
+
+  while (obj_p != NULL)
+  {
+    ecma_object_t *next_obj_p = ecma_gc_get_object_next (obj_p);
+
+    if (ecma_gc_is_object_visited (obj_p))
+    {
+      ecma_gc_set_object_next (obj_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
+      ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_p;
+    }
+    else
+    {
+      ecma_gc_sweep (obj_p);
+    }
+
+    obj_p = next_obj_p;
+  }
+
+  ecma_gc_young_objects_list = NULL;
+  ecma_gc_young_objects_number = 0;
+  ecma_gc_remembered_set_size = 0;
+
+  /* All the remaining objects are old, and so become unvisited */
+  ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+
+  ecma_gc_stats.minor_gcs++;
+
+  ecma_gc_pause_finish (ECMA_GC_PAUSE_MINOR);
+} /* ecma_gc_run_minor */
+
 /**
  * Initialize GC information for the object
  */
 inline void
 ecma_init_gc_info (ecma_object_t *object_p) /**< object */
 {
-  ecma_gc_objects_number++;
-  ecma_gc_new_objects_since_last_gc++;
+  JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
+
+  if (likely (ecma_gc_phase == ECMA_GC_PHASE_IDLE))
+  {
+    if (unlikely (ecma_gc_young_objects_number >= CONFIG_ECMA_GC_NURSERY_SIZE))
+    {
+      ecma_gc_run_minor ();
+    }
 
-  JERRY_ASSERT (ecma_gc_new_objects_since_last_gc <= ecma_gc_objects_number);
+    ecma_gc_objects_number++;
+
+    object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_OBJECT_REF_ONE);
+
+    ecma_gc_set_object_next (object_p, ecma_gc_young_objects_list);
+    ecma_gc_young_objects_list = object_p;
+    ecma_gc_young_objects_number++;
+
+    ecma_gc_set_object_visited (object_p, true);
+    return;
+  }
+
+  ecma_gc_objects_number++;
 
-  JERRY_ASSERT (object_p->type_flags_refs < ECMA_OBJECT_REF_ONE);
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs | ECMA_OBJECT_REF_ONE);
 
-  ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
-  ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  if (unlikely (ecma_gc_phase == ECMA_GC_PHASE_SWEEP))
+  {
+    /* The new object is put directly to the list of the objects, that survived the sweep */
+    ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
+    ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = object_p;
+  }
+  else
+  {
+    ecma_gc_set_object_next (object_p, ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY]);
+    ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = object_p;
+  }
 
-  /* Should be set to false at the beginning of garbage collection */
-  ecma_gc_set_object_visited (object_p, false);
+  /*
+   * Objects, which are created during a GC session, are black: all objects, which are referenced
+   * by them, are marked through the write barrier (see also: ecma_gc_write_barrier).
+   */
+  ecma_gc_set_object_visited (object_p, true);
 } /* ecma_init_gc_info */
 
 /**
@@ -169,6 +526,12 @@ ecma_ref_object (ecma_object_t *object_p) /**< object */
   if (object_p->type_flags_refs < ECMA_OBJECT_MAX_REF)
   {
     object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs + ECMA_OBJECT_REF_ONE);
+
+    /* The scan of roots might have already passed the object */
+    if (unlikely (ecma_gc_phase == ECMA_GC_PHASE_MARK))
+    {
+      ecma_gc_set_object_gray (object_p);
+    }
   }
   else
   {
@@ -186,6 +549,44 @@ ecma_deref_object (ecma_object_t *object_p) /**< object */
   object_p->type_flags_refs = (uint16_t) (object_p->type_flags_refs - ECMA_OBJECT_REF_ONE);
 } /* ecma_deref_object */
 
+/**
+ * Write barrier of the garbage collector
+ *
+ * Should be called upon storing a reference to an object into another object (including objects
+ * under construction), so that the referenced object is not missed by marking that is in progress,
+ * and old objects, which reference young objects, are in the remembered set.
+ */
+void
+ecma_gc_write_barrier (ecma_object_t *object_p, /**< object, which the reference is stored into */
+                       ecma_object_t *value_p) /**< referenced object */
+{
+  if (likely (ecma_gc_phase == ECMA_GC_PHASE_IDLE))
+  {
+    /* Outside of GC sessions, young objects and the objects of the remembered set are in visited state */
+    if (!ecma_gc_is_object_visited (value_p)
+        || ecma_gc_is_object_visited (object_p))
+    {
+      return;
+    }
+
+    if (likely (ecma_gc_remembered_set_size < ECMA_GC_REMEMBERED_SET_SIZE))
+    {
+      ECMA_SET_NON_NULL_POINTER (ecma_gc_remembered_set[ecma_gc_remembered_set_size], object_p);
+      ecma_gc_remembered_set_size++;
+
+      ecma_gc_set_object_visited (object_p, true);
+    }
+    else
+    {
+      ecma_gc_promote_young_objects ();
+    }
+  }
+  else if (ecma_gc_phase == ECMA_GC_PHASE_MARK)
+  {
+    ecma_gc_set_object_gray (value_p);
+  }
+} /* ecma_gc_write_barrier */
+
 /**
  * Initialize garbage collector
  */
@@ -195,8 +596,19 @@ ecma_gc_init (void)
   ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = NULL;
   ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
   ecma_gc_visited_flip_flag = false;
+  ecma_gc_mark_stack_depth = 0;
+  ecma_gc_mark_stack_overflowed = false;
+  ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+  ecma_gc_scan_cursor_p = NULL;
+  ecma_gc_is_rescan = false;
+  ecma_gc_young_objects_list = NULL;
+  ecma_gc_young_objects_number = 0;
+  ecma_gc_remembered_set_size = 0;
   ecma_gc_objects_number = 0;
-  ecma_gc_new_objects_since_last_gc = 0;
+  ecma_gc_heap_size_after_last_gc = 0;
+  ecma_gc_min_allocated_bytes = CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES;
+  ecma_gc_heap_growth_percent = CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT;
+  memset (&ecma_gc_stats, 0, sizeof (ecma_gc_stats));
 } /* ecma_gc_init */
 
 /**
@@ -215,7 +627,7 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
       {
         ecma_object_t *value_obj_p = ecma_get_object_from_value (value);
 
-        ecma_gc_set_object_visited (value_obj_p, true);
+        ecma_gc_set_object_gray (value_obj_p);
       }
       break;
     }
@@ -226,12 +638,12 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
 
       if (getter_obj_p != NULL)
       {
-        ecma_gc_set_object_visited (getter_obj_p, true);
+        ecma_gc_set_object_gray (getter_obj_p);
       }
 
       if (setter_obj_p != NULL)
       {
-        ecma_gc_set_object_visited (setter_obj_p, true);
+        ecma_gc_set_object_gray (setter_obj_p);
       }
       break;
     }
@@ -241,7 +653,24 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
 
       switch (ECMA_PROPERTY_GET_INTERNAL_PROPERTY_TYPE (property_p))
       {
-        case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* a collection of ecma values */
+        case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* compressed pointer to a ecma_array_elements_t */
+        {
+          ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                          property_value);
+
+          for (uint32_t i = 0; i < elements_p->capacity; i++)
+          {
+            ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, i);
+
+            if (ECMA_PROPERTY_GET_TYPE (element_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+            {
+              ecma_gc_mark_property (element_p);
+            }
+          }
+
+          break;
+        }
+
         case ECMA_INTERNAL_PROPERTY_STRING_INDEXED_ARRAY_VALUES: /* a collection of ecma values */
         {
           JERRY_UNIMPLEMENTED ("Indexed array storage is not implemented yet.");
@@ -271,17 +700,27 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
         case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31: /* an integer (bit-mask) */
         case ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63: /* an integer (bit-mask) */
         case ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE:
+        case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to a ecma_arraybuffer_t */
         {
           break;
         }
 
+        case ECMA_INTERNAL_PROPERTY_TYPEDARRAY: /* compressed pointer to a ecma_typedarray_t */
+        {
+          ecma_typedarray_t *typedarray_p = ECMA_GET_NON_NULL_POINTER (ecma_typedarray_t, property_value);
+
+          ecma_gc_set_object_gray (ECMA_GET_NON_NULL_POINTER (ecma_object_t, typedarray_p->arraybuffer_cp));
+
+          break;
+        }
+
         case ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_BOUND_THIS: /* an ecma value */
         {
           if (ecma_is_value_object (property_value))
           {
             ecma_object_t *obj_p = ecma_get_object_from_value (property_value);
 
-            ecma_gc_set_object_visited (obj_p, true);
+            ecma_gc_set_object_gray (obj_p);
           }
 
           break;
@@ -304,7 +743,7 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
             {
               ecma_object_t *obj_p = ecma_get_object_from_value (*bound_args_iterator.current_value_p);
 
-              ecma_gc_set_object_visited (obj_p, true);
+              ecma_gc_set_object_gray (obj_p);
             }
           }
 
@@ -317,7 +756,7 @@ ecma_gc_mark_property (ecma_property_t *property_p) /**< property */
         {
           ecma_object_t *obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, property_value);
 
-          ecma_gc_set_object_visited (obj_p, true);
+          ecma_gc_set_object_gray (obj_p);
 
           break;
         }
@@ -341,6 +780,8 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (ecma_gc_is_object_visited (object_p));
 
+  ecma_gc_stats.totals.marked_objects++;
+
   bool traverse_properties = true;
 
   if (ecma_is_lexical_environment (object_p))
@@ -348,13 +789,13 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *lex_env_p = ecma_get_lex_env_outer_reference (object_p);
     if (lex_env_p != NULL)
     {
-      ecma_gc_set_object_visited (lex_env_p, true);
+      ecma_gc_set_object_gray (lex_env_p);
     }
 
     if (ecma_get_lex_env_type (object_p) != ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE)
     {
       ecma_object_t *binding_object_p = ecma_get_lex_env_binding_object (object_p);
-      ecma_gc_set_object_visited (binding_object_p, true);
+      ecma_gc_set_object_gray (binding_object_p);
 
       traverse_properties = false;
     }
@@ -364,7 +805,7 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
     ecma_object_t *proto_p = ecma_get_object_prototype (object_p);
     if (proto_p != NULL)
     {
-      ecma_gc_set_object_visited (proto_p, true);
+      ecma_gc_set_object_gray (proto_p);
     }
   }
 
@@ -372,6 +813,30 @@ ecma_gc_mark (ecma_object_t *object_p) /**< object to mark from */
   {
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
+    if (prop_iter_p != NULL && ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+    {
+      ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+      for (uint32_t i = 0; i < shape_p->property_count; i++)
+      {
+        ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i);
+
+        if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_gc_mark_property (property_p);
+        }
+      }
+
+      prop_iter_p = NULL;
+    }
+
+    if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+    {
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+
     while (prop_iter_p != NULL)
     {
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -428,6 +893,34 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
   {
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
+    if (prop_iter_p != NULL && ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+    {
+      ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+      ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+      for (uint32_t i = 0; i < shape_p->property_count; i++)
+      {
+        ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i);
+
+        if (property_p->type_and_flags != ECMA_PROPERTY_TYPE_DELETED)
+        {
+          ecma_free_property (object_p, ecma_shape_get_property_name (shape_p, i), property_p);
+        }
+      }
+
+      ecma_dealloc_property_slots (slots_p, ECMA_PROPERTY_SLOTS_SIZE (slots_p->capacity));
+      ecma_shape_deref (shape_p);
+
+      prop_iter_p = NULL;
+    }
+
+    if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+    {
+      /* Freeing the hash map also removes the property pairs, whose properties are all deleted. */
+      ecma_property_hashmap_free (object_p);
+      prop_iter_p = ecma_get_property_list (object_p);
+    }
+
     while (prop_iter_p != NULL)
     {
       JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -467,82 +960,108 @@ ecma_gc_sweep (ecma_object_t *object_p) /**< object to free */
   JERRY_ASSERT (ecma_gc_objects_number > 0);
   ecma_gc_objects_number--;
 
+  ecma_gc_stats.totals.swept_objects++;
+
   ecma_dealloc_object (object_p);
 } /* ecma_gc_sweep */
 
 /**
- * Run garbage collecting
+ * Perform a step of marking
+ *
+ * @return remaining part of the budget
  */
-void
-ecma_gc_run (void)
+static size_t
+ecma_gc_mark_step (size_t budget) /**< maximum number of objects to process */
 {
-  ecma_gc_new_objects_since_last_gc = 0;
-
-  JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_MARK);
 
-  /* if some object is referenced from stack or globals (i.e. it is root), mark it */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
-       obj_iter_p != NULL;
-       obj_iter_p = ecma_gc_get_object_next (obj_iter_p))
+  while (budget > 0)
   {
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    budget--;
 
-    if (obj_iter_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
+    if (ecma_gc_mark_stack_depth > 0)
     {
-      ecma_gc_set_object_visited (obj_iter_p, true);
+      ecma_gc_mark_stack_depth--;
+      ecma_gc_mark (ECMA_GET_NON_NULL_POINTER (ecma_object_t, ecma_gc_mark_stack[ecma_gc_mark_stack_depth]));
     }
-  }
-
-  bool marked_anything_during_current_iteration = false;
-
-  do
-  {
-    marked_anything_during_current_iteration = false;
-
-    for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_prev_p = NULL, *obj_next_p;
-         obj_iter_p != NULL;
-         obj_iter_p = obj_next_p)
+    else if (ecma_gc_scan_cursor_p != NULL)
     {
-      obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+      ecma_object_t *obj_p = ecma_gc_scan_cursor_p;
+      ecma_gc_scan_cursor_p = ecma_gc_get_object_next (obj_p);
 
-      if (ecma_gc_is_object_visited (obj_iter_p))
+      if (ecma_gc_is_rescan)
       {
-        /* Moving the object to list of marked objects */
-        ecma_gc_set_object_next (obj_iter_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
-        ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_iter_p;
-
-        if (likely (obj_prev_p != NULL))
-        {
-          JERRY_ASSERT (ecma_gc_get_object_next (obj_prev_p) == obj_iter_p);
-
-          ecma_gc_set_object_next (obj_prev_p, obj_next_p);
-        }
-        else
+        if (ecma_gc_is_object_visited (obj_p))
         {
-          ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = obj_next_p;
+          ecma_gc_mark (obj_p);
         }
-
-        ecma_gc_mark (obj_iter_p);
-        marked_anything_during_current_iteration = true;
       }
-      else
+      else if (obj_p->type_flags_refs >= ECMA_OBJECT_REF_ONE)
       {
-        obj_prev_p = obj_iter_p;
+        /* the object is referenced from stack or globals (i.e. it is root) */
+        ecma_gc_set_object_gray (obj_p);
       }
     }
+    else if (unlikely (ecma_gc_mark_stack_overflowed))
+    {
+      /*
+       * Objects, which were visited while the mark stack was full, might have untraversed references,
+       * so references of all visited objects are traversed again, until the stack does not overflow.
+       */
+      ecma_gc_mark_stack_overflowed = false;
+      ecma_gc_is_rescan = true;
+      ecma_gc_scan_cursor_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+    }
+    else
+    {
+      /* The entries of unreachable objects must not outlive the objects */
+      ecma_lcache_invalidate_unreachable (ecma_gc_is_object_visited);
+
+      ecma_gc_phase = ECMA_GC_PHASE_SWEEP;
+      break;
+    }
   }
-  while (marked_anything_during_current_iteration);
 
-  /* Sweeping objects that are currently unmarked */
-  for (ecma_object_t *obj_iter_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY], *obj_next_p;
-       obj_iter_p != NULL;
-       obj_iter_p = obj_next_p)
+  return budget;
+} /* ecma_gc_mark_step */
+
+/**
+ * Perform a step of sweeping
+ *
+ * @return remaining part of the budget
+ */
+static size_t
+ecma_gc_sweep_step (size_t budget) /**< maximum number of objects to process */
+{
+  JERRY_ASSERT (ecma_gc_phase == ECMA_GC_PHASE_SWEEP);
+
+  /* Sweeping objects that are currently unmarked, and moving the marked ones to the list of black objects */
+  while (budget > 0)
   {
-    obj_next_p = ecma_gc_get_object_next (obj_iter_p);
+    ecma_object_t *obj_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+
+    if (obj_p == NULL)
+    {
+      break;
+    }
 
-    JERRY_ASSERT (!ecma_gc_is_object_visited (obj_iter_p));
+    budget--;
+    ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] = ecma_gc_get_object_next (obj_p);
 
-    ecma_gc_sweep (obj_iter_p);
+    if (ecma_gc_is_object_visited (obj_p))
+    {
+      ecma_gc_set_object_next (obj_p, ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK]);
+      ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = obj_p;
+    }
+    else
+    {
+      ecma_gc_sweep (obj_p);
+    }
+  }
+
+  if (ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY] != NULL)
+  {
+    return budget;
   }
 
   /* Unmarking all objects */
@@ -550,13 +1069,158 @@ ecma_gc_run (void)
   ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] = NULL;
 
   ecma_gc_visited_flip_flag = !ecma_gc_visited_flip_flag;
+  ecma_gc_phase = ECMA_GC_PHASE_IDLE;
+  ecma_gc_stats.full_gc_sessions++;
 
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN
   /* Free RegExp bytecodes stored in cache */
-  re_cache_gc_run ();
+  ecma_gc_stats.totals.regexp_cache_entries_freed += re_cache_gc_run ();
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+  mem_release_free_memory ();
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
+  ecma_gc_heap_size_after_last_gc = mem_heap_get_allocated_size ();
+
+  return budget;
+} /* ecma_gc_sweep_step */
+
+/**
+ * Perform a step of garbage collecting, starting a new GC session, if no session is in progress.
+ *
+ * The budget limits the number of objects, which are scanned, traversed or swept during the step.
+ *
+ * @return true - if the GC session was completed during the step,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_perform_step (size_t budget) /**< maximum number of objects to process */
+{
+  if (ecma_gc_phase == ECMA_GC_PHASE_IDLE)
+  {
+    JERRY_ASSERT (ecma_gc_objects_lists[ECMA_GC_COLOR_BLACK] == NULL);
+    JERRY_ASSERT (ecma_gc_mark_stack_depth == 0 && !ecma_gc_mark_stack_overflowed);
+
+    ecma_gc_promote_young_objects ();
+
+    ecma_gc_phase = ECMA_GC_PHASE_MARK;
+    ecma_gc_scan_cursor_p = ecma_gc_objects_lists[ECMA_GC_COLOR_WHITE_GRAY];
+    ecma_gc_is_rescan = false;
+  }
+
+  if (ecma_gc_phase == ECMA_GC_PHASE_MARK)
+  {
+    budget = ecma_gc_mark_step (budget);
+  }
+
+  if (ecma_gc_phase == ECMA_GC_PHASE_SWEEP)
+  {
+    ecma_gc_sweep_step (budget);
+  }
+
+  return ecma_gc_phase == ECMA_GC_PHASE_IDLE;
+} /* ecma_gc_perform_step */
+
+/**
+ * Perform a step of incremental garbage collecting (see also: ecma_gc_perform_step)
+ *
+ * @return true - if the GC session was completed during the step,
+ *         false - otherwise.
+ */
+bool
+ecma_gc_step (size_t budget) /**< maximum number of objects to process */
+{
+  ecma_gc_pause_start (ECMA_GC_PAUSE_STEP);
+
+  bool is_completed = ecma_gc_perform_step (budget);
+
+  ecma_gc_pause_finish (ECMA_GC_PAUSE_STEP);
+
+  return is_completed;
+} /* ecma_gc_step */
+
+/**
+ * Run garbage collecting
+ *
+ * Note:
+ *      GC session, which is in progress, is completed before running a new one,
+ *      as the session does not free objects, which were allocated after its start.
+ */
+void
+ecma_gc_run (void)
+{
+  ecma_gc_pause_start (ECMA_GC_PAUSE_FULL);
+
+  if (ecma_gc_phase != ECMA_GC_PHASE_IDLE)
+  {
+    ecma_gc_perform_step (SIZE_MAX);
+  }
+
+  bool is_completed = ecma_gc_perform_step (SIZE_MAX);
+  JERRY_ASSERT (is_completed);
+
+  ecma_gc_pause_finish (ECMA_GC_PAUSE_FULL);
 } /* ecma_gc_run */
 
+/**
+ * Get the policy of starting GC sessions upon low severity try-give-memory-back requests
+ */
+void
+ecma_gc_get_policy (size_t *min_allocated_bytes_p, /**< [out] minimum growth of the heap since last GC (in bytes) */
+                    uint32_t *heap_growth_percent_p) /**< [out] growth of the heap since last GC (in percents
+                                                      *         of the heap usage after the GC) */
+{
+  *min_allocated_bytes_p = ecma_gc_min_allocated_bytes;
+  *heap_growth_percent_p = ecma_gc_heap_growth_percent;
+} /* ecma_gc_get_policy */
+
+/**
+ * Set the policy of starting GC sessions upon low severity try-give-memory-back requests
+ */
+void
+ecma_gc_set_policy (size_t min_allocated_bytes, /**< minimum growth of the heap since last GC (in bytes) */
+                    uint32_t heap_growth_percent) /**< growth of the heap since last GC (in percents
+                                                   *   of the heap usage after the GC) */
+{
+  ecma_gc_min_allocated_bytes = min_allocated_bytes;
+  ecma_gc_heap_growth_percent = heap_growth_percent;
+} /* ecma_gc_set_policy */
+
+/**
+ * Get statistics of the garbage collector
+ */
+void
+ecma_gc_get_stats (ecma_gc_stats_t *out_gc_stats_p) /**< [out] GC statistics */
+{
+  *out_gc_stats_p = ecma_gc_stats;
+  out_gc_stats_p->objects = ecma_gc_objects_number;
+  out_gc_stats_p->young_objects = ecma_gc_young_objects_number;
+} /* ecma_gc_get_stats */
+
+/**
+ * Check whether the heap has grown enough since last GC session to start a new one
+ *
+ * @return true - if both the minimum growth (in bytes), and the growth relative to the heap usage
+ *                after last GC session are achieved,
+ *         false - otherwise.
+ */
+static bool
+ecma_gc_is_heap_grown_enough (void)
+{
+  size_t heap_size = mem_heap_get_allocated_size ();
+
+  if (heap_size <= ecma_gc_heap_size_after_last_gc)
+  {
+    return false;
+  }
+
+  size_t growth = heap_size - ecma_gc_heap_size_after_last_gc;
+
+  return (growth >= ecma_gc_min_allocated_bytes
+          && (uint64_t) growth * 100 >= (uint64_t) ecma_gc_heap_size_after_last_gc * ecma_gc_heap_growth_percent);
+} /* ecma_gc_is_heap_grown_enough */
+
 /**
  * Try to free some memory (depending on severity).
  */
@@ -567,12 +1231,25 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
   if (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_LOW)
   {
     /*
-     * If there is enough newly allocated objects since last GC, probably it is worthwhile to start GC now.
-     * Otherwise, probability to free sufficient space is considered to be low.
+     * If the heap has grown enough since last GC, probably it is worthwhile to start GC now.
+     * Otherwise, probability to free sufficient space is considered to be low,
+     * so only young objects are collected, as most of them are usually unreachable.
      */
-    if (ecma_gc_new_objects_since_last_gc * CONFIG_ECMA_GC_NEW_OBJECTS_SHARE_TO_START_GC > ecma_gc_objects_number)
+    if (ecma_gc_phase == ECMA_GC_PHASE_IDLE
+        && !ecma_gc_is_heap_grown_enough ())
+    {
+      if (ecma_gc_young_objects_list != NULL)
+      {
+        ecma_gc_run_minor ();
+      }
+    }
+    else
     {
+#ifdef JERRY_ENABLE_INCREMENTAL_GC
+      ecma_gc_step (CONFIG_ECMA_GC_STEP_BUDGET);
+#else /* !JERRY_ENABLE_INCREMENTAL_GC */
       ecma_gc_run ();
+#endif /* JERRY_ENABLE_INCREMENTAL_GC */
     }
   }
   else
@@ -580,7 +1257,7 @@ ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t severity)
     JERRY_ASSERT (severity == MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH);
 
     /* Freeing as much memory as we currently can */
-    ecma_lcache_invalidate_all ();
+    ecma_inline_cache_invalidate_all ();
 
     ecma_gc_run ();
   }
@@ -26,11 +26,50 @@
  * @{
  */
 
+/**
+ * Kind of a garbage collection pause
+ */
+typedef enum
+{
+  ECMA_GC_PAUSE_MINOR, /**< minor garbage collection (see also: ecma_gc_run_minor) */
+  ECMA_GC_PAUSE_FULL, /**< complete full garbage collection session (see also: ecma_gc_run) */
+  ECMA_GC_PAUSE_STEP /**< step of incremental garbage collection session (see also: ecma_gc_step) */
+} ecma_gc_pause_kind_t;
+
+/**
+ * Counters of garbage collector's work
+ */
+typedef struct
+{
+  size_t marked_objects; /**< number of objects, which were traversed by marking */
+  size_t swept_objects; /**< number of freed objects */
+  size_t freed_bytes; /**< decrease of the heap usage */
+  size_t lcache_invalidations; /**< number of invalidated LCache entries */
+  size_t regexp_cache_entries_freed; /**< number of freed RegExp cache entries */
+} ecma_gc_counters_t;
+
+/**
+ * Statistics of the garbage collector
+ */
+typedef struct
+{
+  size_t objects; /**< number of objects (including lexical environments) */
+  size_t young_objects; /**< number of objects, which have not survived a garbage collection yet */
+  size_t full_gc_sessions; /**< number of completed full garbage collection sessions */
+  size_t minor_gcs; /**< number of minor garbage collections */
+  ecma_gc_counters_t totals; /**< total counters of all garbage collection pauses */
+} ecma_gc_stats_t;
+
 extern void ecma_gc_init (void);
 extern void ecma_init_gc_info (ecma_object_t *);
 extern void ecma_ref_object (ecma_object_t *);
 extern void ecma_deref_object (ecma_object_t *);
+extern void ecma_gc_write_barrier (ecma_object_t *, ecma_object_t *);
+extern bool ecma_gc_step (size_t);
 extern void ecma_gc_run (void);
+extern void ecma_gc_get_policy (size_t *, uint32_t *);
+extern void ecma_gc_set_policy (size_t, uint32_t);
+extern void ecma_gc_get_stats (ecma_gc_stats_t *);
 extern void ecma_try_to_give_back_some_memory (mem_try_give_memory_back_severity_t);
 
 /**
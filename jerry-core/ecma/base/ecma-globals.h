@@ -55,8 +55,8 @@
  */
 typedef enum
 {
-  ECMA_TYPE_SIMPLE, /**< simple value */
-  ECMA_TYPE_NUMBER, /**< 64-bit integer */
+  ECMA_TYPE_SIMPLE, /**< simple value or small integer (see also: ECMA_VALUE_INTEGER_FLAG) */
+  ECMA_TYPE_NUMBER, /**< pointer to a heap allocated ecma_number_t */
   ECMA_TYPE_STRING, /**< pointer to description of a string */
   ECMA_TYPE_OBJECT, /**< pointer to description of an object */
   ECMA_TYPE___MAX = ECMA_TYPE_OBJECT /** highest value for ecma types */
@@ -87,9 +87,18 @@ typedef enum
  * Description of an ecma value
  *
  * Bit-field structure: type (2) | error (1) | value (29)
+ *
+ * Values of ECMA_TYPE_SIMPLE type are further divided:
+ *   simple values: type (2) | error (1) | integer flag (1) = 0 | simple value (28)
+ *   small integers: type (2) | error (1) | integer flag (1) = 1 | signed integer (28)
  */
 typedef uint32_t ecma_value_t;
 
+/**
+ * Type for small integers stored directly in an ecma_value_t
+ */
+typedef int32_t ecma_integer_value_t;
+
 #if UINTPTR_MAX <= UINT32_MAX
 
 /**
@@ -114,6 +123,32 @@ typedef uint32_t ecma_value_t;
  */
 #define ECMA_VALUE_SHIFT 3
 
+/**
+ * Flag of small integers stored in values of ECMA_TYPE_SIMPLE type
+ */
+#define ECMA_VALUE_INTEGER_FLAG (1u << ECMA_VALUE_SHIFT)
+
+/**
+ * Shift for value part of simple values and small integers
+ */
+#define ECMA_DIRECT_SHIFT (ECMA_VALUE_SHIFT + 1)
+
+/**
+ * Minimum value of a small integer
+ */
+#define ECMA_INTEGER_NUMBER_MIN (-(1 << (31 - ECMA_DIRECT_SHIFT)))
+
+/**
+ * Maximum value of a small integer
+ */
+#define ECMA_INTEGER_NUMBER_MAX ((1 << (31 - ECMA_DIRECT_SHIFT)) - 1)
+
+/**
+ * Checks whether the integer number is in the small integer range
+ */
+#define ECMA_IS_INTEGER_NUMBER(num) \
+  (ECMA_INTEGER_NUMBER_MIN <= (num) && (num) <= ECMA_INTEGER_NUMBER_MAX)
+
 /**
  * Internal properties' identifiers.
  */
@@ -132,7 +167,7 @@ typedef enum
   ECMA_INTERNAL_PROPERTY_PRIMITIVE_NUMBER_VALUE, /**< [[Primitive value]] for Number objects */
   ECMA_INTERNAL_PROPERTY_PRIMITIVE_BOOLEAN_VALUE, /**< [[Primitive value]] for Boolean objects */
 
-  /** Part of an array, that is indexed by numbers */
+  /** Part of an array, that is indexed by numbers (compressed pointer to ecma_array_elements_t) */
   ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES,
 
   /** Part of an array, that is indexed by strings */
@@ -169,6 +204,16 @@ typedef enum
    */
   ECMA_INTERNAL_PROPERTY_REGEXP_BYTECODE,
 
+  /**
+   * Data block of an ArrayBuffer object (compressed pointer to ecma_arraybuffer_t)
+   */
+  ECMA_INTERNAL_PROPERTY_ARRAYBUFFER,
+
+  /**
+   * View of a typed array or a DataView object (compressed pointer to ecma_typedarray_t)
+   */
+  ECMA_INTERNAL_PROPERTY_TYPEDARRAY,
+
   /**
    * Number of internal properties' types
    */
@@ -212,6 +257,12 @@ typedef enum
  *   first property pair, only property pair items are allowed.
  *
  *   Example for other items is property name hash map, or array of items.
+ *
+ *   Properties of ordinary objects are stored in a slot array, which is the
+ *   only item of the list (see also: ecma_property_slots_t).
+ *
+ *   Property pair lists with many properties are preceded by a property
+ *   name hash map (see also: ecma_property_hashmap_t).
  */
 
 /**
@@ -224,9 +275,12 @@ typedef enum
   ECMA_PROPERTY_TYPE_NAMEDDATA, /**< property is named data */
   ECMA_PROPERTY_TYPE_NAMEDACCESSOR, /**< property is named accessor */
 
+  ECMA_PROPERTY_TYPE_SLOTS, /**< slot array of an object with shape */
+  ECMA_PROPERTY_TYPE_HASHMAP, /**< hash map for finding the properties of an object by name */
+
   ECMA_PROPERTY_TYPE_PROPERTY_PAIR__MAX = ECMA_PROPERTY_TYPE_NAMEDACCESSOR, /**< highest value for
                                                                              *   property pair types. */
-  ECMA_PROPERTY_TYPE__MAX = ECMA_PROPERTY_TYPE_NAMEDACCESSOR, /**< highest value for property types. */
+  ECMA_PROPERTY_TYPE__MAX = ECMA_PROPERTY_TYPE_HASHMAP, /**< highest value for property types. */
 } ecma_property_types_t;
 
 /**
@@ -295,6 +349,9 @@ typedef struct
 {
   ecma_property_t types[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< two property type slot. The first represent
                                                          *   the type of this property (e.g. property pair) */
+#ifdef CONFIG_MEM_LARGE_HEAP
+  uint16_t padding; /**< padding for keeping next_property_cp aligned */
+#endif /* CONFIG_MEM_LARGE_HEAP */
   mem_cpointer_t next_property_cp; /**< next cpointer */
 } ecma_property_header_t;
 
@@ -313,7 +370,12 @@ typedef struct
 typedef union
 {
   ecma_value_t value; /**< value of a property */
+#ifdef CONFIG_MEM_LARGE_HEAP
+  mem_cpointer_t getter_setter_pair_cp; /**< compressed pointer to getter setter pair, which
+                                         *   does not fit into a property value slot */
+#else /* !CONFIG_MEM_LARGE_HEAP */
   ecma_getter_setter_pointers_t getter_setter_pair; /**< getter setter pair */
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } ecma_property_value_t;
 
 /**
@@ -326,6 +388,106 @@ typedef struct
   mem_cpointer_t names_cp[ECMA_PROPERTY_PAIR_ITEM_COUNT]; /**< property name slots */
 } ecma_property_pair_t;
 
+/**
+ * Number of items in a property group (see also: ecma_property_t).
+ */
+#define ECMA_PROPERTY_GROUP_ITEM_COUNT (sizeof (ecma_property_value_t))
+
+/**
+ * Property group: the packed layout of at most ECMA_PROPERTY_GROUP_ITEM_COUNT properties.
+ *
+ * The type slots occupy the space of a property header, so the value of a property
+ * is computed from the property address the same way as for property pairs.
+ *
+ * Note:
+ *      the last group of a slot array can be partial, i.e. hold less values.
+ */
+typedef struct
+{
+  union
+  {
+    ecma_property_header_t header; /**< space of a property header */
+    ecma_property_t types[ECMA_PROPERTY_GROUP_ITEM_COUNT]; /**< property type slots */
+  } u;
+  ecma_property_value_t values[ECMA_PROPERTY_GROUP_ITEM_COUNT]; /**< property value slots */
+} ecma_property_group_t;
+
+/**
+ * Shape (hidden class) of an object
+ *
+ * A shape describes the names of an object's properties, and the order, in which the properties were added.
+ * The shapes form a transition tree: objects, which are built the same way, share their shape. The properties
+ * of such objects are stored in a slot array according to the shape (see also: ecma_property_slots_t).
+ *
+ * The header is followed by the compressed pointers to the names of the properties, and by the names' hashes,
+ * both in the order of the properties' addition. Internal properties have no name.
+ */
+typedef struct ecma_shape_t
+{
+  uint32_t refs; /**< reference counter (objects with the shape and shapes transitioned from the shape) */
+  mem_cpointer_t parent_cp; /**< shape, which the shape was transitioned from, or NULL (empty shape) */
+  mem_cpointer_t first_transition_cp; /**< first shape, which was transitioned from the shape */
+  mem_cpointer_t next_transition_cp; /**< next shape, which was transitioned from the parent shape */
+  uint8_t property_count; /**< number of properties */
+  uint8_t transition_count; /**< number of shapes, which were transitioned from the shape */
+} ecma_shape_t;
+
+/**
+ * Slot array of an object with shape
+ *
+ * The header is followed by property groups, which hold the properties in the order of their addition,
+ * i.e. the i-th property described by the shape is stored in the i-th slot. Deleted internal properties
+ * keep their slots (with ECMA_PROPERTY_TYPE_DELETED type), while deleting a named property converts
+ * the slot array to a property pair list.
+ */
+typedef struct
+{
+  ecma_property_t type; /**< type of the property list item (ECMA_PROPERTY_TYPE_SLOTS) */
+  uint8_t capacity; /**< number of allocated slots */
+#ifdef CONFIG_MEM_LARGE_HEAP
+  uint16_t padding; /**< padding for keeping shape_cp aligned */
+#endif /* CONFIG_MEM_LARGE_HEAP */
+  mem_cpointer_t shape_cp; /**< shape of the object */
+} ecma_property_slots_t;
+
+/**
+ * Property name hash map of an object with many properties
+ *
+ * The hash map is the first item of a property pair list, so the order of the properties is not changed.
+ * The header is followed by max_property_count compressed pointers to property pairs, and by a bit array,
+ * which holds a bit for each entry:
+ *  - if the pointer is not NULL, the bit is the index of the property in the pair
+ *  - if the pointer is NULL, the bit is set for deleted entries and cleared for unused entries
+ *
+ * Note:
+ *      the hash map is only an index: it is created when the property list is long,
+ *      and it is freed when most of its properties are deleted
+ */
+typedef struct
+{
+  ecma_property_header_t header; /**< header of the property list item (ECMA_PROPERTY_TYPE_HASHMAP) */
+  uint32_t max_property_count; /**< number of entries (a power of 2) */
+  uint32_t property_count; /**< number of properties in the hash map */
+  uint32_t null_count; /**< number of unused entries */
+} ecma_property_hashmap_t;
+
+/**
+ * Fast element storage of an array
+ *
+ * The header is followed by property groups: the element with index i is stored in the i-th slot as
+ * a writable, enumerable and configurable named data property, and holes of the array are slots with
+ * ECMA_PROPERTY_TYPE_DELETED type. The storage is referenced by the array's
+ * ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES internal property.
+ *
+ * Note:
+ *      arrays without the internal property (e.g. sparse arrays) store their elements as named properties
+ */
+typedef struct
+{
+  uint32_t capacity; /**< number of allocated slots (a multiple of ECMA_PROPERTY_GROUP_ITEM_COUNT) */
+  uint32_t count; /**< number of elements (slots, which are not holes) */
+} ecma_array_elements_t;
+
 /**
  * Get property type.
  */
@@ -338,6 +500,60 @@ typedef struct
 #define ECMA_PROPERTY_IS_PROPERTY_PAIR(property_header_p) \
   (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types + 0) <= ECMA_PROPERTY_TYPE_PROPERTY_PAIR__MAX)
 
+/**
+ * Returns true if the property list item is a slot array.
+ */
+#define ECMA_PROPERTY_IS_SLOTS(property_header_p) \
+  (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types + 0) == ECMA_PROPERTY_TYPE_SLOTS)
+
+/**
+ * Returns true if the property list item is a property name hash map.
+ */
+#define ECMA_PROPERTY_IS_HASHMAP(property_header_p) \
+  (ECMA_PROPERTY_GET_TYPE ((property_header_p)->types + 0) == ECMA_PROPERTY_TYPE_HASHMAP)
+
+/**
+ * Get the property groups of a slot array.
+ */
+#define ECMA_PROPERTY_SLOTS_GET_GROUPS(slots_p) ((ecma_property_group_t *) ((slots_p) + 1))
+
+/**
+ * Get the property in the specified slot of a slot array.
+ */
+#define ECMA_PROPERTY_SLOTS_GET_PROPERTY(slots_p, index) \
+  (ECMA_PROPERTY_SLOTS_GET_GROUPS (slots_p)[(index) / ECMA_PROPERTY_GROUP_ITEM_COUNT].u.types \
+   + ((index) % ECMA_PROPERTY_GROUP_ITEM_COUNT))
+
+/**
+ * Size of a slot array with the specified capacity (the last property group is partial,
+ * if the capacity is not a multiple of ECMA_PROPERTY_GROUP_ITEM_COUNT).
+ */
+#define ECMA_PROPERTY_SLOTS_SIZE(capacity) \
+  (sizeof (ecma_property_slots_t) \
+   + ((capacity) / ECMA_PROPERTY_GROUP_ITEM_COUNT) * sizeof (ecma_property_group_t) \
+   + (((capacity) % ECMA_PROPERTY_GROUP_ITEM_COUNT) != 0 \
+      ? (sizeof (ecma_property_header_t) \
+         + ((capacity) % ECMA_PROPERTY_GROUP_ITEM_COUNT) * sizeof (ecma_property_value_t)) \
+      : 0))
+
+/**
+ * Get the property groups of an array's element storage.
+ */
+#define ECMA_ARRAY_ELEMENTS_GET_GROUPS(elements_p) ((ecma_property_group_t *) ((elements_p) + 1))
+
+/**
+ * Get the slot of the element with the specified index in an array's element storage.
+ */
+#define ECMA_ARRAY_ELEMENTS_GET_PROPERTY(elements_p, index) \
+  (ECMA_ARRAY_ELEMENTS_GET_GROUPS (elements_p)[(index) / ECMA_PROPERTY_GROUP_ITEM_COUNT].u.types \
+   + ((index) % ECMA_PROPERTY_GROUP_ITEM_COUNT))
+
+/**
+ * Size of an array's element storage with the specified capacity.
+ */
+#define ECMA_ARRAY_ELEMENTS_SIZE(capacity) \
+  (sizeof (ecma_array_elements_t) + ((capacity) / ECMA_PROPERTY_GROUP_ITEM_COUNT) * sizeof (ecma_property_group_t))
+
 /**
  * Returns the internal property type
  */
@@ -348,7 +564,8 @@ typedef struct
  * Computing the data offset of a property.
  */
 #define ECMA_PROPERTY_VALUE_OFFSET(property_p) \
-  ((((uintptr_t) (property_p)) & (sizeof (ecma_property_value_t) - 1)) + 1)
+  ((((uintptr_t) (property_p)) & (sizeof (ecma_property_value_t) - 1)) \
+   + (sizeof (ecma_property_header_t) / sizeof (ecma_property_value_t)))
 
 /**
  * Computing the base address of property data list.
@@ -760,7 +977,7 @@ typedef struct ecma_string_t
   /** Reference counter for the string */
   uint16_t refs_and_container;
 
-  /** Hash of the string (calculated from two last characters of the string) */
+  /** Hash of the string (calculated from the characters of the string) */
   lit_string_hash_t hash;
 
   /**
@@ -796,6 +1013,54 @@ typedef struct ecma_string_t
  */
 typedef uintptr_t ecma_external_pointer_t;
 
+/**
+ * Data block of an ArrayBuffer object
+ *
+ * The bytes of the buffer follow the header, unless the buffer wraps an external (host) memory block,
+ * which is not copied, and which is passed to the free callback, when the ArrayBuffer is freed.
+ */
+typedef struct
+{
+  uint8_t *buffer_p; /**< first byte of the data block */
+  ecma_external_pointer_t free_cb; /**< free callback of an external data block (or 0) */
+  uint32_t length; /**< byte length of the data block */
+} ecma_arraybuffer_t;
+
+/**
+ * Element types of typed arrays
+ */
+typedef enum
+{
+  ECMA_TYPEDARRAY_INT8, /**< Int8Array */
+  ECMA_TYPEDARRAY_UINT8, /**< Uint8Array */
+  ECMA_TYPEDARRAY_UINT8_CLAMPED, /**< Uint8ClampedArray */
+  ECMA_TYPEDARRAY_INT16, /**< Int16Array */
+  ECMA_TYPEDARRAY_UINT16, /**< Uint16Array */
+  ECMA_TYPEDARRAY_INT32, /**< Int32Array */
+  ECMA_TYPEDARRAY_UINT32, /**< Uint32Array */
+  ECMA_TYPEDARRAY_FLOAT32, /**< Float32Array */
+  ECMA_TYPEDARRAY_FLOAT64, /**< Float64Array */
+  ECMA_TYPEDARRAY_DATAVIEW /**< not a typed array: the view of a DataView object */
+} ecma_typedarray_type_t;
+
+/**
+ * View of a typed array or a DataView object
+ *
+ * The elements of a typed array are not properties: [[GetOwnProperty]] describes the requested element
+ * with the element property of the view, which is a named data property, whose value is overwritten
+ * by the next request.
+ */
+typedef struct
+{
+  ecma_property_header_t element_header; /**< type slot of the element property */
+  ecma_property_value_t element_value; /**< value slot of the element property */
+  mem_cpointer_t arraybuffer_cp; /**< the viewed ArrayBuffer object */
+  uint8_t type; /**< element type (ecma_typedarray_type_t) */
+  uint32_t byte_offset; /**< offset of the view in the ArrayBuffer */
+  uint32_t length; /**< number of elements (byte length of a DataView) */
+  uint8_t *buffer_p; /**< first byte of the view (data blocks of ArrayBuffers are never moved) */
+} ecma_typedarray_t;
+
 /**
  * Compiled byte code data.
   */
@@ -18,7 +18,6 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
-#include "ecma-lcache.h"
 #include "jrt.h"
 #include "jrt-libc-includes.h"
 #include "lit-char-helpers.h"
@@ -182,7 +181,7 @@ ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *string_p, /**< utf-8 stri
   string_desc_p->u.common_field = 0;
 
   const size_t data_size = string_size + sizeof (ecma_string_heap_header_t);
-  ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+  ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) ecma_alloc_string_buffer (data_size);
   data_p->size = (uint16_t) string_size;
   data_p->length = (uint16_t) lit_utf8_string_length (string_p, string_size);
   memcpy (data_p + 1, string_p, string_size);
@@ -206,14 +205,16 @@ ecma_new_ecma_string_from_code_unit (ecma_char_t code_unit) /**< code unit */
 } /* ecma_new_ecma_string_from_code_unit */
 
 /**
- * Allocate new ecma-string and fill it with ecma-number
+ * Initialize an ecma-string descriptor with ecma-number
  *
- * @return pointer to ecma-string descriptor
+ * Note:
+ *      the descriptor can be allocated on the stack (it is not freed by ecma_deref_ecma_string),
+ *      if it is only used for looking up properties, so it is never referenced by an object
  */
-ecma_string_t *
-ecma_new_ecma_string_from_uint32 (uint32_t uint32_number) /**< UInt32-represented ecma-number */
+void
+ecma_init_ecma_string_from_uint32 (ecma_string_t *string_desc_p, /**< ecma-string descriptor */
+                                   uint32_t uint32_number) /**< UInt32-represented ecma-number */
 {
-  ecma_string_t *string_desc_p = ecma_alloc_string ();
   string_desc_p->refs_and_container = ECMA_STRING_CONTAINER_UINT32_IN_DESC | ECMA_STRING_REF_ONE;
 
   lit_utf8_byte_t byte_buf[ECMA_MAX_CHARS_IN_STRINGIFIED_UINT32];
@@ -225,6 +226,19 @@ ecma_new_ecma_string_from_uint32 (uint32_t uint32_number) /**< UInt32-represente
 
   string_desc_p->u.common_field = 0;
   string_desc_p->u.uint32_number = uint32_number;
+} /* ecma_init_ecma_string_from_uint32 */
+
+/**
+ * Allocate new ecma-string and fill it with ecma-number
+ *
+ * @return pointer to ecma-string descriptor
+ */
+ecma_string_t *
+ecma_new_ecma_string_from_uint32 (uint32_t uint32_number) /**< UInt32-represented ecma-number */
+{
+  ecma_string_t *string_desc_p = ecma_alloc_string ();
+
+  ecma_init_ecma_string_from_uint32 (string_desc_p, uint32_number);
 
   return string_desc_p;
 } /* ecma_new_ecma_string_from_uint32 */
@@ -349,7 +363,7 @@ ecma_concat_ecma_strings (ecma_string_t *string1_p, /**< first ecma-string */
   string_desc_p->u.common_field = 0;
 
   const size_t data_size = new_size + sizeof (ecma_string_heap_header_t);
-  ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+  ecma_string_heap_header_t *data_p = (ecma_string_heap_header_t *) ecma_alloc_string_buffer (data_size);
 
   lit_utf8_size_t bytes_copied = ecma_string_to_utf8_string (string1_p,
                                                              (lit_utf8_byte_t *) (data_p + 1),
@@ -419,7 +433,7 @@ ecma_copy_ecma_string (ecma_string_t *string_desc_p) /**< string descriptor */
                                                                            string_desc_p->u.collection_cp);
       JERRY_ASSERT (data_p != NULL);
       const size_t data_size = data_p->size + sizeof (ecma_string_heap_header_t);
-      ecma_string_heap_header_t *new_data_p = (ecma_string_heap_header_t *) mem_heap_alloc_block (data_size);
+      ecma_string_heap_header_t *new_data_p = (ecma_string_heap_header_t *) ecma_alloc_string_buffer (data_size);
       memcpy (new_data_p, data_p, data_p->size + sizeof (ecma_string_heap_header_t));
 
       ECMA_SET_NON_NULL_POINTER (new_str_p->u.collection_cp, data_p);
@@ -453,7 +467,6 @@ ecma_copy_or_ref_ecma_string (ecma_string_t *string_p) /**< string descriptor */
   if (unlikely (string_p->refs_and_container >= ECMA_STRING_MAX_REF))
   {
     /* First trying to free unreachable objects that maybe refer to the string */
-    ecma_lcache_invalidate_all ();
     ecma_gc_run ();
 
     if (string_p->refs_and_container >= ECMA_STRING_MAX_REF)
@@ -493,7 +506,7 @@ ecma_deref_ecma_string (ecma_string_t *string_p) /**< ecma-string */
       ecma_string_heap_header_t *const data_p = ECMA_GET_NON_NULL_POINTER (ecma_string_heap_header_t,
                                                                            string_p->u.collection_cp);
 
-      mem_heap_free_block (data_p, data_p->size + sizeof (ecma_string_heap_header_t));
+      ecma_dealloc_string_buffer (data_p, data_p->size + sizeof (ecma_string_heap_header_t));
 
       break;
     }
@@ -586,6 +599,18 @@ ecma_string_get_array_index (const ecma_string_t *str_p, /**< ecma-string */
   }
   else
   {
+    lit_utf8_size_t size;
+    bool is_ascii;
+    const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (str_p, &size, &is_ascii);
+
+    /* Array indices start with a decimal digit, so most property names are rejected
+     * without converting them to number. */
+    if (chars_p != NULL
+        && (size == 0 || !lit_char_is_decimal_digit (chars_p[0])))
+    {
+      return false;
+    }
+
     ecma_number_t num = ecma_string_to_number (str_p);
     *out_index_p = ecma_number_to_uint32 (num);
 
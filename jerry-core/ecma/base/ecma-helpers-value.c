@@ -43,8 +43,11 @@ JERRY_STATIC_ASSERT ((ECMA_VALUE_FULL_MASK + 1) == (1 << ECMA_VALUE_SHIFT),
 JERRY_STATIC_ASSERT (ECMA_VALUE_SHIFT <= MEM_ALIGNMENT_LOG,
                      ecma_value_shift_must_be_less_than_or_equal_than_mem_alignment_log);
 
+JERRY_STATIC_ASSERT (ECMA_SIMPLE_VALUE__COUNT <= (1 << (31 - ECMA_DIRECT_SHIFT)),
+                     simple_values_must_fit_in_the_value_part_of_direct_values);
+
 JERRY_STATIC_ASSERT ((sizeof (ecma_value_t) * JERRY_BITSINBYTE)
-                     >= (sizeof (mem_cpointer_t) * JERRY_BITSINBYTE + ECMA_VALUE_SHIFT),
+                     >= (MEM_CP_WIDTH + ECMA_VALUE_SHIFT),
                      ecma_value_must_be_large_enough_to_store_compressed_pointers);
 
 #ifdef ECMA_VALUE_CAN_STORE_UINTPTR_VALUE_DIRECTLY
@@ -215,9 +218,36 @@ ecma_is_value_array_hole (ecma_value_t value) /**< ecma value */
 inline bool __attr_pure___ __attr_always_inline___
 ecma_is_value_number (ecma_value_t value) /**< ecma value */
 {
-  return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
+  return (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER
+          || ecma_is_value_integer_number (value));
 } /* ecma_is_value_number */
 
+/**
+ * Check if the value is a small integer stored directly in the value.
+ *
+ * @return true - if the value contains a small integer,
+ *         false - otherwise.
+ */
+inline bool __attr_pure___ __attr_always_inline___
+ecma_is_value_integer_number (ecma_value_t value) /**< ecma value */
+{
+  return ((value & (ECMA_VALUE_TYPE_MASK | ECMA_VALUE_INTEGER_FLAG))
+          == (ECMA_TYPE_SIMPLE | ECMA_VALUE_INTEGER_FLAG));
+} /* ecma_is_value_integer_number */
+
+/**
+ * Check if both values are small integers stored directly in the values.
+ *
+ * @return true - if both values contain small integers,
+ *         false - otherwise.
+ */
+inline bool __attr_pure___ __attr_always_inline___
+ecma_are_values_integer_numbers (ecma_value_t first_value, /**< first ecma value */
+                                 ecma_value_t second_value) /**< second ecma value */
+{
+  return ecma_is_value_integer_number (first_value) && ecma_is_value_integer_number (second_value);
+} /* ecma_are_values_integer_numbers */
+
 /**
  * Check if the value is ecma-string.
  *
@@ -275,11 +305,86 @@ ecma_check_value_type_is_spec_defined (ecma_value_t value) /**< ecma value */
 inline ecma_value_t __attr_const___ __attr_always_inline___
 ecma_make_simple_value (const ecma_simple_value_t simple_value) /**< simple value */
 {
-  return (((ecma_value_t) (simple_value)) << ECMA_VALUE_SHIFT) | ECMA_TYPE_SIMPLE;
+  return (((ecma_value_t) (simple_value)) << ECMA_DIRECT_SHIFT) | ECMA_TYPE_SIMPLE;
 } /* ecma_make_simple_value */
 
 /**
- * Number value constructor
+ * Small integer value constructor
+ *
+ * @return ecma value which stores the integer directly
+ */
+inline ecma_value_t __attr_const___ __attr_always_inline___
+ecma_make_integer_value (ecma_integer_value_t integer_value) /**< integer value */
+{
+  JERRY_ASSERT (ECMA_IS_INTEGER_NUMBER (integer_value));
+
+  return (((ecma_value_t) integer_value) << ECMA_DIRECT_SHIFT) | ECMA_VALUE_INTEGER_FLAG | ECMA_TYPE_SIMPLE;
+} /* ecma_make_integer_value */
+
+/**
+ * Number value constructor which stores the number directly in the value
+ * if it is a small integer and allocates a heap number otherwise.
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_normalized_number_value (ecma_number_t number) /**< number */
+{
+  if (number >= ECMA_INTEGER_NUMBER_MIN && number <= ECMA_INTEGER_NUMBER_MAX)
+  {
+    ecma_integer_value_t integer_value = (ecma_integer_value_t) number;
+
+    /* Negative zero is not an integer, but it is equal to zero. */
+    if ((ecma_number_t) integer_value == number
+        && (integer_value != 0 || !ecma_number_is_negative (number)))
+    {
+      return ecma_make_integer_value (integer_value);
+    }
+  }
+
+  ecma_number_t *number_p = ecma_alloc_number ();
+  *number_p = number;
+  return ecma_make_number_value (number_p);
+} /* ecma_make_normalized_number_value */
+
+/**
+ * Number value constructor for 32 bit signed integers
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_int32_value (int32_t int32_number) /**< int32 number */
+{
+  if (ECMA_IS_INTEGER_NUMBER (int32_number))
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) int32_number);
+  }
+
+  ecma_number_t *number_p = ecma_alloc_number ();
+  *number_p = (ecma_number_t) int32_number;
+  return ecma_make_number_value (number_p);
+} /* ecma_make_int32_value */
+
+/**
+ * Number value constructor for 32 bit unsigned integers
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_make_uint32_value (uint32_t uint32_number) /**< uint32 number */
+{
+  if (uint32_number <= ECMA_INTEGER_NUMBER_MAX)
+  {
+    return ecma_make_integer_value ((ecma_integer_value_t) uint32_number);
+  }
+
+  ecma_number_t *number_p = ecma_alloc_number ();
+  *number_p = (ecma_number_t) uint32_number;
+  return ecma_make_number_value (number_p);
+} /* ecma_make_uint32_value */
+
+/**
+ * Number value constructor which references a heap number.
  */
 ecma_value_t __attr_const___
 ecma_make_number_value (const ecma_number_t *ecma_num_p) /**< number to reference in value */
@@ -333,16 +438,45 @@ ecma_make_error_obj_value (const ecma_object_t *object_p) /**< object to referen
 } /* ecma_make_error_obj_value */
 
 /**
- * Get pointer to ecma-number from ecma value
+ * Get the small integer stored in an ecma value
+ *
+ * @return integer value
+ */
+inline ecma_integer_value_t __attr_const___ __attr_always_inline___
+ecma_get_integer_from_value (ecma_value_t value) /**< ecma value */
+{
+  JERRY_ASSERT (ecma_is_value_integer_number (value));
+
+  return ((ecma_integer_value_t) value) >> ECMA_DIRECT_SHIFT;
+} /* ecma_get_integer_from_value */
+
+/**
+ * Get pointer to the heap allocated ecma-number referenced by an ecma value
  *
  * @return the pointer
  */
 ecma_number_t *__attr_pure___
-ecma_get_number_from_value (ecma_value_t value) /**< ecma value */
+ecma_get_float_from_value (ecma_value_t value) /**< ecma value */
 {
   JERRY_ASSERT (ecma_get_value_type_field (value) == ECMA_TYPE_NUMBER);
 
   return (ecma_number_t *) ecma_get_pointer_from_ecma_value (value);
+} /* ecma_get_float_from_value */
+
+/**
+ * Get the number stored in an ecma value (either a small integer or a heap number)
+ *
+ * @return number value
+ */
+ecma_number_t __attr_pure___
+ecma_get_number_from_value (ecma_value_t value) /**< ecma value */
+{
+  if (ecma_is_value_integer_number (value))
+  {
+    return (ecma_number_t) ecma_get_integer_from_value (value);
+  }
+
+  return *ecma_get_float_from_value (value);
 } /* ecma_get_number_from_value */
 
 /**
@@ -404,12 +538,7 @@ ecma_copy_value (ecma_value_t value)  /**< value description */
     }
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *num_p = ecma_get_number_from_value (value);
-
-      ecma_number_t *number_copy_p = ecma_alloc_number ();
-      *number_copy_p = *num_p;
-
-      return ecma_make_number_value (number_copy_p);
+      return ecma_make_normalized_number_value (ecma_get_number_from_value (value));
     }
     case ECMA_TYPE_STRING:
     {
@@ -451,14 +580,13 @@ ecma_free_value (ecma_value_t value) /**< value description */
   {
     case ECMA_TYPE_SIMPLE:
     {
-      /* doesn't hold additional memory */
+      /* doesn't hold additional memory (small integers are stored directly as well) */
       break;
     }
 
     case ECMA_TYPE_NUMBER:
     {
-      ecma_number_t *number_p = ecma_get_number_from_value (value);
-      ecma_dealloc_number (number_p);
+      ecma_dealloc_number (ecma_get_float_from_value (value));
       break;
     }
 
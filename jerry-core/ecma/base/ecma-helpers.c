@@ -19,10 +19,15 @@
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
+#include "ecma-property-hashmap.h"
+#include "ecma-shape.h"
 #include "jrt-bit-fields.h"
 #include "byte-code.h"
 #include "re-compiler.h"
 
+#define JERRY_INTERNAL
+#include "jerry-internal.h"
+
 /** \addtogroup ecma ECMA
  * @{
  *
@@ -107,6 +112,11 @@ ecma_create_object (ecma_object_t *prototype_object_p, /**< pointer to prototybe
 
   new_object_p->property_list_or_bound_object_cp = MEM_CP_NULL;
 
+  if (prototype_object_p != NULL)
+  {
+    ecma_gc_write_barrier (new_object_p, prototype_object_p);
+  }
+
   ECMA_SET_POINTER (new_object_p->prototype_or_outer_reference_cp,
                     prototype_object_p);
 
@@ -135,6 +145,11 @@ ecma_create_decl_lex_env (ecma_object_t *outer_lexical_environment_p) /**< outer
 
   new_lexical_environment_p->property_list_or_bound_object_cp = MEM_CP_NULL;
 
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
   ECMA_SET_POINTER (new_lexical_environment_p->prototype_or_outer_reference_cp,
                     outer_lexical_environment_p);
 
@@ -176,9 +191,16 @@ ecma_create_object_lex_env (ecma_object_t *outer_lexical_environment_p, /**< out
 
   ecma_init_gc_info (new_lexical_environment_p);
 
+  ecma_gc_write_barrier (new_lexical_environment_p, binding_obj_p);
+
   ECMA_SET_NON_NULL_POINTER (new_lexical_environment_p->property_list_or_bound_object_cp,
                              binding_obj_p);
 
+  if (outer_lexical_environment_p != NULL)
+  {
+    ecma_gc_write_barrier (new_lexical_environment_p, outer_lexical_environment_p);
+  }
+
   ECMA_SET_POINTER (new_lexical_environment_p->prototype_or_outer_reference_cp,
                     outer_lexical_environment_p);
 
@@ -383,24 +405,282 @@ ecma_get_lex_env_binding_object (const ecma_object_t *object_p) /**< object-boun
                                     object_p->property_list_or_bound_object_cp);
 } /* ecma_get_lex_env_binding_object */
 
+/**
+ * Check whether the properties of an object can be laid out according to a shape.
+ *
+ * Note:
+ *      objects with special internal methods (arrays, functions, etc.), built-in
+ *      objects and lexical environments always store their properties in property pairs.
+ *
+ * @return true - if the object is an ordinary object,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_object_can_have_shape (const ecma_object_t *object_p) /**< object or lexical environment */
+{
+  return (!ecma_is_lexical_environment (object_p)
+          && !ecma_get_object_is_builtin (object_p)
+          && ecma_get_object_type (object_p) == ECMA_OBJECT_TYPE_GENERAL);
+} /* ecma_object_can_have_shape */
+
+/**
+ * Convert the slot array of an object to a property pair list.
+ *
+ * The properties keep their values, attributes and order, but the object loses its shape.
+ */
+static void
+ecma_convert_property_slots_to_pairs (ecma_object_t *object_p, /**< object */
+                                      ecma_property_slots_t *slots_p) /**< slot array of the object */
+{
+  JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+  /* The new list is built in a detached state, since allocations might trigger garbage collection,
+   * which must see the properties in the slot array until the conversion is finished. */
+  ecma_property_header_t *first_property_p = NULL;
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+  for (uint32_t i = 0; i < shape_p->property_count; i++)
+  {
+    ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i);
+
+    if (property_p->type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      continue;
+    }
+
+    ecma_string_t *name_p = ecma_shape_get_property_name (shape_p, i);
+
+    if (name_p != NULL)
+    {
+      name_p = ecma_copy_or_ref_ecma_string (name_p);
+    }
+
+    ecma_property_pair_t *property_pair_p;
+    uint32_t index;
+
+    /* Properties are linked into the list the same way as in ecma_create_property. */
+    if (first_property_p != NULL
+        && first_property_p->types[0].type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      property_pair_p = (ecma_property_pair_t *) first_property_p;
+      index = 0;
+    }
+    else
+    {
+      property_pair_p = ecma_alloc_property_pair ();
+
+      ECMA_SET_POINTER (property_pair_p->header.next_property_cp, first_property_p);
+      property_pair_p->header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+      property_pair_p->names_cp[0] = ECMA_NULL_POINTER;
+
+      first_property_p = &property_pair_p->header;
+      index = 1;
+    }
+
+    property_pair_p->header.types[index].type_and_flags = property_p->type_and_flags;
+    property_pair_p->values[index] = *ECMA_PROPERTY_VALUE_PTR (property_p);
+    ECMA_SET_POINTER (property_pair_p->names_cp[index], name_p);
+  }
+
+  ecma_set_property_list (object_p, first_property_p);
+
+  ecma_dealloc_property_slots (slots_p, ECMA_PROPERTY_SLOTS_SIZE (slots_p->capacity));
+  ecma_shape_deref (shape_p);
+} /* ecma_convert_property_slots_to_pairs */
+
+/**
+ * Get the capacity of a grown slot array.
+ *
+ * The slot array is grown to the capacity, which fills the next power of two block size,
+ * so small slot arrays exactly fit pool chunks.
+ *
+ * @return new capacity
+ */
+static uint32_t
+ecma_get_property_slots_next_capacity (uint32_t capacity) /**< current capacity */
+{
+  JERRY_ASSERT (capacity < CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT);
+
+  size_t block_size = MEM_POOL_CHUNK_SIZE;
+
+  while (block_size < ECMA_PROPERTY_SLOTS_SIZE (capacity + 1))
+  {
+    block_size <<= 1;
+  }
+
+  uint32_t new_capacity = capacity + 1;
+
+  while (new_capacity < CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT
+         && ECMA_PROPERTY_SLOTS_SIZE (new_capacity + 1) <= block_size)
+  {
+    new_capacity++;
+  }
+
+  return new_capacity;
+} /* ecma_get_property_slots_next_capacity */
+
+/**
+ * Create a property in the slot array of an object, and transition the object to the next shape.
+ *
+ * @return pointer to newly created property, if the object kept its shape,
+ *         NULL - if the object's properties were converted to a property pair list
+ *                (the property must be created in the list)
+ */
+static ecma_property_t *
+ecma_create_property_in_slots (ecma_object_t *object_p, /**< the object */
+                               ecma_property_slots_t *slots_p, /**< slot array of the object, or NULL
+                                                                *   (if the object has no properties) */
+                               ecma_string_t *name_p, /**< property name */
+                               uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                               uint32_t expected_property_count) /**< expected number of properties of the object,
+                                                                  *   or 0 (if unknown) */
+{
+  ecma_shape_t *shape_p = NULL;
+  uint32_t capacity = 0;
+
+  if (slots_p != NULL)
+  {
+    shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+    capacity = slots_p->capacity;
+
+    /* Named properties are never deleted from slot arrays (see also: ecma_delete_property). */
+    JERRY_ASSERT (name_p == NULL
+                  || ecma_shape_find_property (shape_p, name_p) == ECMA_SHAPE_PROPERTY_NOT_FOUND);
+  }
+
+  ecma_shape_t *new_shape_p = ecma_shape_get_transition (shape_p, name_p);
+
+  if (new_shape_p == NULL)
+  {
+    if (slots_p != NULL)
+    {
+      ecma_convert_property_slots_to_pairs (object_p, slots_p);
+    }
+    return NULL;
+  }
+
+  uint32_t index = (uint32_t) new_shape_p->property_count - 1;
+
+  if (index >= capacity)
+  {
+    uint32_t new_capacity;
+
+    if (expected_property_count > index + 1)
+    {
+      /* Room is reserved for all expected properties at once. */
+      expected_property_count = JERRY_MIN (expected_property_count, CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT);
+      new_capacity = ecma_get_property_slots_next_capacity (expected_property_count - 1);
+    }
+    else
+    {
+      new_capacity = ecma_get_property_slots_next_capacity (capacity);
+    }
+
+    ecma_property_slots_t *new_slots_p = ecma_alloc_property_slots (ECMA_PROPERTY_SLOTS_SIZE (new_capacity));
+
+    new_slots_p->type.type_and_flags = ECMA_PROPERTY_TYPE_SLOTS;
+    new_slots_p->capacity = (uint8_t) new_capacity;
+
+    if (slots_p != NULL)
+    {
+      /* Properties in slot arrays are not registered in the LCache (see also: ecma_find_named_property),
+       * so they can be moved. */
+      memcpy (ECMA_PROPERTY_SLOTS_GET_GROUPS (new_slots_p),
+              ECMA_PROPERTY_SLOTS_GET_GROUPS (slots_p),
+              ECMA_PROPERTY_SLOTS_SIZE (capacity) - sizeof (ecma_property_slots_t));
+
+      new_slots_p->shape_cp = slots_p->shape_cp;
+
+      ecma_dealloc_property_slots (slots_p, ECMA_PROPERTY_SLOTS_SIZE (capacity));
+    }
+
+    for (uint32_t i = capacity; i < new_capacity; i++)
+    {
+      ECMA_PROPERTY_SLOTS_GET_PROPERTY (new_slots_p, i)->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+    }
+
+    slots_p = new_slots_p;
+  }
+
+  ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, index);
+  property_p->type_and_flags = type_and_flags;
+
+  ECMA_SET_NON_NULL_POINTER (slots_p->shape_cp, new_shape_p);
+  ecma_set_property_list (object_p, (ecma_property_header_t *) slots_p);
+
+  if (shape_p != NULL)
+  {
+    ecma_shape_deref (shape_p);
+  }
+
+  /* The shape holds its own reference to the name. */
+  if (name_p != NULL)
+  {
+    ecma_deref_ecma_string (name_p);
+  }
+
+  return property_p;
+} /* ecma_create_property_in_slots */
+
 /**
  * Create a property in an object and link it into
  * the object's properties' linked-list (at start of the list).
  *
+ * Note:
+ *      the reference to the name is taken over by the object
+ *
  * @return pointer to newly created property
  */
 static ecma_property_t *
 ecma_create_property (ecma_object_t *object_p, /**< the object */
                       ecma_string_t *name_p, /**< property name */
-                      uint8_t type_and_flags) /**< type and flags, see ecma_property_info_t */
+                      uint8_t type_and_flags, /**< type and flags, see ecma_property_info_t */
+                      uint32_t expected_property_count) /**< expected number of properties of the object,
+                                                         *   or 0 (if unknown) */
 {
   JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
 
-  if (object_p->property_list_or_bound_object_cp != ECMA_NULL_POINTER)
+  if (object_p->property_list_or_bound_object_cp == ECMA_NULL_POINTER
+      ? ecma_object_can_have_shape (object_p)
+      : ECMA_PROPERTY_IS_SLOTS (ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                           object_p->property_list_or_bound_object_cp)))
+  {
+    ecma_property_slots_t *slots_p = ECMA_GET_POINTER (ecma_property_slots_t,
+                                                       object_p->property_list_or_bound_object_cp);
+
+    ecma_property_t *property_p = ecma_create_property_in_slots (object_p,
+                                                                 slots_p,
+                                                                 name_p,
+                                                                 type_and_flags,
+                                                                 expected_property_count);
+
+    if (property_p != NULL)
+    {
+      return property_p;
+    }
+  }
+
+  /* The property pairs follow the hash map, if the object has one. */
+  mem_cpointer_t *first_property_cp_p = &object_p->property_list_or_bound_object_cp;
+  bool has_hashmap = false;
+
+  if (*first_property_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
+                                                                          *first_property_cp_p);
+
+    if (ECMA_PROPERTY_IS_HASHMAP (first_property_p))
+    {
+      first_property_cp_p = &first_property_p->next_property_cp;
+      has_hashmap = true;
+    }
+  }
+
+  if (*first_property_cp_p != ECMA_NULL_POINTER)
   {
     /* If the first entry is free (deleted), we simply use its value. */
     ecma_property_header_t *first_property_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t,
-                                                                          object_p->property_list_or_bound_object_cp);
+                                                                          *first_property_cp_p);
 
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (first_property_p));
 
@@ -415,6 +695,11 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
 
       JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == first_property_pair_p->values + 0);
 
+      if (has_hashmap && name_p != NULL)
+      {
+        ecma_property_hashmap_insert (object_p, name_p, first_property_pair_p, 0);
+      }
+
       return property_p;
     }
   }
@@ -423,18 +708,23 @@ ecma_create_property (ecma_object_t *object_p, /**< the object */
   ecma_property_pair_t *first_property_pair_p = ecma_alloc_property_pair ();
 
   /* Just copy the previous value (no need to decompress, compress). */
-  first_property_pair_p->header.next_property_cp = object_p->property_list_or_bound_object_cp;
+  first_property_pair_p->header.next_property_cp = *first_property_cp_p;
   first_property_pair_p->header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
   first_property_pair_p->header.types[1].type_and_flags = type_and_flags;
   first_property_pair_p->names_cp[0] = ECMA_NULL_POINTER;
   ECMA_SET_POINTER (first_property_pair_p->names_cp[1], name_p);
 
-  ecma_set_property_list (object_p, &first_property_pair_p->header);
+  ECMA_SET_NON_NULL_POINTER (*first_property_cp_p, first_property_pair_p);
 
   ecma_property_t *property_p = first_property_pair_p->header.types + 1;
 
   JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (property_p) == first_property_pair_p->values + 1);
 
+  if (has_hashmap && name_p != NULL)
+  {
+    ecma_property_hashmap_insert (object_p, name_p, first_property_pair_p, 1);
+  }
+
   return property_p;
 } /* ecma_create_property */
 
@@ -453,7 +743,7 @@ ecma_create_internal_property (ecma_object_t *object_p, /**< the object */
   uint8_t id_byte = (uint8_t) (property_id << ECMA_PROPERTY_FLAG_SHIFT);
   uint8_t type_and_flags = (uint8_t) (ECMA_PROPERTY_TYPE_INTERNAL | id_byte);
 
-  ecma_property_t *property_p = ecma_create_property (object_p, NULL, type_and_flags);
+  ecma_property_t *property_p = ecma_create_property (object_p, NULL, type_and_flags, 0);
 
   ECMA_PROPERTY_VALUE_PTR (property_p)->value = ECMA_NULL_POINTER;
 
@@ -477,6 +767,31 @@ ecma_find_internal_property (ecma_object_t *object_p, /**< object descriptor */
 
   ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+  {
+    ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+    for (uint32_t i = 0; i < shape_p->property_count; i++)
+    {
+      ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i);
+
+      if (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_INTERNAL
+          && ECMA_PROPERTY_GET_INTERNAL_PROPERTY_TYPE (property_p) == property_id)
+      {
+        return property_p;
+      }
+    }
+
+    return NULL;
+  }
+
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -519,6 +834,32 @@ ecma_get_internal_property (ecma_object_t *object_p, /**< object descriptor */
   return property_p;
 } /* ecma_get_internal_property */
 
+/**
+ * Get the fast element storage of an array.
+ *
+ * @return pointer to the element storage, if the object is an array with fast elements,
+ *         NULL - otherwise.
+ */
+ecma_array_elements_t *
+ecma_get_array_elements (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  if (ecma_is_lexical_environment (object_p)
+      || ecma_get_object_type (object_p) != ECMA_OBJECT_TYPE_ARRAY)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *property_p = ecma_find_internal_property (object_p,
+                                                             ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES);
+
+  if (property_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, ECMA_PROPERTY_VALUE_PTR (property_p)->value);
+} /* ecma_get_array_elements */
+
 /**
  * Create named data property with given name, attributes and undefined value
  * in the specified object.
@@ -549,16 +890,54 @@ ecma_create_named_data_property (ecma_object_t *object_p, /**< object */
     type_and_flags = (uint8_t) (type_and_flags | ECMA_PROPERTY_FLAG_WRITABLE);
   }
 
+  ecma_lcache_invalidate (object_p, name_p, NULL);
+
   name_p = ecma_copy_or_ref_ecma_string (name_p);
 
-  ecma_property_t *property_p = ecma_create_property (object_p, name_p, type_and_flags);
+  ecma_property_t *property_p = ecma_create_property (object_p, name_p, type_and_flags, 0);
+
+  ecma_set_named_data_property_value (object_p, property_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
 
-  ecma_set_named_data_property_value (property_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  return property_p;
+} /* ecma_create_named_data_property */
 
+/**
+ * Create a writable, enumerable and configurable named data property with undefined value
+ * in an object, which is constructed by an object literal.
+ *
+ * Note:
+ *      the object must not have a property with the same name, and the object must not be
+ *      accessible by the program yet, so the property has no cached lookup results
+ *
+ * @return pointer to newly created property
+ */
+ecma_property_t *
+ecma_create_object_literal_property (ecma_object_t *object_p, /**< object */
+                                     ecma_string_t *name_p, /**< property name */
+                                     uint32_t property_count) /**< number of properties of the object literal,
+                                                               *   or 0 (if unknown) */
+{
+  JERRY_ASSERT (object_p != NULL && name_p != NULL);
+  JERRY_ASSERT (ecma_find_named_property (object_p, name_p) == NULL);
+
+#ifndef JERRY_NDEBUG
+  /* The lookup of the assertion above may register the missing name in the LCache. */
   ecma_lcache_invalidate (object_p, name_p, NULL);
+#endif /* !JERRY_NDEBUG */
+
+  uint8_t type_and_flags = (uint8_t) (ECMA_PROPERTY_TYPE_NAMEDDATA
+                                      | ECMA_PROPERTY_FLAG_CONFIGURABLE
+                                      | ECMA_PROPERTY_FLAG_ENUMERABLE
+                                      | ECMA_PROPERTY_FLAG_WRITABLE);
+
+  name_p = ecma_copy_or_ref_ecma_string (name_p);
+
+  ecma_property_t *property_p = ecma_create_property (object_p, name_p, type_and_flags, property_count);
+
+  ecma_set_named_data_property_value (object_p, property_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
 
   return property_p;
-} /* ecma_create_named_data_property */
+} /* ecma_create_object_literal_property */
 
 /**
  * Create named accessor property with given name, attributes, getter and setter.
@@ -586,9 +965,16 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
     type_and_flags = (uint8_t) (type_and_flags | ECMA_PROPERTY_FLAG_ENUMERABLE);
   }
 
+  ecma_lcache_invalidate (object_p, name_p, NULL);
+
   name_p = ecma_copy_or_ref_ecma_string (name_p);
 
-  ecma_property_t *property_p = ecma_create_property (object_p, name_p, type_and_flags);
+  ecma_property_t *property_p = ecma_create_property (object_p, name_p, type_and_flags, 0);
+
+#ifdef CONFIG_MEM_LARGE_HEAP
+  ecma_getter_setter_pointers_t *getter_setter_pair_p = ecma_alloc_getter_setter_pointers ();
+  ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (property_p)->getter_setter_pair_cp, getter_setter_pair_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
   /*
    * Should be performed after linking the property into object's property list, because the setters assert that.
@@ -596,8 +982,6 @@ ecma_create_named_accessor_property (ecma_object_t *object_p, /**< object */
   ecma_set_named_accessor_property_getter (object_p, property_p, get_p);
   ecma_set_named_accessor_property_setter (object_p, property_p, set_p);
 
-  ecma_lcache_invalidate (object_p, name_p, NULL);
-
   return property_p;
 } /* ecma_create_named_accessor_property */
 
@@ -614,6 +998,31 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
   JERRY_ASSERT (obj_p != NULL);
   JERRY_ASSERT (name_p != NULL);
 
+  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+  {
+    /* Looking up the name in the shape is as fast as an LCache lookup,
+     * so properties of objects with shape are not registered in the LCache. */
+    ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+    uint32_t index = ecma_shape_find_property (shape_p, name_p);
+
+    if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+    {
+      return NULL;
+    }
+
+    ecma_property_t *property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, index);
+
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+                  || ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
+    JERRY_ASSERT (!ecma_is_property_lcached (property_p));
+
+    return property_p;
+  }
+
   ecma_property_t *property_p;
 
   if (ecma_lcache_lookup (obj_p, name_p, &property_p))
@@ -621,14 +1030,25 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
     return property_p;
   }
 
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+  {
+    property_p = ecma_property_hashmap_find ((ecma_property_hashmap_t *) prop_iter_p, name_p);
+
+    ecma_lcache_insert (obj_p, name_p, property_p);
+
+    return property_p;
+  }
+
   property_p = NULL;
 
-  ecma_property_header_t *prop_iter_p = ecma_get_property_list (obj_p);
+  uint32_t steps = 0;
 
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
 
+    steps++;
+
     ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
 
     JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
@@ -661,6 +1081,12 @@ ecma_find_named_property (ecma_object_t *obj_p, /**< object to find property in
                                     prop_iter_p->next_property_cp);
   }
 
+  /* Long property lists (e.g. of objects, which are used as dictionaries) are indexed by a hash map. */
+  if (steps * ECMA_PROPERTY_PAIR_ITEM_COUNT >= CONFIG_ECMA_PROPERTY_HASHMAP_MIN_PROPERTY_COUNT)
+  {
+    ecma_property_hashmap_create (obj_p);
+  }
+
   ecma_lcache_insert (obj_p, name_p, property_p);
 
   return property_p;
@@ -712,6 +1138,21 @@ ecma_get_named_data_property (ecma_object_t *obj_p, /**< object to find property
   return property_p;
 } /* ecma_get_named_data_property */
 
+/**
+ * Check whether the property is a slot of an array's fast element storage.
+ *
+ * @return true - if the property is stored in the element storage,
+ *         false - otherwise.
+ */
+static bool
+ecma_is_property_in_array_elements (const ecma_array_elements_t *elements_p, /**< element storage of an array */
+                                    const ecma_property_t *property_p) /**< property */
+{
+  return (elements_p->capacity > 0
+          && property_p >= ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, 0)
+          && property_p <= ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, elements_p->capacity - 1));
+} /* ecma_is_property_in_array_elements */
+
 /**
  * Free the named data property and values it references.
  */
@@ -738,7 +1179,26 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
 
   switch (ECMA_PROPERTY_GET_INTERNAL_PROPERTY_TYPE (property_p))
   {
-    case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* a collection */
+    case ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES: /* compressed pointer to a ecma_array_elements_t */
+    {
+      ecma_array_elements_t *elements_p = ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t,
+                                                                      property_value);
+
+      for (uint32_t i = 0; i < elements_p->capacity; i++)
+      {
+        ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, i);
+
+        if (ECMA_PROPERTY_GET_TYPE (element_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+        {
+          ecma_free_value_if_not_object (ecma_get_named_data_property_value (element_p));
+        }
+      }
+
+      ecma_dealloc_array_elements (elements_p, ECMA_ARRAY_ELEMENTS_SIZE (elements_p->capacity));
+
+      break;
+    }
+
     case ECMA_INTERNAL_PROPERTY_STRING_INDEXED_ARRAY_VALUES: /* a collection */
     {
       ecma_free_values_collection (ECMA_GET_NON_NULL_POINTER (ecma_collection_header_t,
@@ -831,6 +1291,36 @@ ecma_free_internal_property (ecma_property_t *property_p) /**< the property */
       }
       break;
     }
+
+    case ECMA_INTERNAL_PROPERTY_ARRAYBUFFER: /* compressed pointer to a ecma_arraybuffer_t */
+    {
+      ecma_arraybuffer_t *arraybuffer_p = ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, property_value);
+      size_t size = sizeof (ecma_arraybuffer_t);
+
+      if (arraybuffer_p->buffer_p == (uint8_t *) (arraybuffer_p + 1))
+      {
+        /* The bytes are stored after the header. */
+        size += arraybuffer_p->length;
+      }
+      else if (arraybuffer_p->free_cb != 0)
+      {
+        /* The external data block is owned by the host. */
+        jerry_dispatch_object_free_callback (arraybuffer_p->free_cb,
+                                             (ecma_external_pointer_t) arraybuffer_p->buffer_p);
+      }
+
+      ecma_dealloc_arraybuffer (arraybuffer_p, size);
+      break;
+    }
+
+    case ECMA_INTERNAL_PROPERTY_TYPEDARRAY: /* compressed pointer to a ecma_typedarray_t */
+    {
+      ecma_typedarray_t *typedarray_p = ECMA_GET_NON_NULL_POINTER (ecma_typedarray_t, property_value);
+
+      ecma_free_value (typedarray_p->element_value.value);
+      ecma_dealloc_typedarray (typedarray_p);
+      break;
+    }
   }
 } /* ecma_free_internal_property */
 
@@ -855,6 +1345,13 @@ ecma_free_property (ecma_object_t *object_p, /**< object the property belongs to
     case ECMA_PROPERTY_TYPE_NAMEDACCESSOR:
     {
       ecma_lcache_invalidate (object_p, name_p, property_p);
+
+#ifdef CONFIG_MEM_LARGE_HEAP
+      ecma_getter_setter_pointers_t *getter_setter_pair_p;
+      getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                        ECMA_PROPERTY_VALUE_PTR (property_p)->getter_setter_pair_cp);
+      ecma_dealloc_getter_setter_pointers (getter_setter_pair_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
       break;
     }
     case ECMA_PROPERTY_TYPE_INTERNAL:
@@ -882,9 +1379,72 @@ void
 ecma_delete_property (ecma_object_t *object_p, /**< object */
                       ecma_property_t *prop_p) /**< property */
 {
+  ecma_array_elements_t *elements_p = ecma_get_array_elements (object_p);
+
+  if (elements_p != NULL && ecma_is_property_in_array_elements (elements_p, prop_p))
+  {
+    /* Elements are not registered in the LCache, and the deleted element becomes a hole. */
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+    ecma_free_value_if_not_object (ecma_get_named_data_property_value (prop_p));
+    prop_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+    elements_p->count--;
+    return;
+  }
+
   ecma_property_header_t *cur_prop_p = ecma_get_property_list (object_p);
   ecma_property_header_t *prev_prop_p = NULL;
 
+  if (ECMA_PROPERTY_IS_SLOTS (cur_prop_p))
+  {
+    ecma_property_slots_t *slots_p = (ecma_property_slots_t *) cur_prop_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+    for (uint32_t i = 0; i < shape_p->property_count; i++)
+    {
+      if (ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i) == prop_p)
+      {
+        ecma_string_t *name_p = ecma_shape_get_property_name (shape_p, i);
+
+        ecma_free_property (object_p, name_p, prop_p);
+
+        if (name_p != NULL)
+        {
+          /* Objects, whose named properties are deleted, are likely used as dictionaries,
+           * so they lose their shape (the deleted slot is dropped by the conversion). */
+          ecma_convert_property_slots_to_pairs (object_p, slots_p);
+        }
+        return;
+      }
+    }
+
+    JERRY_UNREACHABLE ();
+  }
+
+  if (ECMA_PROPERTY_IS_HASHMAP (cur_prop_p))
+  {
+    /* The property pair is computed from the property address, so the list is not searched. */
+    ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) ECMA_PROPERTY_VALUE_BASE_PTR (prop_p);
+    uint32_t index = (uint32_t) (prop_p - prop_pair_p->header.types);
+
+    JERRY_ASSERT (index < ECMA_PROPERTY_PAIR_ITEM_COUNT);
+
+    ecma_string_t *name_p = ECMA_GET_POINTER (ecma_string_t, prop_pair_p->names_cp[index]);
+
+    ecma_free_property (object_p, name_p, prop_p);
+
+    prop_pair_p->names_cp[index] = ECMA_NULL_POINTER;
+
+    if (name_p != NULL)
+    {
+      /* Property pairs, whose properties are all deleted, are kept in
+       * the list until the hash map is freed (see also: ecma_property_hashmap_free). */
+      ecma_property_hashmap_delete (object_p, name_p, prop_pair_p, index);
+      ecma_deref_ecma_string (name_p);
+    }
+    return;
+  }
+
   while (true)
   {
     JERRY_ASSERT (cur_prop_p != NULL);
@@ -947,6 +1507,28 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
 #ifndef JERRY_NDEBUG
   ecma_property_header_t *prop_iter_p = ecma_get_property_list (object_p);
 
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+  {
+    ecma_property_slots_t *slots_p = (ecma_property_slots_t *) prop_iter_p;
+    ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+
+    for (uint32_t i = 0; i < shape_p->property_count; i++)
+    {
+      if (ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, i) == prop_p)
+      {
+        return;
+      }
+    }
+
+    JERRY_UNREACHABLE ();
+  }
+
+  if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+  {
+    prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                    prop_iter_p->next_property_cp);
+  }
+
   while (prop_iter_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
@@ -965,6 +1547,13 @@ ecma_assert_object_contains_the_property (const ecma_object_t *object_p, /**< ec
                                     prop_iter_p->next_property_cp);
   }
 
+  ecma_array_elements_t *elements_p = ecma_get_array_elements ((ecma_object_t *) object_p);
+
+  if (elements_p != NULL && ecma_is_property_in_array_elements (elements_p, prop_p))
+  {
+    return;
+  }
+
   JERRY_UNREACHABLE ();
 
 #else /* JERRY_NDEBUG */
@@ -990,11 +1579,17 @@ ecma_get_named_data_property_value (const ecma_property_t *prop_p) /**< property
  * Set value field of named data property
  */
 inline void __attr_always_inline___
-ecma_set_named_data_property_value (ecma_property_t *prop_p, /**< property */
+ecma_set_named_data_property_value (ecma_object_t *obj_p, /**< the property's container */
+                                    ecma_property_t *prop_p, /**< property */
                                     ecma_value_t value) /**< value to set */
 {
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
 
+  if (ecma_is_value_object (value))
+  {
+    ecma_gc_write_barrier (obj_p, ecma_get_object_from_value (value));
+  }
+
   ECMA_PROPERTY_VALUE_PTR (prop_p)->value = value;
 } /* ecma_set_named_data_property_value */
 
@@ -1037,20 +1632,21 @@ ecma_named_data_property_assign_value (ecma_object_t *obj_p, /**< object */
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
   ecma_assert_object_contains_the_property (obj_p, prop_p);
 
+  ecma_value_t old_value = ecma_get_named_data_property_value (prop_p);
+
+  /* Heap numbers are updated in place, unless the new value is a small integer. */
   if (ecma_is_value_number (value)
-      && ecma_is_value_number (ecma_get_named_data_property_value (prop_p)))
+      && !ecma_is_value_integer_number (value)
+      && ecma_is_value_number (old_value)
+      && !ecma_is_value_integer_number (old_value))
   {
-    const ecma_number_t *num_src_p = ecma_get_number_from_value (value);
-    ecma_number_t *num_dst_p = ecma_get_number_from_value (ecma_get_named_data_property_value (prop_p));
-
-    *num_dst_p = *num_src_p;
+    *ecma_get_float_from_value (old_value) = *ecma_get_float_from_value (value);
   }
   else
   {
-    ecma_value_t v = ecma_get_named_data_property_value (prop_p);
-    ecma_free_value_if_not_object (v);
+    ecma_free_value_if_not_object (old_value);
 
-    ecma_set_named_data_property_value (prop_p, ecma_copy_value_if_not_object (value));
+    ecma_set_named_data_property_value (obj_p, prop_p, ecma_copy_value_if_not_object (value));
   }
 } /* ecma_named_data_property_assign_value */
 
@@ -1064,7 +1660,14 @@ ecma_get_named_accessor_property_getter (const ecma_property_t *prop_p) /**< nam
 {
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#ifdef CONFIG_MEM_LARGE_HEAP
+  ecma_getter_setter_pointers_t *getter_setter_pair_p;
+  getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                    ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair_cp);
+  return ECMA_GET_POINTER (ecma_object_t, getter_setter_pair_p->getter_p);
+#else /* !CONFIG_MEM_LARGE_HEAP */
   return ECMA_GET_POINTER (ecma_object_t, ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.getter_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } /* ecma_get_named_accessor_property_getter */
 
 /**
@@ -1077,7 +1680,14 @@ ecma_get_named_accessor_property_setter (const ecma_property_t *prop_p) /**< nam
 {
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
 
+#ifdef CONFIG_MEM_LARGE_HEAP
+  ecma_getter_setter_pointers_t *getter_setter_pair_p;
+  getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                    ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair_cp);
+  return ECMA_GET_POINTER (ecma_object_t, getter_setter_pair_p->setter_p);
+#else /* !CONFIG_MEM_LARGE_HEAP */
   return ECMA_GET_POINTER (ecma_object_t, ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.setter_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } /* ecma_get_named_accessor_property_setter */
 
 /**
@@ -1091,7 +1701,19 @@ ecma_set_named_accessor_property_getter (ecma_object_t *object_p, /**< the prope
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
   ecma_assert_object_contains_the_property (object_p, prop_p);
 
+  if (getter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, getter_p);
+  }
+
+#ifdef CONFIG_MEM_LARGE_HEAP
+  ecma_getter_setter_pointers_t *getter_setter_pair_p;
+  getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                    ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair_cp);
+  ECMA_SET_POINTER (getter_setter_pair_p->getter_p, getter_p);
+#else /* !CONFIG_MEM_LARGE_HEAP */
   ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.getter_p, getter_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } /* ecma_set_named_accessor_property_getter */
 
 /**
@@ -1105,7 +1727,19 @@ ecma_set_named_accessor_property_setter (ecma_object_t *object_p, /**< the prope
   JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR);
   ecma_assert_object_contains_the_property (object_p, prop_p);
 
+  if (setter_p != NULL)
+  {
+    ecma_gc_write_barrier (object_p, setter_p);
+  }
+
+#ifdef CONFIG_MEM_LARGE_HEAP
+  ecma_getter_setter_pointers_t *getter_setter_pair_p;
+  getter_setter_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_getter_setter_pointers_t,
+                                                    ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair_cp);
+  ECMA_SET_POINTER (getter_setter_pair_p->setter_p, setter_p);
+#else /* !CONFIG_MEM_LARGE_HEAP */
   ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (prop_p)->getter_setter_pair.setter_p, setter_p);
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } /* ecma_set_named_accessor_property_setter */
 
 /**
@@ -92,6 +92,8 @@ extern bool ecma_is_value_false (ecma_value_t);
 extern bool ecma_is_value_array_hole (ecma_value_t);
 
 extern bool ecma_is_value_number (ecma_value_t);
+extern bool ecma_is_value_integer_number (ecma_value_t);
+extern bool ecma_are_values_integer_numbers (ecma_value_t, ecma_value_t);
 extern bool ecma_is_value_string (ecma_value_t);
 extern bool ecma_is_value_object (ecma_value_t);
 extern bool ecma_is_value_error (ecma_value_t);
@@ -99,12 +101,18 @@ extern bool ecma_is_value_error (ecma_value_t);
 extern void ecma_check_value_type_is_spec_defined (ecma_value_t);
 
 extern ecma_value_t ecma_make_simple_value (const ecma_simple_value_t value);
+extern ecma_value_t ecma_make_integer_value (ecma_integer_value_t);
+extern ecma_value_t ecma_make_normalized_number_value (ecma_number_t);
+extern ecma_value_t ecma_make_int32_value (int32_t);
+extern ecma_value_t ecma_make_uint32_value (uint32_t);
 extern ecma_value_t ecma_make_number_value (const ecma_number_t *);
 extern ecma_value_t ecma_make_string_value (const ecma_string_t *);
 extern ecma_value_t ecma_make_object_value (const ecma_object_t *);
 extern ecma_value_t ecma_make_error_value (ecma_value_t);
 extern ecma_value_t ecma_make_error_obj_value (const ecma_object_t *);
-extern ecma_number_t *ecma_get_number_from_value (ecma_value_t) __attr_pure___;
+extern ecma_integer_value_t ecma_get_integer_from_value (ecma_value_t) __attr_const___;
+extern ecma_number_t *ecma_get_float_from_value (ecma_value_t) __attr_pure___;
+extern ecma_number_t ecma_get_number_from_value (ecma_value_t) __attr_pure___;
 extern ecma_string_t *ecma_get_string_from_value (ecma_value_t) __attr_pure___;
 extern ecma_object_t *ecma_get_object_from_value (ecma_value_t) __attr_pure___;
 extern ecma_value_t ecma_get_value_from_error_value (ecma_value_t) __attr_pure___;
@@ -116,6 +124,7 @@ extern void ecma_free_value_if_not_object (ecma_value_t);
 /* ecma-helpers-string.c */
 extern ecma_string_t *ecma_new_ecma_string_from_utf8 (const lit_utf8_byte_t *, lit_utf8_size_t);
 extern ecma_string_t *ecma_new_ecma_string_from_code_unit (ecma_char_t);
+extern void ecma_init_ecma_string_from_uint32 (ecma_string_t *, uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_uint32 (uint32_t);
 extern ecma_string_t *ecma_new_ecma_string_from_number (ecma_number_t);
 extern ecma_string_t *ecma_new_ecma_string_from_lit_cp (lit_cpointer_t);
@@ -218,10 +227,13 @@ extern bool ecma_get_lex_env_provide_this (const ecma_object_t *) __attr_pure___
 extern ecma_property_t *ecma_create_internal_property (ecma_object_t *, ecma_internal_property_id_t);
 extern ecma_property_t *ecma_find_internal_property (ecma_object_t *, ecma_internal_property_id_t);
 extern ecma_property_t *ecma_get_internal_property (ecma_object_t *, ecma_internal_property_id_t);
+extern ecma_array_elements_t *ecma_get_array_elements (ecma_object_t *);
 
 extern ecma_property_t *
 ecma_create_named_data_property (ecma_object_t *, ecma_string_t *, bool, bool, bool);
 extern ecma_property_t *
+ecma_create_object_literal_property (ecma_object_t *, ecma_string_t *, uint32_t);
+extern ecma_property_t *
 ecma_create_named_accessor_property (ecma_object_t *, ecma_string_t *, ecma_object_t *, ecma_object_t *, bool, bool);
 extern ecma_property_t *
 ecma_find_named_property (ecma_object_t *, ecma_string_t *);
@@ -235,7 +247,7 @@ extern void ecma_free_property (ecma_object_t *, ecma_string_t *, ecma_property_
 extern void ecma_delete_property (ecma_object_t *, ecma_property_t *);
 
 extern ecma_value_t ecma_get_named_data_property_value (const ecma_property_t *);
-extern void ecma_set_named_data_property_value (ecma_property_t *, ecma_value_t);
+extern void ecma_set_named_data_property_value (ecma_object_t *, ecma_property_t *, ecma_value_t);
 extern void ecma_named_data_property_assign_value (ecma_object_t *, ecma_property_t *, ecma_value_t);
 
 extern ecma_value_t ecma_get_internal_property_value (const ecma_property_t *);
@@ -0,0 +1,424 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
+#include "ecma-shape.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Inline caches of property access instructions
+ * @{
+ *
+ * An inline cache entry records, where the property with the specified name is located
+ * in objects with the specified shape: either in the object's own slot array, or in the
+ * slot array of its prototype. Each entry is checked completely before it is used, so
+ * instructions, which are mapped to the same entry, cannot get a wrong property, they
+ * only replace each other's entries.
+ */
+
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+/**
+ * Entry of the inline cache table
+ */
+typedef struct
+{
+  uint32_t name_field; /**< identifier of the property name (see also: ecma_inline_cache_is_name_cacheable) */
+  mem_cpointer_t shape_cp; /**< shape of the object (ECMA_NULL_POINTER marks the entry empty) */
+  mem_cpointer_t holder_shape_cp; /**< shape of the prototype, which has the property,
+                                   *   or ECMA_NULL_POINTER for own properties */
+  mem_cpointer_t prototype_cp; /**< prototype of the object (only used, if holder_shape_cp is not NULL) */
+  uint8_t name_container; /**< container of the property name */
+  uint8_t index; /**< index of the property in the slot array */
+} ecma_inline_cache_entry_t;
+
+/**
+ * Inline cache hash value length, in bits
+ */
+#define ECMA_INLINE_CACHE_HASH_BITS (8)
+
+/**
+ * Number of entries in the inline cache table
+ */
+#define ECMA_INLINE_CACHE_SIZE (1u << ECMA_INLINE_CACHE_HASH_BITS)
+
+/**
+ * Get the index of the entry, which belongs to the specified instruction
+ */
+#define ECMA_INLINE_CACHE_GET_INDEX(site_p) \
+  ((uint32_t) (((uintptr_t) (site_p) ^ ((uintptr_t) (site_p) >> ECMA_INLINE_CACHE_HASH_BITS)) \
+               & (ECMA_INLINE_CACHE_SIZE - 1)))
+
+/**
+ * Inline cache table
+ */
+static ecma_inline_cache_entry_t ecma_inline_cache_table[ECMA_INLINE_CACHE_SIZE];
+
+/**
+ * Statistics of the inline caches
+ */
+static ecma_inline_cache_stats_t ecma_inline_cache_stats;
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+
+/**
+ * Initialize the inline caches
+ */
+void
+ecma_inline_cache_init (void)
+{
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+  memset (ecma_inline_cache_table, 0, sizeof (ecma_inline_cache_table));
+  memset (&ecma_inline_cache_stats, 0, sizeof (ecma_inline_cache_stats));
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+} /* ecma_inline_cache_init */
+
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+/**
+ * Release the shapes referenced by an inline cache entry, and mark the entry empty
+ */
+static void
+ecma_inline_cache_invalidate_entry (ecma_inline_cache_entry_t *entry_p) /**< entry to invalidate */
+{
+  JERRY_ASSERT (entry_p->shape_cp != ECMA_NULL_POINTER);
+
+  ecma_shape_deref (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, entry_p->shape_cp));
+
+  if (entry_p->holder_shape_cp != ECMA_NULL_POINTER)
+  {
+    ecma_shape_deref (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, entry_p->holder_shape_cp));
+  }
+
+  entry_p->shape_cp = ECMA_NULL_POINTER;
+} /* ecma_inline_cache_invalidate_entry */
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+
+/**
+ * Invalidate all entries of the inline caches
+ *
+ * Note:
+ *      the entries keep their shapes alive, so they must be invalidated before the shapes are finalized
+ */
+void
+ecma_inline_cache_invalidate_all (void)
+{
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+  for (uint32_t i = 0; i < ECMA_INLINE_CACHE_SIZE; i++)
+  {
+    if (ecma_inline_cache_table[i].shape_cp != ECMA_NULL_POINTER)
+    {
+      ecma_inline_cache_invalidate_entry (ecma_inline_cache_table + i);
+    }
+  }
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+} /* ecma_inline_cache_invalidate_all */
+
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+/**
+ * Get the slot array of an object
+ *
+ * @return pointer to the slot array, if the object has shape,
+ *         NULL - otherwise
+ */
+static inline ecma_property_slots_t * __attr_always_inline___
+ecma_inline_cache_get_slots (ecma_object_t *object_p) /**< object or lexical environment */
+{
+  if (ecma_is_lexical_environment (object_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_header_t *property_list_p = ecma_get_property_list (object_p);
+
+  if (property_list_p == NULL || !ECMA_PROPERTY_IS_SLOTS (property_list_p))
+  {
+    return NULL;
+  }
+
+  return (ecma_property_slots_t *) property_list_p;
+} /* ecma_inline_cache_get_slots */
+
+/**
+ * Check whether a property name can be recorded in an inline cache entry
+ *
+ * Note:
+ *      literal and magic strings are identified by their container and common field,
+ *      which cannot be reused by another string
+ *
+ * @return true - if the name can be recorded,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_inline_cache_is_name_cacheable (const ecma_string_t *name_p) /**< property name */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (name_p);
+
+  return (container == ECMA_STRING_CONTAINER_LIT_TABLE
+          || container == ECMA_STRING_CONTAINER_MAGIC_STRING
+          || container == ECMA_STRING_CONTAINER_MAGIC_STRING_EX);
+} /* ecma_inline_cache_is_name_cacheable */
+
+/**
+ * Find the cached property in a slot array of an object or its prototype
+ *
+ * @return pointer to the property, if the entry describes the object and the name,
+ *         NULL - otherwise
+ */
+static inline ecma_property_t * __attr_always_inline___
+ecma_inline_cache_lookup (const ecma_inline_cache_entry_t *entry_p, /**< inline cache entry */
+                          ecma_object_t *object_p, /**< object */
+                          ecma_property_slots_t *slots_p, /**< slot array of the object */
+                          const ecma_string_t *name_p) /**< property name */
+{
+  if (entry_p->shape_cp != slots_p->shape_cp
+      || entry_p->name_field != name_p->u.common_field
+      || entry_p->name_container != ECMA_STRING_GET_CONTAINER (name_p))
+  {
+    return NULL;
+  }
+
+  if (entry_p->holder_shape_cp != ECMA_NULL_POINTER)
+  {
+    /* The shape of the object has no property with the name, so the property
+     * is found in the prototype, if the prototype still has the cached shape. */
+    if (object_p->prototype_or_outer_reference_cp != entry_p->prototype_cp)
+    {
+      return NULL;
+    }
+
+    slots_p = ecma_inline_cache_get_slots (ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->prototype_cp));
+
+    if (slots_p == NULL || slots_p->shape_cp != entry_p->holder_shape_cp)
+    {
+      return NULL;
+    }
+  }
+
+  return ECMA_PROPERTY_SLOTS_GET_PROPERTY (slots_p, entry_p->index);
+} /* ecma_inline_cache_lookup */
+
+/**
+ * Look up a property in a slot array of an object or its prototype, and record its location
+ *
+ * @return pointer to the property, if it is found,
+ *         NULL - otherwise
+ */
+static ecma_property_t *
+ecma_inline_cache_update (ecma_inline_cache_entry_t *entry_p, /**< inline cache entry */
+                          ecma_object_t *object_p, /**< object */
+                          ecma_property_slots_t *slots_p, /**< slot array of the object */
+                          ecma_string_t *name_p, /**< property name */
+                          bool is_own) /**< only own properties can be recorded */
+{
+  ecma_shape_t *shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, slots_p->shape_cp);
+  ecma_shape_t *holder_shape_p = NULL;
+  ecma_property_slots_t *holder_slots_p = slots_p;
+
+  uint32_t index = ecma_shape_find_property (shape_p, name_p);
+
+  if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+  {
+    ecma_object_t *prototype_p = ecma_get_object_prototype (object_p);
+
+    if (is_own || prototype_p == NULL)
+    {
+      return NULL;
+    }
+
+    holder_slots_p = ecma_inline_cache_get_slots (prototype_p);
+
+    if (holder_slots_p == NULL)
+    {
+      return NULL;
+    }
+
+    holder_shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, holder_slots_p->shape_cp);
+    index = ecma_shape_find_property (holder_shape_p, name_p);
+
+    if (index == ECMA_SHAPE_PROPERTY_NOT_FOUND)
+    {
+      return NULL;
+    }
+  }
+
+  /* Acquire the new references first, since the entry may already reference the same shapes. */
+  ecma_shape_ref (shape_p);
+
+  if (holder_shape_p != NULL)
+  {
+    ecma_shape_ref (holder_shape_p);
+  }
+
+  if (entry_p->shape_cp != ECMA_NULL_POINTER)
+  {
+    ecma_inline_cache_invalidate_entry (entry_p);
+  }
+
+  JERRY_ASSERT (index <= UINT8_MAX);
+
+  entry_p->name_field = name_p->u.common_field;
+  entry_p->name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (name_p);
+  entry_p->index = (uint8_t) index;
+  ECMA_SET_NON_NULL_POINTER (entry_p->shape_cp, shape_p);
+  ECMA_SET_POINTER (entry_p->holder_shape_cp, holder_shape_p);
+  entry_p->prototype_cp = (holder_shape_p != NULL) ? object_p->prototype_or_outer_reference_cp : ECMA_NULL_POINTER;
+
+  return ECMA_PROPERTY_SLOTS_GET_PROPERTY (holder_slots_p, index);
+} /* ecma_inline_cache_update */
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+
+/**
+ * Read a named data property of an object with shape through the inline cache of an instruction
+ *
+ * Note:
+ *      the cache is used for objects with shape, whose own property or whose prototype's property
+ *      is a named data property, the other cases must be handled by [[Get]]
+ *
+ * @return true - if the value is read (and stored into value_p),
+ *         false - otherwise
+ */
+bool
+ecma_inline_cache_get (const void *site_p, /**< instruction, which reads the property */
+                       ecma_object_t *object_p, /**< object or lexical environment */
+                       ecma_string_t *name_p, /**< property name */
+                       ecma_value_t *value_p) /**< [out] value of the property */
+{
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+  ecma_property_slots_t *slots_p = ecma_inline_cache_get_slots (object_p);
+
+  if (slots_p == NULL || !ecma_inline_cache_is_name_cacheable (name_p))
+  {
+    return false;
+  }
+
+  ecma_inline_cache_entry_t *entry_p = ecma_inline_cache_table + ECMA_INLINE_CACHE_GET_INDEX (site_p);
+  ecma_property_t *property_p = ecma_inline_cache_lookup (entry_p, object_p, slots_p, name_p);
+
+  if (likely (property_p != NULL))
+  {
+    ecma_inline_cache_stats.get_hits++;
+  }
+  else
+  {
+    ecma_inline_cache_stats.get_misses++;
+    property_p = ecma_inline_cache_update (entry_p, object_p, slots_p, name_p, false);
+
+    if (property_p == NULL)
+    {
+      return false;
+    }
+  }
+
+  /* Attributes are stored in the objects, so they must be checked even if the shapes match. */
+  if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA)
+  {
+    return false;
+  }
+
+  *value_p = ecma_copy_value (ecma_get_named_data_property_value (property_p));
+  return true;
+#else /* CONFIG_ECMA_INLINE_CACHE_DISABLE */
+  (void) site_p;
+  (void) object_p;
+  (void) name_p;
+  (void) value_p;
+
+  return false;
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+} /* ecma_inline_cache_get */
+
+/**
+ * Assign a value to an own writable named data property of an object with shape
+ * through the inline cache of an instruction
+ *
+ * Note:
+ *      the other cases (including creation of properties) must be handled by [[Put]]
+ *
+ * @return true - if the value is assigned,
+ *         false - otherwise
+ */
+bool
+ecma_inline_cache_put (const void *site_p, /**< instruction, which writes the property */
+                       ecma_object_t *object_p, /**< object or lexical environment */
+                       ecma_string_t *name_p, /**< property name */
+                       ecma_value_t value) /**< value to assign */
+{
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+  ecma_property_slots_t *slots_p = ecma_inline_cache_get_slots (object_p);
+
+  if (slots_p == NULL || !ecma_inline_cache_is_name_cacheable (name_p))
+  {
+    return false;
+  }
+
+  ecma_inline_cache_entry_t *entry_p = ecma_inline_cache_table + ECMA_INLINE_CACHE_GET_INDEX (site_p);
+  ecma_property_t *property_p = NULL;
+
+  if (entry_p->holder_shape_cp == ECMA_NULL_POINTER)
+  {
+    property_p = ecma_inline_cache_lookup (entry_p, object_p, slots_p, name_p);
+  }
+
+  if (likely (property_p != NULL))
+  {
+    ecma_inline_cache_stats.put_hits++;
+  }
+  else
+  {
+    ecma_inline_cache_stats.put_misses++;
+    property_p = ecma_inline_cache_update (entry_p, object_p, slots_p, name_p, true);
+
+    if (property_p == NULL)
+    {
+      return false;
+    }
+  }
+
+  if (ECMA_PROPERTY_GET_TYPE (property_p) != ECMA_PROPERTY_TYPE_NAMEDDATA
+      || !ecma_is_property_writable (property_p))
+  {
+    return false;
+  }
+
+  ecma_named_data_property_assign_value (object_p, property_p, value);
+  return true;
+#else /* CONFIG_ECMA_INLINE_CACHE_DISABLE */
+  (void) site_p;
+  (void) object_p;
+  (void) name_p;
+  (void) value;
+
+  return false;
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+} /* ecma_inline_cache_put */
+
+/**
+ * Get statistics of the inline caches
+ */
+void
+ecma_inline_cache_get_stats (ecma_inline_cache_stats_t *out_stats_p) /**< [out] statistics */
+{
+#ifndef CONFIG_ECMA_INLINE_CACHE_DISABLE
+  *out_stats_p = ecma_inline_cache_stats;
+#else /* CONFIG_ECMA_INLINE_CACHE_DISABLE */
+  memset (out_stats_p, 0, sizeof (ecma_inline_cache_stats_t));
+#endif /* !CONFIG_ECMA_INLINE_CACHE_DISABLE */
+} /* ecma_inline_cache_get_stats */
+
+/**
+ * @}
+ * @}
+ */
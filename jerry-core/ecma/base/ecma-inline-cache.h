@@ -0,0 +1,50 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_INLINE_CACHE_H
+#define ECMA_INLINE_CACHE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmainlinecache Inline caches of property access instructions
+ * @{
+ */
+
+/**
+ * Statistics of the inline caches
+ */
+typedef struct
+{
+  size_t get_hits; /**< number of property reads, which were served by the cached property location */
+  size_t get_misses; /**< number of cacheable property reads, which required a lookup */
+  size_t put_hits; /**< number of property writes, which were served by the cached property location */
+  size_t put_misses; /**< number of cacheable property writes, which required a lookup */
+} ecma_inline_cache_stats_t;
+
+extern void ecma_inline_cache_init (void);
+extern void ecma_inline_cache_invalidate_all (void);
+extern bool ecma_inline_cache_get (const void *, ecma_object_t *, ecma_string_t *, ecma_value_t *);
+extern bool ecma_inline_cache_put (const void *, ecma_object_t *, ecma_string_t *, ecma_value_t);
+extern void ecma_inline_cache_get_stats (ecma_inline_cache_stats_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_INLINE_CACHE_H */
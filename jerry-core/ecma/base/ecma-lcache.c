@@ -19,6 +19,7 @@
 #include "ecma-helpers.h"
 #include "ecma-lcache.h"
 #include "jrt-libc-includes.h"
+#include "lit-char-helpers.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -30,38 +31,131 @@
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
 /**
  * Entry of LCache hash table
+ *
+ * Note:
+ *      the entries are weak: they do not reference the objects and the names, instead
+ *      the entries of unreachable objects are invalidated by the garbage collector
+ *      (see also: ecma_lcache_invalidate_unreachable), and the entries of deleted
+ *      properties are invalidated when the property is freed.
  */
 typedef struct
 {
-  /** Pointer to a property of the object */
+  /** Pointer to a property of the object, or NULL if the object has no property with the name */
   ecma_property_t *prop_p;
 
+  /** Identifier of the property name (see also: ecma_lcache_get_entry_name) */
+  uint32_t name_field;
+
   /** Compressed pointer to object (ECMA_NULL_POINTER marks record empty) */
   mem_cpointer_t object_cp;
 
-  /** Compressed pointer to property's name */
-  mem_cpointer_t prop_name_cp;
+  /** Container of the property name */
+  uint8_t name_container;
 } ecma_lcache_hash_entry_t;
 
-/**
- * LCache hash value length, in bits
- */
-#define ECMA_LCACHE_HASH_BITS (sizeof (lit_string_hash_t) * JERRY_BITSINBYTE)
+JERRY_STATIC_ASSERT (CONFIG_ECMA_LCACHE_HASH_BITS > 0
+                     && CONFIG_ECMA_LCACHE_HASH_BITS <= sizeof (lit_string_hash_t) * JERRY_BITSINBYTE,
+                     lcache_hash_bits_must_not_be_greater_than_the_size_of_lit_string_hash_t);
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH > 0,
+                     lcache_row_length_must_be_positive);
 
 /**
  * Number of rows in LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROWS_COUNT (1ull << ECMA_LCACHE_HASH_BITS)
+#define ECMA_LCACHE_HASH_ROWS_COUNT (1u << CONFIG_ECMA_LCACHE_HASH_BITS)
 
 /**
  * Number of entries in a row of LCache's hash table
  */
-#define ECMA_LCACHE_HASH_ROW_LENGTH (2)
+#define ECMA_LCACHE_HASH_ROW_LENGTH CONFIG_ECMA_LCACHE_HASH_ROW_LENGTH
+
+/**
+ * Compute the row index of an (object, property name) pair
+ */
+#define ECMA_LCACHE_GET_ROW_INDEX(object_cp, prop_name_p) \
+  ((uint32_t) ((ecma_string_hash (prop_name_p) ^ (object_cp)) & (ECMA_LCACHE_HASH_ROWS_COUNT - 1)))
 
 /**
  * LCache's hash table
  */
 static ecma_lcache_hash_entry_t ecma_lcache_hash_table[ ECMA_LCACHE_HASH_ROWS_COUNT ][ ECMA_LCACHE_HASH_ROW_LENGTH ];
+
+/**
+ * Entry of the prototype chain cache
+ *
+ * Note:
+ *      an entry stores the result of looking up a property name along the prototype chain,
+ *      which starts with the object of the entry; the entries are weak like the entries of
+ *      LCache's hash table, and they are valid only in the generation they were created in.
+ */
+typedef struct
+{
+  /** Pointer to the property found on the chain, or NULL if no object of the chain has the property */
+  ecma_property_t *prop_p;
+
+  /** Identifier of the property name */
+  uint32_t name_field;
+
+  /** Compressed pointer to the first object of the chain (ECMA_NULL_POINTER marks record empty) */
+  mem_cpointer_t object_cp;
+
+  /** Container of the property name */
+  uint8_t name_container;
+
+  /** Generation of the prototype chain cache, in which the entry was created */
+  uint8_t generation;
+} ecma_lcache_chain_entry_t;
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS >= 2
+                     && CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS <= sizeof (lit_string_hash_t) * JERRY_BITSINBYTE,
+                     lcache_chain_hash_bits_must_be_in_the_range_of_lit_string_hash_t);
+
+/**
+ * Number of entries in the prototype chain cache
+ */
+#define ECMA_LCACHE_CHAIN_ENTRIES_COUNT (1u << CONFIG_ECMA_LCACHE_CHAIN_HASH_BITS)
+
+/**
+ * Number of entries in a row of the watched objects table
+ */
+#define ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH 4
+
+/**
+ * Number of rows in the watched objects table
+ */
+#define ECMA_LCACHE_CHAIN_WATCH_ROWS_COUNT (ECMA_LCACHE_CHAIN_ENTRIES_COUNT / ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH)
+
+/**
+ * Compute the index of the prototype chain cache entry of an (object, property name) pair
+ */
+#define ECMA_LCACHE_CHAIN_GET_ENTRY_INDEX(object_cp, prop_name_p) \
+  ((uint32_t) ((ecma_string_hash (prop_name_p) ^ (object_cp)) & (ECMA_LCACHE_CHAIN_ENTRIES_COUNT - 1)))
+
+/**
+ * Prototype chain cache
+ */
+static ecma_lcache_chain_entry_t ecma_lcache_chain_table[ ECMA_LCACHE_CHAIN_ENTRIES_COUNT ];
+
+/**
+ * Objects, which are part of the chains of the valid prototype chain cache entries
+ *
+ * Note:
+ *      creating or deleting a property of a watched object starts a new generation
+ *      of the prototype chain cache, which invalidates all of its entries.
+ */
+static mem_cpointer_t ecma_lcache_chain_watched_objects[ ECMA_LCACHE_CHAIN_WATCH_ROWS_COUNT ]
+                                                       [ ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH ];
+
+/**
+ * Current generation of the prototype chain cache
+ */
+static uint8_t ecma_lcache_chain_generation;
+
+/**
+ * Statistics of LCache
+ */
+static ecma_lcache_stats_t ecma_lcache_stats;
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -72,6 +166,10 @@ ecma_lcache_init (void)
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
   memset (ecma_lcache_hash_table, 0, sizeof (ecma_lcache_hash_table));
+  memset (ecma_lcache_chain_table, 0, sizeof (ecma_lcache_chain_table));
+  memset (ecma_lcache_chain_watched_objects, 0, sizeof (ecma_lcache_chain_watched_objects));
+  ecma_lcache_chain_generation = 0;
+  memset (&ecma_lcache_stats, 0, sizeof (ecma_lcache_stats));
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_init */
 
@@ -85,18 +183,175 @@ ecma_lcache_invalidate_entry (ecma_lcache_hash_entry_t *entry_p) /**< entry to i
   JERRY_ASSERT (entry_p != NULL);
   JERRY_ASSERT (entry_p->object_cp != ECMA_NULL_POINTER);
 
-  ecma_deref_object (ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                entry_p->object_cp));
+  ecma_lcache_stats.invalidations++;
 
   entry_p->object_cp = ECMA_NULL_POINTER;
-  ecma_deref_ecma_string (ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                     entry_p->prop_name_cp));
 
   if (entry_p->prop_p != NULL)
   {
     ecma_set_property_lcached (entry_p->prop_p, false);
   }
 } /* ecma_lcache_invalidate_entry */
+
+/**
+ * Check whether a property name can identify an LCache entry
+ *
+ * Note:
+ *      names stored in the literal table, magic strings and numbers stored in the descriptor
+ *      are identified by their container and common field, which cannot be reused by another
+ *      string, while the heap data of the other strings can be freed and reused.
+ *
+ * @return true - if the name is identified by its container and common field,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_lcache_is_name_stable (const ecma_string_t *prop_name_p) /**< property name */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (prop_name_p);
+
+  return (container != ECMA_STRING_CONTAINER_HEAP_CHUNKS
+          && container != ECMA_STRING_CONTAINER_HEAP_NUMBER);
+} /* ecma_lcache_is_name_stable */
+
+/**
+ * Get the name, which identifies the LCache entry of a property
+ *
+ * @return the lookup name, if it is stable (see also: ecma_lcache_is_name_stable),
+ *         the name stored in the property pair, if the property exists
+ *         (as it is referenced by the property while the entry is valid),
+ *         NULL - otherwise (the lookup cannot be cached)
+ */
+static const ecma_string_t *
+ecma_lcache_get_entry_name (const ecma_string_t *prop_name_p, /**< property name used for the lookup */
+                            ecma_property_t *prop_p) /**< property or NULL */
+{
+  if (ecma_lcache_is_name_stable (prop_name_p))
+  {
+    return prop_name_p;
+  }
+
+  if (prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  /* LCached properties are stored in property pairs. */
+  ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) ECMA_PROPERTY_VALUE_BASE_PTR (prop_p);
+  uint32_t index = (uint32_t) (prop_p - prop_pair_p->header.types);
+
+  JERRY_ASSERT (index < ECMA_PROPERTY_PAIR_ITEM_COUNT);
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[index]);
+} /* ecma_lcache_get_entry_name */
+
+/**
+ * Check whether the prototype chain lookups of a property name can be cached
+ *
+ * Note:
+ *      array indices are excluded, since the elements of arrays, typed arrays and String objects
+ *      are not (or not always) stored as named properties; the names starting with a decimal digit
+ *      are rejected without checking whether they are array indices.
+ *
+ * @return true - if the name is stable and it is not an array index,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_lcache_chain_is_name_cacheable (const ecma_string_t *prop_name_p) /**< property name */
+{
+  ecma_string_container_t container = ECMA_STRING_GET_CONTAINER (prop_name_p);
+
+  if (container != ECMA_STRING_CONTAINER_LIT_TABLE
+      && container != ECMA_STRING_CONTAINER_MAGIC_STRING
+      && container != ECMA_STRING_CONTAINER_MAGIC_STRING_EX)
+  {
+    return false;
+  }
+
+  lit_utf8_size_t size;
+  bool is_ascii;
+  const lit_utf8_byte_t *chars_p = ecma_string_raw_chars (prop_name_p, &size, &is_ascii);
+
+  return (chars_p != NULL
+          && (size == 0 || !lit_char_is_decimal_digit (chars_p[0])));
+} /* ecma_lcache_chain_is_name_cacheable */
+
+/**
+ * Get the row of the watched objects table, which can contain an object
+ *
+ * @return pointer to the row
+ */
+static inline mem_cpointer_t * __attr_always_inline___
+ecma_lcache_chain_get_watch_row (mem_cpointer_t object_cp) /**< compressed pointer to an object */
+{
+  return ecma_lcache_chain_watched_objects[object_cp & (ECMA_LCACHE_CHAIN_WATCH_ROWS_COUNT - 1)];
+} /* ecma_lcache_chain_get_watch_row */
+
+/**
+ * Register an object as part of a cached prototype chain
+ *
+ * @return true - if the object is watched,
+ *         false - if its row of the watched objects table is full
+ */
+static bool
+ecma_lcache_chain_watch (ecma_object_t *object_p) /**< object */
+{
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  mem_cpointer_t *row_p = ecma_lcache_chain_get_watch_row (object_cp);
+  mem_cpointer_t *empty_entry_p = NULL;
+
+  for (uint32_t i = 0; i < ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH; i++)
+  {
+    if (row_p[i] == object_cp)
+    {
+      return true;
+    }
+
+    if (row_p[i] == ECMA_NULL_POINTER && empty_entry_p == NULL)
+    {
+      empty_entry_p = row_p + i;
+    }
+  }
+
+  if (empty_entry_p == NULL)
+  {
+    return false;
+  }
+
+  *empty_entry_p = object_cp;
+  return true;
+} /* ecma_lcache_chain_watch */
+
+/**
+ * Invalidate all entries of the prototype chain cache, if the object is part of a cached chain
+ */
+static void
+ecma_lcache_chain_invalidate_object (ecma_object_t *object_p) /**< object */
+{
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  mem_cpointer_t *row_p = ecma_lcache_chain_get_watch_row (object_cp);
+
+  for (uint32_t i = 0; i < ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH; i++)
+  {
+    if (row_p[i] == object_cp)
+    {
+      /* The entries of the previous generations are never matched, so they do not have to be cleared,
+       * except when the generation counter wraps around. */
+      ecma_lcache_chain_generation++;
+
+      if (ecma_lcache_chain_generation == 0)
+      {
+        memset (ecma_lcache_chain_table, 0, sizeof (ecma_lcache_chain_table));
+      }
+
+      memset (ecma_lcache_chain_watched_objects, 0, sizeof (ecma_lcache_chain_watched_objects));
+      return;
+    }
+  }
+} /* ecma_lcache_chain_invalidate_object */
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 
 /**
@@ -116,16 +371,100 @@ ecma_lcache_invalidate_all (void)
       }
     }
   }
+
+  memset (ecma_lcache_chain_table, 0, sizeof (ecma_lcache_chain_table));
+  memset (ecma_lcache_chain_watched_objects, 0, sizeof (ecma_lcache_chain_watched_objects));
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_invalidate_all */
 
+/**
+ * Invalidate the entries of objects, which are going to be freed by the garbage collector
+ */
+void
+ecma_lcache_invalidate_unreachable (ecma_lcache_is_object_reachable_t is_reachable) /**< checks whether
+                                                                                    *   an object survives
+                                                                                    *   the collection */
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  for (uint32_t row_index = 0; row_index < ECMA_LCACHE_HASH_ROWS_COUNT; row_index++)
+  {
+    for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
+    {
+      ecma_lcache_hash_entry_t *entry_p = &ecma_lcache_hash_table[ row_index ][ entry_index ];
+
+      if (entry_p->object_cp != ECMA_NULL_POINTER
+          && !is_reachable (ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->object_cp)))
+      {
+        ecma_lcache_invalidate_entry (entry_p);
+      }
+    }
+  }
+
+  /* If an object of a cached chain is unreachable, the first object of the chain is also unreachable. */
+  for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_CHAIN_ENTRIES_COUNT; entry_index++)
+  {
+    ecma_lcache_chain_entry_t *entry_p = ecma_lcache_chain_table + entry_index;
+
+    if (entry_p->object_cp != ECMA_NULL_POINTER
+        && !is_reachable (ECMA_GET_NON_NULL_POINTER (ecma_object_t, entry_p->object_cp)))
+    {
+      entry_p->object_cp = ECMA_NULL_POINTER;
+    }
+  }
+
+  for (uint32_t row_index = 0; row_index < ECMA_LCACHE_CHAIN_WATCH_ROWS_COUNT; row_index++)
+  {
+    for (uint32_t entry_index = 0; entry_index < ECMA_LCACHE_CHAIN_WATCH_ROW_LENGTH; entry_index++)
+    {
+      mem_cpointer_t *entry_p = &ecma_lcache_chain_watched_objects[ row_index ][ entry_index ];
+
+      if (*entry_p != ECMA_NULL_POINTER
+          && !is_reachable (ECMA_GET_NON_NULL_POINTER (ecma_object_t, *entry_p)))
+      {
+        *entry_p = ECMA_NULL_POINTER;
+      }
+    }
+  }
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  (void) is_reachable;
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_invalidate_unreachable */
+
+/**
+ * Get number of LCache entries, which were invalidated since initialization of LCache
+ *
+ * @return number of invalidated entries
+ */
+size_t
+ecma_lcache_get_invalidations_number (void)
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  return ecma_lcache_stats.invalidations;
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  return 0;
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_get_invalidations_number */
+
+/**
+ * Get statistics of LCache
+ */
+void
+ecma_lcache_get_stats (ecma_lcache_stats_t *out_stats_p) /**< [out] statistics */
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  *out_stats_p = ecma_lcache_stats;
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  memset (out_stats_p, 0, sizeof (ecma_lcache_stats_t));
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_get_stats */
+
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
 /**
  * Invalidate entries of LCache's row that correspond to given (object, property) pair
  */
 static void
 ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< index of the row */
-                                                     unsigned int object_cp, /**< compressed pointer
+                                                     mem_cpointer_t object_cp, /**< compressed pointer
                                                                               *   to an object */
                                                      ecma_property_t *property_p) /**< pointer to the
                                                                                    *   object's property */
@@ -143,6 +482,9 @@ ecma_lcache_invalidate_row_for_object_property_pair (uint32_t row_index, /**< in
 
 /**
  * Insert an entry into LCache
+ *
+ * Note:
+ *      if the row is full, its oldest entry is evicted
  */
 void
 ecma_lcache_insert (ecma_object_t *object_p, /**< object */
@@ -155,9 +497,18 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   JERRY_ASSERT (prop_name_p != NULL);
 
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  prop_name_p = ecma_copy_or_ref_ecma_string (prop_name_p);
+  const ecma_string_t *entry_name_p = ecma_lcache_get_entry_name (prop_name_p, prop_p);
+
+  if (entry_name_p == NULL)
+  {
+    return;
+  }
+
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  uint32_t hash_key = ECMA_LCACHE_GET_ROW_INDEX (object_cp, prop_name_p);
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[hash_key];
 
   if (prop_p != NULL)
   {
@@ -166,21 +517,16 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
       int32_t entry_index;
       for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
       {
-        if (ecma_lcache_hash_table[hash_key][entry_index].object_cp != ECMA_NULL_POINTER
-            && ecma_lcache_hash_table[hash_key][entry_index].prop_p == prop_p)
+        if (row_p[entry_index].object_cp != ECMA_NULL_POINTER
+            && row_p[entry_index].prop_p == prop_p)
         {
-#ifndef JERRY_NDEBUG
-          ecma_object_t *obj_in_entry_p;
-          obj_in_entry_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t,
-                                                      ecma_lcache_hash_table[hash_key][entry_index].object_cp);
-          JERRY_ASSERT (obj_in_entry_p == object_p);
-#endif /* !JERRY_NDEBUG */
+          JERRY_ASSERT (row_p[entry_index].object_cp == object_cp);
           break;
         }
       }
 
       JERRY_ASSERT (entry_index != ECMA_LCACHE_HASH_ROW_LENGTH);
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][entry_index]);
+      ecma_lcache_invalidate_entry (row_p + entry_index);
     }
 
     JERRY_ASSERT (!ecma_is_property_lcached (prop_p));
@@ -190,7 +536,7 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
   int32_t entry_index;
   for (entry_index = 0; entry_index < ECMA_LCACHE_HASH_ROW_LENGTH; entry_index++)
   {
-    if (ecma_lcache_hash_table[hash_key][entry_index].object_cp == ECMA_NULL_POINTER)
+    if (row_p[entry_index].object_cp == ECMA_NULL_POINTER)
     {
       break;
     }
@@ -198,19 +544,24 @@ ecma_lcache_insert (ecma_object_t *object_p, /**< object */
 
   if (entry_index == ECMA_LCACHE_HASH_ROW_LENGTH)
   {
-    /* No empty entry was found, invalidating the whole row */
-    for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
+    /* No empty entry was found, evicting the oldest entry of the row */
+    entry_index = ECMA_LCACHE_HASH_ROW_LENGTH - 1;
+
+    if (row_p[entry_index].prop_p != NULL)
     {
-      ecma_lcache_invalidate_entry (&ecma_lcache_hash_table[hash_key][i]);
+      ecma_set_property_lcached (row_p[entry_index].prop_p, false);
     }
 
+    ecma_lcache_stats.evictions++;
+
+    memmove (row_p + 1, row_p, (ECMA_LCACHE_HASH_ROW_LENGTH - 1) * sizeof (ecma_lcache_hash_entry_t));
     entry_index = 0;
   }
 
-  ecma_ref_object (object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].object_cp, object_p);
-  ECMA_SET_NON_NULL_POINTER (ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_name_cp, prop_name_p);
-  ecma_lcache_hash_table[ hash_key ][ entry_index ].prop_p = prop_p;
+  row_p[entry_index].prop_p = prop_p;
+  row_p[entry_index].name_field = entry_name_p->u.common_field;
+  row_p[entry_index].object_cp = object_cp;
+  row_p[entry_index].name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (entry_name_p);
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) prop_p;
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
@@ -233,36 +584,31 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
                                                  *         then the output parameter is not set */
 {
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
-
-  unsigned int object_cp;
+  mem_cpointer_t object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
+  ecma_lcache_hash_entry_t *row_p = ecma_lcache_hash_table[ECMA_LCACHE_GET_ROW_INDEX (object_cp, prop_name_p)];
+  uint8_t name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (prop_name_p);
+
   for (uint32_t i = 0; i < ECMA_LCACHE_HASH_ROW_LENGTH; i++)
   {
-    if (ecma_lcache_hash_table[hash_key][i].object_cp == object_cp)
+    /* The name of an entry may be equal to the name, even if their identifiers are different,
+     * but comparing the characters here would be too long. */
+    if (row_p[i].object_cp == object_cp
+        && row_p[i].name_field == prop_name_p->u.common_field
+        && row_p[i].name_container == name_container)
     {
-      ecma_string_t *entry_prop_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
-                                                                    ecma_lcache_hash_table[hash_key][i].prop_name_cp);
-
-      JERRY_ASSERT (prop_name_p->hash == entry_prop_name_p->hash);
-
-      if (ECMA_STRING_GET_CONTAINER (prop_name_p) == ECMA_STRING_GET_CONTAINER (entry_prop_name_p)
-          && prop_name_p->u.common_field == entry_prop_name_p->u.common_field)
-      {
-        ecma_property_t *prop_p = ecma_lcache_hash_table[hash_key][i].prop_p;
-        JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
+      ecma_property_t *prop_p = row_p[i].prop_p;
+      JERRY_ASSERT (prop_p == NULL || ecma_is_property_lcached (prop_p));
 
-        *prop_p_p = prop_p;
+      ecma_lcache_stats.hits++;
+      *prop_p_p = prop_p;
 
-        return true;
-      }
-      else
-      {
-        /* may be equal but it is long to compare it here */
-      }
+      return true;
     }
   }
+
+  ecma_lcache_stats.misses++;
 #else /* CONFIG_ECMA_LCACHE_DISABLE */
   (void) object_p;
   (void) prop_name_p;
@@ -276,20 +622,22 @@ ecma_lcache_lookup (ecma_object_t *object_p, /**< object */
  * Invalidate LCache entries associated with given object and property name / property
  *
  * Note:
- *      Either property name argument or property argument should be NULL,
- *      and another should be non-NULL.
- *      In case property name argument is NULL, property's name is taken
- *      from property's description.
+ *      If property argument is NULL, the entries, which record that the object
+ *      has no property with the name, are invalidated.
  */
 void
 ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
-                        ecma_string_t *prop_name_p, /**< property's name (See also: Note) */
+                        ecma_string_t *prop_name_p, /**< property's name */
                         ecma_property_t *prop_p) /**< property (See also: Note) */
 {
   JERRY_ASSERT (object_p != NULL);
   JERRY_ASSERT (prop_name_p != NULL);
 
 #ifndef CONFIG_ECMA_LCACHE_DISABLE
+  /* Creating or deleting a property of an object may change the result of the lookups
+   * along the prototype chains, which contain the object. */
+  ecma_lcache_chain_invalidate_object (object_p);
+
   if (prop_p != NULL)
   {
     JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (prop_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
@@ -301,22 +649,133 @@ ecma_lcache_invalidate (ecma_object_t *object_p, /**< object */
     {
       return;
     }
-
-    ecma_set_property_lcached (prop_p, false);
   }
 
-  unsigned int object_cp;
+  mem_cpointer_t object_cp;
   ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
 
-  lit_string_hash_t hash_key = ecma_string_hash (prop_name_p);
+  /* The (object, property name) pair should be in the row corresponding to its hash. */
+  ecma_lcache_invalidate_row_for_object_property_pair (ECMA_LCACHE_GET_ROW_INDEX (object_cp, prop_name_p),
+                                                       object_cp,
+                                                       prop_p);
 
-  /* Property's name has was computed.
-   * Given (object, property name) pair should be in the row corresponding to computed hash.
-   */
-  ecma_lcache_invalidate_row_for_object_property_pair (hash_key, object_cp, prop_p);
+  JERRY_ASSERT (prop_p == NULL || !ecma_is_property_lcached (prop_p));
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  (void) prop_p;
 #endif /* !CONFIG_ECMA_LCACHE_DISABLE */
 } /* ecma_lcache_invalidate */
 
+/**
+ * Lookup the result of a prototype chain lookup in the prototype chain cache
+ *
+ * @return true - if the (object, property name) pair is registered in the cache,
+ *         false - probably, not registered.
+ */
+bool
+ecma_lcache_chain_lookup (ecma_object_t *object_p, /**< first object of the prototype chain */
+                          const ecma_string_t *prop_name_p, /**< property's name */
+                          ecma_property_t **prop_p_p) /**< [out] if return value is true,
+                                                       *         then here will be pointer to the property,
+                                                       *         if an object of the chain has property
+                                                       *         with specified name, or, otherwise - NULL;
+                                                       *         if return value is false,
+                                                       *         then the output parameter is not set */
+{
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  if (!ecma_lcache_chain_is_name_cacheable (prop_name_p))
+  {
+    return false;
+  }
+
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  ecma_lcache_chain_entry_t *entry_p = ecma_lcache_chain_table + ECMA_LCACHE_CHAIN_GET_ENTRY_INDEX (object_cp,
+                                                                                                     prop_name_p);
+
+  if (entry_p->object_cp == object_cp
+      && entry_p->generation == ecma_lcache_chain_generation
+      && entry_p->name_field == prop_name_p->u.common_field
+      && entry_p->name_container == (uint8_t) ECMA_STRING_GET_CONTAINER (prop_name_p))
+  {
+    ecma_lcache_stats.chain_hits++;
+    *prop_p_p = entry_p->prop_p;
+
+    return true;
+  }
+
+  ecma_lcache_stats.chain_misses++;
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  (void) object_p;
+  (void) prop_name_p;
+  (void) prop_p_p;
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+
+  return false;
+} /* ecma_lcache_chain_lookup */
+
+/**
+ * Insert the result of a prototype chain lookup into the prototype chain cache
+ *
+ * Note:
+ *      the objects of the chain up to the holder of the property (or all objects
+ *      of the chain, if the property was not found) are watched, since creating
+ *      or deleting a property of any of them can change the result of the lookup
+ */
+void
+ecma_lcache_chain_insert (ecma_object_t *object_p, /**< first object of the prototype chain */
+                          ecma_string_t *prop_name_p, /**< property's name */
+                          ecma_object_t *holder_p, /**< object of the chain, which has the property,
+                                                    *   or NULL */
+                          ecma_property_t *prop_p) /**< property of the holder object,
+                                                    *   or NULL (if no object of the chain has the property) */
+{
+  JERRY_ASSERT (object_p != NULL);
+  JERRY_ASSERT (prop_name_p != NULL);
+  JERRY_ASSERT ((holder_p == NULL) == (prop_p == NULL));
+
+#ifndef CONFIG_ECMA_LCACHE_DISABLE
+  if (!ecma_lcache_chain_is_name_cacheable (prop_name_p))
+  {
+    return;
+  }
+
+  ecma_object_t *iter_p = object_p;
+
+  while (iter_p != NULL)
+  {
+    if (!ecma_lcache_chain_watch (iter_p))
+    {
+      return;
+    }
+
+    if (iter_p == holder_p)
+    {
+      break;
+    }
+
+    iter_p = ecma_get_object_prototype (iter_p);
+  }
+
+  JERRY_ASSERT (iter_p == holder_p);
+
+  mem_cpointer_t object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_cp, object_p);
+
+  ecma_lcache_chain_entry_t *entry_p = ecma_lcache_chain_table + ECMA_LCACHE_CHAIN_GET_ENTRY_INDEX (object_cp,
+                                                                                                     prop_name_p);
+
+  entry_p->prop_p = prop_p;
+  entry_p->name_field = prop_name_p->u.common_field;
+  entry_p->object_cp = object_cp;
+  entry_p->name_container = (uint8_t) ECMA_STRING_GET_CONTAINER (prop_name_p);
+  entry_p->generation = ecma_lcache_chain_generation;
+#else /* CONFIG_ECMA_LCACHE_DISABLE */
+  (void) holder_p;
+  (void) prop_p;
+#endif /* !CONFIG_ECMA_LCACHE_DISABLE */
+} /* ecma_lcache_chain_insert */
+
 /**
  * @}
  * @}
@@ -23,11 +23,34 @@
  * @{
  */
 
+/**
+ * Statistics of LCache
+ */
+typedef struct
+{
+  size_t hits; /**< number of lookups, which found the (object, property name) pair */
+  size_t misses; /**< number of lookups, which did not find the (object, property name) pair */
+  size_t evictions; /**< number of entries, which were replaced because their row was full */
+  size_t invalidations; /**< number of entries, which were invalidated */
+  size_t chain_hits; /**< number of prototype chain lookups, which were served by the prototype chain cache */
+  size_t chain_misses; /**< number of cacheable prototype chain lookups, which were not found in the cache */
+} ecma_lcache_stats_t;
+
+/**
+ * Callback checking whether an object survives the current garbage collection
+ */
+typedef bool (*ecma_lcache_is_object_reachable_t) (ecma_object_t *);
+
 extern void ecma_lcache_init (void);
 extern void ecma_lcache_invalidate_all (void);
 extern void ecma_lcache_insert (ecma_object_t *, ecma_string_t *, ecma_property_t *);
 extern bool ecma_lcache_lookup (ecma_object_t *, const ecma_string_t *, ecma_property_t **);
 extern void ecma_lcache_invalidate (ecma_object_t *, ecma_string_t *, ecma_property_t *);
+extern void ecma_lcache_invalidate_unreachable (ecma_lcache_is_object_reachable_t);
+extern bool ecma_lcache_chain_lookup (ecma_object_t *, const ecma_string_t *, ecma_property_t **);
+extern void ecma_lcache_chain_insert (ecma_object_t *, ecma_string_t *, ecma_object_t *, ecma_property_t *);
+extern size_t ecma_lcache_get_invalidations_number (void);
+extern void ecma_lcache_get_stats (ecma_lcache_stats_t *);
 
 /**
  * @}
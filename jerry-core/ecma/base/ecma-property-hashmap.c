@@ -0,0 +1,341 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-property-hashmap.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmapropertyhashmap Property name hash maps
+ * @{
+ */
+
+/**
+ * Minimum number of entries of a hash map
+ */
+#define ECMA_PROPERTY_HASHMAP_MIN_SIZE 8
+
+/**
+ * Get the compressed pointers to the property pairs of a hash map
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_POINTERS(hashmap_p) ((mem_cpointer_t *) ((hashmap_p) + 1))
+
+/**
+ * Get the bit array of a hash map
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_BITS(hashmap_p) \
+  ((uint8_t *) (ECMA_PROPERTY_HASHMAP_GET_POINTERS (hashmap_p) + (hashmap_p)->max_property_count))
+
+/**
+ * Size of a hash map with the specified number of entries
+ */
+#define ECMA_PROPERTY_HASHMAP_SIZE(max_property_count) \
+  (sizeof (ecma_property_hashmap_t) \
+   + (max_property_count) * sizeof (mem_cpointer_t) \
+   + (max_property_count) / JERRY_BITSINBYTE)
+
+/**
+ * Get the bit of an entry
+ */
+#define ECMA_PROPERTY_HASHMAP_GET_BIT(bits_p, entry_index) \
+  (((bits_p)[(entry_index) / JERRY_BITSINBYTE] >> ((entry_index) % JERRY_BITSINBYTE)) & 0x1u)
+
+/**
+ * Set the bit of an entry
+ */
+#define ECMA_PROPERTY_HASHMAP_SET_BIT(bits_p, entry_index) \
+  ((bits_p)[(entry_index) / JERRY_BITSINBYTE] |= (uint8_t) (1u << ((entry_index) % JERRY_BITSINBYTE)))
+
+/**
+ * Get the hash map of an object
+ *
+ * @return pointer to the hash map
+ */
+static inline ecma_property_hashmap_t * __attr_always_inline___
+ecma_property_hashmap_get (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *property_list_p = ecma_get_property_list (object_p);
+
+  JERRY_ASSERT (property_list_p != NULL && ECMA_PROPERTY_IS_HASHMAP (property_list_p));
+
+  return (ecma_property_hashmap_t *) property_list_p;
+} /* ecma_property_hashmap_get */
+
+/**
+ * Insert a property into an unused entry of a hash map
+ */
+static void
+ecma_property_hashmap_insert_entry (ecma_property_hashmap_t *hashmap_p, /**< hash map */
+                                    ecma_string_t *name_p, /**< name of the property */
+                                    ecma_property_pair_t *property_pair_p, /**< property pair of the property */
+                                    uint32_t property_index) /**< index of the property in the pair */
+{
+  JERRY_ASSERT (hashmap_p->null_count > 1);
+
+  mem_cpointer_t *pointers_p = ECMA_PROPERTY_HASHMAP_GET_POINTERS (hashmap_p);
+  uint8_t *bits_p = ECMA_PROPERTY_HASHMAP_GET_BITS (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  uint32_t entry_index = ecma_string_hash (name_p) & mask;
+
+  /* Deleted entries are not reused, so the hash map is rebuilt after a series of insertions and deletions. */
+  while (pointers_p[entry_index] != ECMA_NULL_POINTER
+         || ECMA_PROPERTY_HASHMAP_GET_BIT (bits_p, entry_index) != 0)
+  {
+    entry_index = (entry_index + 1) & mask;
+  }
+
+  ECMA_SET_NON_NULL_POINTER (pointers_p[entry_index], property_pair_p);
+
+  if (property_index != 0)
+  {
+    ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
+  }
+
+  hashmap_p->property_count++;
+  hashmap_p->null_count--;
+} /* ecma_property_hashmap_insert_entry */
+
+/**
+ * Create a hash map for the property pair list of an object
+ *
+ * Note:
+ *      the hash map becomes the first item of the list
+ */
+void
+ecma_property_hashmap_create (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_header_t *first_property_p = ecma_get_property_list (object_p);
+
+  JERRY_ASSERT (first_property_p != NULL && ECMA_PROPERTY_IS_PROPERTY_PAIR (first_property_p));
+
+  uint32_t named_property_count = 0;
+
+  for (ecma_property_header_t *prop_iter_p = first_property_p;
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp))
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + i) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          || ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + i) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+      {
+        named_property_count++;
+      }
+    }
+  }
+
+  /* At most half of the entries are used after creation. */
+  uint32_t max_property_count = ECMA_PROPERTY_HASHMAP_MIN_SIZE;
+
+  while (max_property_count < named_property_count * 2)
+  {
+    max_property_count <<= 1;
+  }
+
+  size_t size = ECMA_PROPERTY_HASHMAP_SIZE (max_property_count);
+
+  /* The allocation might trigger garbage collection, so the property list is not changed before it. */
+  ecma_property_hashmap_t *hashmap_p = ecma_alloc_property_hashmap (size);
+
+  memset (hashmap_p, 0, size);
+
+  hashmap_p->header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_HASHMAP;
+  hashmap_p->header.types[1].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  hashmap_p->max_property_count = max_property_count;
+  hashmap_p->property_count = 0;
+  hashmap_p->null_count = max_property_count;
+
+  for (ecma_property_header_t *prop_iter_p = first_property_p;
+       prop_iter_p != NULL;
+       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t, prop_iter_p->next_property_cp))
+  {
+    ecma_property_pair_t *property_pair_p = (ecma_property_pair_t *) prop_iter_p;
+
+    for (uint32_t i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+    {
+      if (ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + i) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          || ECMA_PROPERTY_GET_TYPE (prop_iter_p->types + i) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
+      {
+        ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, property_pair_p->names_cp[i]);
+
+        ecma_property_hashmap_insert_entry (hashmap_p, name_p, property_pair_p, i);
+      }
+    }
+  }
+
+  JERRY_ASSERT (hashmap_p->property_count == named_property_count);
+
+  hashmap_p->header.next_property_cp = object_p->property_list_or_bound_object_cp;
+  ECMA_SET_NON_NULL_POINTER (object_p->property_list_or_bound_object_cp, hashmap_p);
+} /* ecma_property_hashmap_create */
+
+/**
+ * Free the hash map of an object
+ *
+ * Note:
+ *      property pairs, whose properties are all deleted, are also removed from the list
+ */
+void
+ecma_property_hashmap_free (ecma_object_t *object_p) /**< object */
+{
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  mem_cpointer_t *next_cp_p = &object_p->property_list_or_bound_object_cp;
+  *next_cp_p = hashmap_p->header.next_property_cp;
+
+  while (*next_cp_p != ECMA_NULL_POINTER)
+  {
+    ecma_property_header_t *prop_iter_p = ECMA_GET_NON_NULL_POINTER (ecma_property_header_t, *next_cp_p);
+
+    JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+    JERRY_ASSERT (ECMA_PROPERTY_PAIR_ITEM_COUNT == 2);
+
+    if (prop_iter_p->types[0].type_and_flags == ECMA_PROPERTY_TYPE_DELETED
+        && prop_iter_p->types[1].type_and_flags == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      *next_cp_p = prop_iter_p->next_property_cp;
+      ecma_dealloc_property_pair ((ecma_property_pair_t *) prop_iter_p);
+    }
+    else
+    {
+      next_cp_p = &prop_iter_p->next_property_cp;
+    }
+  }
+
+  ecma_dealloc_property_hashmap (hashmap_p, ECMA_PROPERTY_HASHMAP_SIZE (hashmap_p->max_property_count));
+} /* ecma_property_hashmap_free */
+
+/**
+ * Insert a newly created property into the hash map of an object
+ *
+ * Note:
+ *      the hash map is freed, if it has no more free entries, and it is rebuilt by a later
+ *      property lookup (see also: ecma_find_named_property), as the insertion must not allocate
+ */
+void
+ecma_property_hashmap_insert (ecma_object_t *object_p, /**< object */
+                              ecma_string_t *name_p, /**< name of the property */
+                              ecma_property_pair_t *property_pair_p, /**< property pair of the property */
+                              uint32_t property_index) /**< index of the property in the pair */
+{
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  /* At most three quarters of the entries are used, to keep the lookups short. */
+  if (hashmap_p->null_count <= hashmap_p->max_property_count / 4)
+  {
+    ecma_property_hashmap_free (object_p);
+    return;
+  }
+
+  ecma_property_hashmap_insert_entry (hashmap_p, name_p, property_pair_p, property_index);
+} /* ecma_property_hashmap_insert */
+
+/**
+ * Delete a property from the hash map of an object
+ *
+ * Note:
+ *      the property must be already freed, and the hash map is freed, if most of its entries are unused
+ */
+void
+ecma_property_hashmap_delete (ecma_object_t *object_p, /**< object */
+                              ecma_string_t *name_p, /**< name of the property */
+                              ecma_property_pair_t *property_pair_p, /**< property pair of the property */
+                              uint32_t property_index) /**< index of the property in the pair */
+{
+  ecma_property_hashmap_t *hashmap_p = ecma_property_hashmap_get (object_p);
+
+  JERRY_ASSERT (property_pair_p->header.types[property_index].type_and_flags == ECMA_PROPERTY_TYPE_DELETED);
+
+  mem_cpointer_t *pointers_p = ECMA_PROPERTY_HASHMAP_GET_POINTERS (hashmap_p);
+  uint8_t *bits_p = ECMA_PROPERTY_HASHMAP_GET_BITS (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  uint32_t entry_index = ecma_string_hash (name_p) & mask;
+
+  mem_cpointer_t property_pair_cp;
+  ECMA_SET_NON_NULL_POINTER (property_pair_cp, property_pair_p);
+
+  while (pointers_p[entry_index] != property_pair_cp
+         || ECMA_PROPERTY_HASHMAP_GET_BIT (bits_p, entry_index) != property_index)
+  {
+    JERRY_ASSERT (pointers_p[entry_index] != ECMA_NULL_POINTER
+                  || ECMA_PROPERTY_HASHMAP_GET_BIT (bits_p, entry_index) != 0);
+
+    entry_index = (entry_index + 1) & mask;
+  }
+
+  /* The entry becomes deleted: NULL pointer with set bit. */
+  pointers_p[entry_index] = ECMA_NULL_POINTER;
+  ECMA_PROPERTY_HASHMAP_SET_BIT (bits_p, entry_index);
+
+  JERRY_ASSERT (hashmap_p->property_count > 0);
+  hashmap_p->property_count--;
+
+  if (hashmap_p->property_count < hashmap_p->max_property_count / 8)
+  {
+    ecma_property_hashmap_free (object_p);
+  }
+} /* ecma_property_hashmap_delete */
+
+/**
+ * Find a named property in a hash map
+ *
+ * @return pointer to the property, if it is found,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_property_hashmap_find (ecma_property_hashmap_t *hashmap_p, /**< hash map */
+                            ecma_string_t *name_p) /**< property name */
+{
+  mem_cpointer_t *pointers_p = ECMA_PROPERTY_HASHMAP_GET_POINTERS (hashmap_p);
+  uint8_t *bits_p = ECMA_PROPERTY_HASHMAP_GET_BITS (hashmap_p);
+  uint32_t mask = hashmap_p->max_property_count - 1;
+  uint32_t entry_index = ecma_string_hash (name_p) & mask;
+
+  /* The search terminates, since the hash map always has unused entries. */
+  while (true)
+  {
+    uint32_t property_index = ECMA_PROPERTY_HASHMAP_GET_BIT (bits_p, entry_index);
+
+    if (pointers_p[entry_index] != ECMA_NULL_POINTER)
+    {
+      ecma_property_pair_t *property_pair_p = ECMA_GET_NON_NULL_POINTER (ecma_property_pair_t,
+                                                                         pointers_p[entry_index]);
+
+      ecma_string_t *property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                  property_pair_p->names_cp[property_index]);
+
+      if (ecma_compare_ecma_strings (name_p, property_name_p))
+      {
+        return property_pair_p->header.types + property_index;
+      }
+    }
+    else if (property_index == 0)
+    {
+      return NULL;
+    }
+
+    entry_index = (entry_index + 1) & mask;
+  }
+} /* ecma_property_hashmap_find */
+
+/**
+ * @}
+ * @}
+ */
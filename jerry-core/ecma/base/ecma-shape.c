@@ -0,0 +1,329 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-shape.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Shapes (hidden classes) of objects
+ * @{
+ */
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT <= UINT8_MAX,
+                     maximum_shape_property_count_must_fit_into_property_count_field_of_ecma_shape_t);
+
+JERRY_STATIC_ASSERT (CONFIG_ECMA_SHAPE_MAX_TRANSITION_COUNT <= UINT8_MAX,
+                     maximum_shape_transition_count_must_fit_into_transition_count_field_of_ecma_shape_t);
+
+/**
+ * Get the compressed pointers to the property names of a shape
+ */
+#define ECMA_SHAPE_GET_NAMES(shape_p) ((mem_cpointer_t *) ((shape_p) + 1))
+
+/**
+ * Get the hashes of the property names of a shape
+ */
+#define ECMA_SHAPE_GET_HASHES(shape_p) \
+  ((lit_string_hash_t *) (ECMA_SHAPE_GET_NAMES (shape_p) + (shape_p)->property_count))
+
+/**
+ * Size of a shape with the specified number of properties
+ */
+#define ECMA_SHAPE_SIZE(property_count) \
+  (sizeof (ecma_shape_t) + (property_count) * (sizeof (mem_cpointer_t) + sizeof (lit_string_hash_t)))
+
+/**
+ * First shape, which was transitioned from the empty shape
+ */
+static mem_cpointer_t ecma_shape_root_first_transition_cp = ECMA_NULL_POINTER;
+
+/**
+ * Number of shapes, which were transitioned from the empty shape
+ */
+static uint32_t ecma_shape_root_transition_count = 0;
+
+/**
+ * Finalize shapes
+ *
+ * Note:
+ *      all shapes must be released at this point, as their objects are already freed
+ */
+void
+ecma_finalize_shapes (void)
+{
+  JERRY_ASSERT (ecma_shape_root_first_transition_cp == ECMA_NULL_POINTER);
+  JERRY_ASSERT (ecma_shape_root_transition_count == 0);
+} /* ecma_finalize_shapes */
+
+/**
+ * Check whether the last property of a shape has the specified name
+ *
+ * @return true - if the names are equal (or both properties are internal properties),
+ *         false - otherwise
+ */
+static bool
+ecma_shape_is_last_property_name (const ecma_shape_t *shape_p, /**< shape */
+                                  ecma_string_t *name_p, /**< property name or NULL */
+                                  lit_string_hash_t hash) /**< hash of the name */
+{
+  JERRY_ASSERT (shape_p->property_count > 0);
+
+  uint32_t index = (uint32_t) shape_p->property_count - 1;
+  ecma_string_t *last_name_p = ECMA_GET_POINTER (ecma_string_t, ECMA_SHAPE_GET_NAMES (shape_p)[index]);
+
+  if (name_p == NULL || last_name_p == NULL)
+  {
+    return name_p == last_name_p;
+  }
+
+  return (ECMA_SHAPE_GET_HASHES (shape_p)[index] == hash
+          && ecma_compare_ecma_strings (name_p, last_name_p));
+} /* ecma_shape_is_last_property_name */
+
+/**
+ * Get the shape, which describes the properties of the specified shape and a new property
+ *
+ * Note:
+ *      the returned shape must be released with ecma_shape_deref
+ *
+ * @return pointer to the shape, if the transition is available,
+ *         NULL - if the maximum number of properties or transitions is reached
+ */
+ecma_shape_t *
+ecma_shape_get_transition (ecma_shape_t *shape_p, /**< shape, or NULL (empty shape) */
+                           ecma_string_t *name_p) /**< name of the new property, or NULL (internal property) */
+{
+  mem_cpointer_t *first_transition_cp_p;
+  uint32_t transition_count;
+  uint32_t property_count;
+
+  if (shape_p == NULL)
+  {
+    first_transition_cp_p = &ecma_shape_root_first_transition_cp;
+    transition_count = ecma_shape_root_transition_count;
+    property_count = 0;
+  }
+  else
+  {
+    first_transition_cp_p = &shape_p->first_transition_cp;
+    transition_count = shape_p->transition_count;
+    property_count = shape_p->property_count;
+  }
+
+  lit_string_hash_t hash = (name_p != NULL) ? ecma_string_hash (name_p) : 0;
+
+  ecma_shape_t *transition_p = ECMA_GET_POINTER (ecma_shape_t, *first_transition_cp_p);
+
+  while (transition_p != NULL)
+  {
+    if (ecma_shape_is_last_property_name (transition_p, name_p, hash))
+    {
+      JERRY_ASSERT (transition_p->refs < UINT32_MAX);
+      transition_p->refs++;
+      return transition_p;
+    }
+
+    transition_p = ECMA_GET_POINTER (ecma_shape_t, transition_p->next_transition_cp);
+  }
+
+  if (property_count >= CONFIG_ECMA_SHAPE_MAX_PROPERTY_COUNT
+      || transition_count >= CONFIG_ECMA_SHAPE_MAX_TRANSITION_COUNT)
+  {
+    return NULL;
+  }
+
+  transition_p = ecma_alloc_shape (ECMA_SHAPE_SIZE (property_count + 1));
+
+  transition_p->refs = 1;
+  ECMA_SET_POINTER (transition_p->parent_cp, shape_p);
+  transition_p->first_transition_cp = ECMA_NULL_POINTER;
+  transition_p->next_transition_cp = *first_transition_cp_p;
+  transition_p->property_count = (uint8_t) (property_count + 1);
+  transition_p->transition_count = 0;
+
+  mem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (transition_p);
+  lit_string_hash_t *hashes_p = ECMA_SHAPE_GET_HASHES (transition_p);
+
+  if (shape_p != NULL)
+  {
+    mem_cpointer_t *parent_names_cp_p = ECMA_SHAPE_GET_NAMES (shape_p);
+
+    for (uint32_t i = 0; i < property_count; i++)
+    {
+      ecma_string_t *parent_name_p = ECMA_GET_POINTER (ecma_string_t, parent_names_cp_p[i]);
+
+      if (parent_name_p != NULL)
+      {
+        parent_name_p = ecma_copy_or_ref_ecma_string (parent_name_p);
+      }
+
+      ECMA_SET_POINTER (names_cp_p[i], parent_name_p);
+    }
+
+    memcpy (hashes_p, ECMA_SHAPE_GET_HASHES (shape_p), property_count * sizeof (lit_string_hash_t));
+
+    /* The new shape references its parent. */
+    shape_p->refs++;
+    shape_p->transition_count++;
+  }
+  else
+  {
+    ecma_shape_root_transition_count++;
+  }
+
+  if (name_p != NULL)
+  {
+    name_p = ecma_copy_or_ref_ecma_string (name_p);
+  }
+
+  ECMA_SET_POINTER (names_cp_p[property_count], name_p);
+  hashes_p[property_count] = hash;
+
+  ECMA_SET_NON_NULL_POINTER (*first_transition_cp_p, transition_p);
+
+  return transition_p;
+} /* ecma_shape_get_transition */
+
+/**
+ * Acquire a reference to a shape
+ *
+ * Note:
+ *      the reference must be released with ecma_shape_deref
+ */
+void
+ecma_shape_ref (ecma_shape_t *shape_p) /**< shape */
+{
+  JERRY_ASSERT (shape_p != NULL && shape_p->refs > 0);
+  JERRY_ASSERT (shape_p->refs < UINT32_MAX);
+
+  shape_p->refs++;
+} /* ecma_shape_ref */
+
+/**
+ * Release a reference to a shape, and free the shape (and its unused ancestors),
+ * when it is no longer referenced.
+ */
+void
+ecma_shape_deref (ecma_shape_t *shape_p) /**< shape */
+{
+  while (shape_p != NULL)
+  {
+    JERRY_ASSERT (shape_p->refs > 0);
+
+    if (--shape_p->refs > 0)
+    {
+      return;
+    }
+
+    JERRY_ASSERT (shape_p->first_transition_cp == ECMA_NULL_POINTER
+                  && shape_p->transition_count == 0);
+
+    ecma_shape_t *parent_p = ECMA_GET_POINTER (ecma_shape_t, shape_p->parent_cp);
+    mem_cpointer_t *transition_cp_p;
+
+    if (parent_p != NULL)
+    {
+      JERRY_ASSERT (parent_p->transition_count > 0);
+      parent_p->transition_count--;
+      transition_cp_p = &parent_p->first_transition_cp;
+    }
+    else
+    {
+      JERRY_ASSERT (ecma_shape_root_transition_count > 0);
+      ecma_shape_root_transition_count--;
+      transition_cp_p = &ecma_shape_root_first_transition_cp;
+    }
+
+    /* Unlink the shape from the transitions of its parent. */
+    while (ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *transition_cp_p) != shape_p)
+    {
+      transition_cp_p = &ECMA_GET_NON_NULL_POINTER (ecma_shape_t, *transition_cp_p)->next_transition_cp;
+    }
+
+    *transition_cp_p = shape_p->next_transition_cp;
+
+    mem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (shape_p);
+
+    for (uint32_t i = 0; i < shape_p->property_count; i++)
+    {
+      ecma_string_t *name_p = ECMA_GET_POINTER (ecma_string_t, names_cp_p[i]);
+
+      if (name_p != NULL)
+      {
+        ecma_deref_ecma_string (name_p);
+      }
+    }
+
+    ecma_dealloc_shape (shape_p, ECMA_SHAPE_SIZE (shape_p->property_count));
+
+    shape_p = parent_p;
+  }
+} /* ecma_shape_deref */
+
+/**
+ * Find a named property in a shape
+ *
+ * @return index of the property, if the shape has a property with the name,
+ *         ECMA_SHAPE_PROPERTY_NOT_FOUND - otherwise
+ */
+uint32_t
+ecma_shape_find_property (const ecma_shape_t *shape_p, /**< shape */
+                          ecma_string_t *name_p) /**< property name */
+{
+  JERRY_ASSERT (shape_p != NULL && name_p != NULL);
+
+  lit_string_hash_t hash = ecma_string_hash (name_p);
+  const mem_cpointer_t *names_cp_p = ECMA_SHAPE_GET_NAMES (shape_p);
+  const lit_string_hash_t *hashes_p = ECMA_SHAPE_GET_HASHES (shape_p);
+
+  for (uint32_t i = 0; i < shape_p->property_count; i++)
+  {
+    if (hashes_p[i] == hash && names_cp_p[i] != ECMA_NULL_POINTER)
+    {
+      ecma_string_t *property_name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, names_cp_p[i]);
+
+      if (ecma_compare_ecma_strings (name_p, property_name_p))
+      {
+        return i;
+      }
+    }
+  }
+
+  return ECMA_SHAPE_PROPERTY_NOT_FOUND;
+} /* ecma_shape_find_property */
+
+/**
+ * Get the name of a property described by a shape
+ *
+ * @return pointer to the name (the reference is not incremented),
+ *         NULL - if the property is an internal property
+ */
+ecma_string_t *
+ecma_shape_get_property_name (const ecma_shape_t *shape_p, /**< shape */
+                              uint32_t index) /**< index of the property */
+{
+  JERRY_ASSERT (shape_p != NULL && index < shape_p->property_count);
+
+  return ECMA_GET_POINTER (ecma_string_t, ECMA_SHAPE_GET_NAMES (shape_p)[index]);
+} /* ecma_shape_get_property_name */
+
+/**
+ * @}
+ * @}
+ */
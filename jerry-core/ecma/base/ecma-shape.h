@@ -0,0 +1,45 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_SHAPE_H
+#define ECMA_SHAPE_H
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmashape Shapes (hidden classes) of objects
+ * @{
+ */
+
+/**
+ * Index, which is returned by ecma_shape_find_property, if the shape has no property with the name
+ */
+#define ECMA_SHAPE_PROPERTY_NOT_FOUND UINT32_MAX
+
+extern void ecma_finalize_shapes (void);
+extern ecma_shape_t *ecma_shape_get_transition (ecma_shape_t *, ecma_string_t *);
+extern void ecma_shape_ref (ecma_shape_t *);
+extern void ecma_shape_deref (ecma_shape_t *);
+extern uint32_t ecma_shape_find_property (const ecma_shape_t *, ecma_string_t *);
+extern ecma_string_t *ecma_shape_get_property_name (const ecma_shape_t *, uint32_t);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !ECMA_SHAPE_H */
@@ -1026,7 +1026,7 @@ ecma_builtin_array_prototype_object_sort_compare_helper (ecma_value_t j, /**< le
         }
         else
         {
-          *result_p = *ecma_get_number_from_value (call_value);
+          *result_p = ecma_get_number_from_value (call_value);
         }
 
         ECMA_FINALIZE (call_value);
@@ -1080,7 +1080,7 @@ ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[],
       JERRY_ASSERT (ecma_is_value_number (child_compare_value));
 
       /* Use the child that is greater. */
-      if (*ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
+      if (ecma_get_number_from_value (child_compare_value) < ECMA_NUMBER_ZERO)
       {
         child++;
       }
@@ -1100,7 +1100,7 @@ ecma_builtin_array_prototype_object_array_to_heap_helper (ecma_value_t array[],
                       ret_value);
       JERRY_ASSERT (ecma_is_value_number (swap_compare_value));
 
-      if (*ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
+      if (ecma_get_number_from_value (swap_compare_value) <= ECMA_NUMBER_ZERO)
       {
         /* Break from loop if current child is less than swap (tree top) */
         should_break = true;
@@ -23,7 +23,7 @@
 #endif /* !OBJECT_ID */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 #ifndef NUMBER_VALUE
@@ -38,17 +38,17 @@
 OBJECT_ID (ECMA_BUILTIN_ID_ARRAY_PROTOTYPE)
 
 /* Object properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.4.4.1
 OBJECT_VALUE (LIT_MAGIC_STRING_CONSTRUCTOR,
-              ecma_builtin_get (ECMA_BUILTIN_ID_ARRAY),
+              ECMA_BUILTIN_ID_ARRAY,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
 
 /* Number properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.4.4
 NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
@@ -88,4 +88,5 @@ ROUTINE (LIT_MAGIC_STRING_REDUCE_RIGHT_UL, ecma_builtin_array_prototype_object_r
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
 
@@ -0,0 +1,151 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-arraybuffer-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID arraybuffer_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup arraybufferprototype ECMA ArrayBuffer.prototype object built-in
+ * @{
+ */
+
+/**
+ * The ArrayBuffer.prototype object's 'byteLength' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.4.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_arraybuffer_prototype_bytelength_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_arraybuffer_t *arraybuffer_p = NULL;
+
+  if (ecma_is_value_object (this_arg))
+  {
+    arraybuffer_p = ecma_op_get_arraybuffer (ecma_get_object_from_value (this_arg));
+  }
+
+  if (arraybuffer_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_number_t *length_p = ecma_alloc_number ();
+  *length_p = (ecma_number_t) arraybuffer_p->length;
+
+  return ecma_make_number_value (length_p);
+} /* ecma_builtin_arraybuffer_prototype_bytelength_getter */
+
+/**
+ * The ArrayBuffer.prototype object's 'slice' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.4.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_arraybuffer_prototype_object_slice (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< start */
+                                                 ecma_value_t arg2) /**< end */
+{
+  ecma_arraybuffer_t *arraybuffer_p = NULL;
+
+  if (ecma_is_value_object (this_arg))
+  {
+    arraybuffer_p = ecma_op_get_arraybuffer (ecma_get_object_from_value (this_arg));
+  }
+
+  if (arraybuffer_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  const uint32_t len = arraybuffer_p->length;
+  uint32_t start = 0, end = len;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (start_num, arg1, ret_value);
+
+  start = ecma_builtin_helper_array_index_normalize (start_num, len);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, len);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (start_num);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    JERRY_ASSERT (start <= len && end <= len);
+
+    uint32_t new_len = (end > start) ? (end - start) : 0;
+
+    ECMA_TRY_CATCH (new_arraybuffer_value,
+                    ecma_op_create_arraybuffer_object (new_len),
+                    ret_value);
+
+    ecma_object_t *new_arraybuffer_obj_p = ecma_get_object_from_value (new_arraybuffer_value);
+    ecma_arraybuffer_t *new_arraybuffer_p = ecma_op_get_arraybuffer (new_arraybuffer_obj_p);
+
+    memcpy (new_arraybuffer_p->buffer_p, arraybuffer_p->buffer_p + start, new_len);
+
+    ret_value = ecma_copy_value (new_arraybuffer_value);
+
+    ECMA_FINALIZE (new_arraybuffer_value);
+  }
+
+  return ret_value;
+} /* ecma_builtin_arraybuffer_prototype_object_slice */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
@@ -0,0 +1,123 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-arraybuffer.inc.h"
+#define BUILTIN_UNDERSCORED_ID arraybuffer
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup arraybuffer ECMA ArrayBuffer object built-in
+ * @{
+ */
+
+/**
+ * The ArrayBuffer object's 'isView' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.3.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_arraybuffer_object_is_view (ecma_value_t this_arg __attr_unused___, /**< 'this' argument */
+                                         ecma_value_t arg) /**< argument 1 */
+{
+  bool is_view = false;
+
+  if (ecma_is_value_object (arg))
+  {
+    ecma_object_t *obj_p = ecma_get_object_from_value (arg);
+
+    is_view = (ecma_op_get_typedarray (obj_p) != NULL || ecma_op_get_dataview (obj_p) != NULL);
+  }
+
+  return ecma_make_simple_value (is_view ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+} /* ecma_builtin_arraybuffer_object_is_view */
+
+/**
+ * Handle calling [[Call]] of built-in ArrayBuffer object
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.2.1 step 1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_arraybuffer_dispatch_call (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                        ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG (""));
+} /* ecma_builtin_arraybuffer_dispatch_call */
+
+/**
+ * Handle calling [[Construct]] of built-in ArrayBuffer object
+ *
+ * See also:
+ *          ECMA-262 v6, 24.1.2.1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_arraybuffer_dispatch_construct (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                             ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_value_t length_value = ((arguments_list_len > 0) ? arguments_list_p[0]
+                                                        : ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+  uint32_t length = 0;
+
+  ECMA_TRY_CATCH (length_completion,
+                  ecma_op_typedarray_to_index (length_value, &length),
+                  ret_value);
+
+  ret_value = ecma_op_create_arraybuffer_object (length);
+
+  ECMA_FINALIZE (length_completion);
+
+  return ret_value;
+} /* ecma_builtin_arraybuffer_dispatch_construct */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
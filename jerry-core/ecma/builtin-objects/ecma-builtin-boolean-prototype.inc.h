@@ -22,7 +22,7 @@
 #endif /* !OBJECT_ID */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 #ifndef ROUTINE
@@ -33,11 +33,11 @@
 OBJECT_ID (ECMA_BUILTIN_ID_BOOLEAN_PROTOTYPE)
 
 /* Object properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.6.4.1
 OBJECT_VALUE (LIT_MAGIC_STRING_CONSTRUCTOR,
-              ecma_builtin_get (ECMA_BUILTIN_ID_BOOLEAN),
+              ECMA_BUILTIN_ID_BOOLEAN,
               ECMA_PROPERTY_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_CONFIGURABLE)
@@ -54,3 +54,4 @@ ROUTINE (LIT_MAGIC_STRING_VALUE_OF_UL,  ecma_builtin_boolean_prototype_object_va
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -22,7 +22,7 @@
 #endif /* !OBJECT_ID */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 #ifndef NUMBER_VALUE
@@ -37,17 +37,17 @@
 OBJECT_ID (ECMA_BUILTIN_ID_BOOLEAN)
 
 /* Object properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.6.3.1
 OBJECT_VALUE (LIT_MAGIC_STRING_PROTOTYPE,
-              ecma_builtin_get (ECMA_BUILTIN_ID_BOOLEAN_PROTOTYPE),
+              ECMA_BUILTIN_ID_BOOLEAN_PROTOTYPE,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 /* Number properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.6.3
 NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
@@ -63,3 +63,4 @@ NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -0,0 +1,557 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-dataview-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID dataview_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup dataviewprototype ECMA DataView.prototype object built-in
+ * @{
+ */
+
+/**
+ * Get the view of the 'this' argument of the DataView.prototype routines
+ *
+ * @return pointer to the view - if the argument is a DataView object,
+ *         NULL - otherwise
+ */
+static ecma_typedarray_t *
+ecma_builtin_dataview_prototype_get_dataview (ecma_value_t this_arg) /**< this argument */
+{
+  if (!ecma_is_value_object (this_arg))
+  {
+    return NULL;
+  }
+
+  return ecma_op_get_dataview (ecma_get_object_from_value (this_arg));
+} /* ecma_builtin_dataview_prototype_get_dataview */
+
+/**
+ * The DataView.prototype object's 'buffer' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_buffer_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *dataview_p = ecma_builtin_dataview_prototype_get_dataview (this_arg);
+
+  if (dataview_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_object_t *arraybuffer_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, dataview_p->arraybuffer_cp);
+  ecma_ref_object (arraybuffer_obj_p);
+
+  return ecma_make_object_value (arraybuffer_obj_p);
+} /* ecma_builtin_dataview_prototype_buffer_getter */
+
+/**
+ * The DataView.prototype object's 'byteLength' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_bytelength_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *dataview_p = ecma_builtin_dataview_prototype_get_dataview (this_arg);
+
+  if (dataview_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = (ecma_number_t) dataview_p->length;
+
+  return ecma_make_number_value (num_p);
+} /* ecma_builtin_dataview_prototype_bytelength_getter */
+
+/**
+ * The DataView.prototype object's 'byteOffset' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_byteoffset_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *dataview_p = ecma_builtin_dataview_prototype_get_dataview (this_arg);
+
+  if (dataview_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = (ecma_number_t) dataview_p->byte_offset;
+
+  return ecma_make_number_value (num_p);
+} /* ecma_builtin_dataview_prototype_byteoffset_getter */
+
+/**
+ * Reverse the byte order of a number, if the requested byte order differs from the native byte order
+ */
+static void
+ecma_builtin_dataview_prototype_swap_bytes (uint8_t *bytes_p, /**< bytes of the number */
+                                            uint32_t size, /**< size of the number */
+                                            ecma_value_t little_endian_arg) /**< littleEndian argument */
+{
+  const uint16_t byte_order_probe = 1;
+  bool is_native_little_endian = (*((const uint8_t *) &byte_order_probe) == 1);
+
+  if (ecma_is_value_true (ecma_op_to_boolean (little_endian_arg)) == is_native_little_endian)
+  {
+    return;
+  }
+
+  for (uint32_t i = 0; i < size / 2; i++)
+  {
+    uint8_t byte = bytes_p[i];
+    bytes_p[i] = bytes_p[size - 1 - i];
+    bytes_p[size - 1 - i] = byte;
+  }
+} /* ecma_builtin_dataview_prototype_swap_bytes */
+
+/**
+ * GetViewValue operation of the DataView.prototype routines
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.1.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_get_view_value (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t byte_offset_arg, /**< byteOffset */
+                                                ecma_value_t little_endian_arg, /**< littleEndian */
+                                                ecma_typedarray_type_t type) /**< type of the value */
+{
+  ecma_typedarray_t *dataview_p = ecma_builtin_dataview_prototype_get_dataview (this_arg);
+
+  if (dataview_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t byte_offset = 0;
+
+  ECMA_TRY_CATCH (byte_offset_completion,
+                  ecma_op_typedarray_to_index (byte_offset_arg, &byte_offset),
+                  ret_value);
+
+  uint32_t size = ecma_op_typedarray_get_element_size (type);
+
+  if (byte_offset > dataview_p->length || size > dataview_p->length - byte_offset)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else
+  {
+    uint8_t bytes[sizeof (double)];
+
+    memcpy (bytes, dataview_p->buffer_p + byte_offset, size);
+    ecma_builtin_dataview_prototype_swap_bytes (bytes, size, little_endian_arg);
+
+    ecma_number_t *num_p = ecma_alloc_number ();
+    *num_p = ecma_op_typedarray_read_number (type, bytes);
+
+    ret_value = ecma_make_number_value (num_p);
+  }
+
+  ECMA_FINALIZE (byte_offset_completion);
+
+  return ret_value;
+} /* ecma_builtin_dataview_prototype_get_view_value */
+
+/**
+ * SetViewValue operation of the DataView.prototype routines
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.1.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_set_view_value (ecma_value_t this_arg, /**< this argument */
+                                                ecma_value_t byte_offset_arg, /**< byteOffset */
+                                                ecma_value_t value_arg, /**< value */
+                                                ecma_value_t little_endian_arg, /**< littleEndian */
+                                                ecma_typedarray_type_t type) /**< type of the value */
+{
+  ecma_typedarray_t *dataview_p = ecma_builtin_dataview_prototype_get_dataview (this_arg);
+
+  if (dataview_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t byte_offset = 0;
+
+  ECMA_TRY_CATCH (byte_offset_completion,
+                  ecma_op_typedarray_to_index (byte_offset_arg, &byte_offset),
+                  ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, value_arg, ret_value);
+
+  uint32_t size = ecma_op_typedarray_get_element_size (type);
+
+  if (byte_offset > dataview_p->length || size > dataview_p->length - byte_offset)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else
+  {
+    uint8_t bytes[sizeof (double)];
+
+    ecma_op_typedarray_write_number (type, bytes, num);
+    ecma_builtin_dataview_prototype_swap_bytes (bytes, size, little_endian_arg);
+    memcpy (dataview_p->buffer_p + byte_offset, bytes, size);
+
+    ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+  ECMA_FINALIZE (byte_offset_completion);
+
+  return ret_value;
+} /* ecma_builtin_dataview_prototype_set_view_value */
+
+/**
+ * The DataView.prototype object's 'getInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.8
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int8 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byteOffset */
+                                                 ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_INT8);
+} /* ecma_builtin_dataview_prototype_object_get_int8 */
+
+/**
+ * The DataView.prototype object's 'getUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.11
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint8 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_UINT8);
+} /* ecma_builtin_dataview_prototype_object_get_uint8 */
+
+/**
+ * The DataView.prototype object's 'getInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.9
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int16 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_INT16);
+} /* ecma_builtin_dataview_prototype_object_get_int16 */
+
+/**
+ * The DataView.prototype object's 'getUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.12
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint16 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byteOffset */
+                                                   ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_UINT16);
+} /* ecma_builtin_dataview_prototype_object_get_uint16 */
+
+/**
+ * The DataView.prototype object's 'getInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.10
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_int32 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_INT32);
+} /* ecma_builtin_dataview_prototype_object_get_int32 */
+
+/**
+ * The DataView.prototype object's 'getUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.13
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_uint32 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byteOffset */
+                                                   ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_UINT32);
+} /* ecma_builtin_dataview_prototype_object_get_uint32 */
+
+/**
+ * The DataView.prototype object's 'getFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.6
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float32 (ecma_value_t this_arg, /**< this argument */
+                                                    ecma_value_t arg1, /**< byteOffset */
+                                                    ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_FLOAT32);
+} /* ecma_builtin_dataview_prototype_object_get_float32 */
+
+/**
+ * The DataView.prototype object's 'getFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.7
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_get_float64 (ecma_value_t this_arg, /**< this argument */
+                                                    ecma_value_t arg1, /**< byteOffset */
+                                                    ecma_value_t arg2) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_get_view_value (this_arg, arg1, arg2, ECMA_TYPEDARRAY_FLOAT64);
+} /* ecma_builtin_dataview_prototype_object_get_float64 */
+
+/**
+ * The DataView.prototype object's 'setInt8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.15
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int8 (ecma_value_t this_arg, /**< this argument */
+                                                 ecma_value_t arg1, /**< byteOffset */
+                                                 ecma_value_t arg2, /**< value */
+                                                 ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_INT8);
+} /* ecma_builtin_dataview_prototype_object_set_int8 */
+
+/**
+ * The DataView.prototype object's 'setUint8' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.18
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint8 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2, /**< value */
+                                                  ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_UINT8);
+} /* ecma_builtin_dataview_prototype_object_set_uint8 */
+
+/**
+ * The DataView.prototype object's 'setInt16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.16
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int16 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2, /**< value */
+                                                  ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_INT16);
+} /* ecma_builtin_dataview_prototype_object_set_int16 */
+
+/**
+ * The DataView.prototype object's 'setUint16' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.19
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint16 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byteOffset */
+                                                   ecma_value_t arg2, /**< value */
+                                                   ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_UINT16);
+} /* ecma_builtin_dataview_prototype_object_set_uint16 */
+
+/**
+ * The DataView.prototype object's 'setInt32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.17
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_int32 (ecma_value_t this_arg, /**< this argument */
+                                                  ecma_value_t arg1, /**< byteOffset */
+                                                  ecma_value_t arg2, /**< value */
+                                                  ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_INT32);
+} /* ecma_builtin_dataview_prototype_object_set_int32 */
+
+/**
+ * The DataView.prototype object's 'setUint32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.20
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_uint32 (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< byteOffset */
+                                                   ecma_value_t arg2, /**< value */
+                                                   ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_UINT32);
+} /* ecma_builtin_dataview_prototype_object_set_uint32 */
+
+/**
+ * The DataView.prototype object's 'setFloat32' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.13
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float32 (ecma_value_t this_arg, /**< this argument */
+                                                    ecma_value_t arg1, /**< byteOffset */
+                                                    ecma_value_t arg2, /**< value */
+                                                    ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_FLOAT32);
+} /* ecma_builtin_dataview_prototype_object_set_float32 */
+
+/**
+ * The DataView.prototype object's 'setFloat64' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 24.2.4.14
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_dataview_prototype_object_set_float64 (ecma_value_t this_arg, /**< this argument */
+                                                    ecma_value_t arg1, /**< byteOffset */
+                                                    ecma_value_t arg2, /**< value */
+                                                    ecma_value_t arg3) /**< littleEndian */
+{
+  return ecma_builtin_dataview_prototype_set_view_value (this_arg, arg1, arg2, arg3, ECMA_TYPEDARRAY_FLOAT64);
+} /* ecma_builtin_dataview_prototype_object_set_float64 */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
@@ -91,8 +91,8 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   ECMA_TRY_CATCH (year_value, ecma_op_to_number (args[0]), ret_value);
   ECMA_TRY_CATCH (month_value, ecma_op_to_number (args[1]), ret_value);
 
-  ecma_number_t year = *ecma_get_number_from_value (year_value);
-  ecma_number_t month = *ecma_get_number_from_value (month_value);
+  ecma_number_t year = ecma_get_number_from_value (year_value);
+  ecma_number_t month = ecma_get_number_from_value (month_value);
   ecma_number_t date = ECMA_NUMBER_ONE;
   ecma_number_t hours = ECMA_NUMBER_ZERO;
   ecma_number_t minutes = ECMA_NUMBER_ZERO;
@@ -103,7 +103,7 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   if (args_len >= 3 && ecma_is_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (date_value, ecma_op_to_number (args[2]), ret_value);
-    date = *ecma_get_number_from_value (date_value);
+    date = ecma_get_number_from_value (date_value);
     ECMA_FINALIZE (date_value);
   }
 
@@ -111,7 +111,7 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   if (args_len >= 4 && ecma_is_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (hours_value, ecma_op_to_number (args[3]), ret_value);
-    hours = *ecma_get_number_from_value (hours_value);
+    hours = ecma_get_number_from_value (hours_value);
     ECMA_FINALIZE (hours_value);
   }
 
@@ -119,7 +119,7 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   if (args_len >= 5 && ecma_is_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (minutes_value, ecma_op_to_number (args[4]), ret_value);
-    minutes = *ecma_get_number_from_value (minutes_value);
+    minutes = ecma_get_number_from_value (minutes_value);
     ECMA_FINALIZE (minutes_value);
   }
 
@@ -127,7 +127,7 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   if (args_len >= 6 && ecma_is_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (seconds_value, ecma_op_to_number (args[5]), ret_value);
-    seconds = *ecma_get_number_from_value (seconds_value);
+    seconds = ecma_get_number_from_value (seconds_value);
     ECMA_FINALIZE (seconds_value);
   }
 
@@ -135,7 +135,7 @@ ecma_date_construct_helper (const ecma_value_t *args, /**< arguments passed to t
   if (args_len >= 7 && ecma_is_value_empty (ret_value))
   {
     ECMA_TRY_CATCH (milliseconds_value, ecma_op_to_number (args[6]), ret_value);
-    milliseconds = *ecma_get_number_from_value (milliseconds_value);
+    milliseconds = ecma_get_number_from_value (milliseconds_value);
     ECMA_FINALIZE (milliseconds_value);
   }
 
@@ -427,9 +427,9 @@ ecma_builtin_date_utc (ecma_value_t this_arg __attr_unused___, /**< this argumen
 
   ECMA_TRY_CATCH (time_value, ecma_date_construct_helper (args, args_number), ret_value);
 
-  ecma_number_t *time_p = ecma_get_number_from_value (time_value);
+  ecma_number_t time = ecma_get_number_from_value (time_value);
   ecma_number_t *time_clip_p = ecma_alloc_number ();
-  *time_clip_p = ecma_date_time_clip (*time_p);
+  *time_clip_p = ecma_date_time_clip (time);
   ret_value = ecma_make_number_value (time_clip_p);
 
   ECMA_FINALIZE (time_value);
@@ -484,7 +484,7 @@ ecma_builtin_date_dispatch_call (const ecma_value_t *arguments_list_p __attr_unu
                   ecma_builtin_date_now (ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED)),
                   ret_value);
 
-  ret_value = ecma_date_value_to_string (*ecma_get_number_from_value (now_val));
+  ret_value = ecma_date_value_to_string (ecma_get_number_from_value (now_val));
 
   ECMA_FINALIZE (now_val);
 
@@ -519,7 +519,7 @@ ecma_builtin_date_dispatch_construct (const ecma_value_t *arguments_list_p, /**<
                     ret_value);
 
     prim_value_num_p = ecma_alloc_number ();
-    *prim_value_num_p = *ecma_get_number_from_value (parse_res_value);
+    *prim_value_num_p = ecma_get_number_from_value (parse_res_value);
 
     ECMA_FINALIZE (parse_res_value)
   }
@@ -536,7 +536,7 @@ ecma_builtin_date_dispatch_construct (const ecma_value_t *arguments_list_p, /**<
                       ret_value);
 
       prim_value_num_p = ecma_alloc_number ();
-      *prim_value_num_p = *ecma_get_number_from_value (parse_res_value);
+      *prim_value_num_p = ecma_get_number_from_value (parse_res_value);
 
       ECMA_FINALIZE (parse_res_value);
     }
@@ -545,7 +545,7 @@ ecma_builtin_date_dispatch_construct (const ecma_value_t *arguments_list_p, /**<
       ECMA_TRY_CATCH (prim_value, ecma_op_to_number (arguments_list_p[0]), ret_value);
 
       prim_value_num_p = ecma_alloc_number ();
-      *prim_value_num_p = ecma_date_time_clip (*ecma_get_number_from_value (prim_value));
+      *prim_value_num_p = ecma_date_time_clip (ecma_get_number_from_value (prim_value));
 
       ECMA_FINALIZE (prim_value);
     }
@@ -558,9 +558,9 @@ ecma_builtin_date_dispatch_construct (const ecma_value_t *arguments_list_p, /**<
                     ecma_date_construct_helper (arguments_list_p, arguments_list_len),
                     ret_value);
 
-    ecma_number_t *time_p = ecma_get_number_from_value (time_value);
+    ecma_number_t time = ecma_get_number_from_value (time_value);
     prim_value_num_p = ecma_alloc_number ();
-    *prim_value_num_p = ecma_date_time_clip (ecma_date_utc (*time_p));
+    *prim_value_num_p = ecma_date_time_clip (ecma_date_utc (time));
 
     ECMA_FINALIZE (time_value);
   }
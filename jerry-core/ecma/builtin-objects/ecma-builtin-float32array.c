@@ -0,0 +1,82 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-float32array.inc.h"
+#define BUILTIN_UNDERSCORED_ID float32array
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup float32array ECMA Float32Array object built-in
+ * @{
+ */
+
+/**
+ * Handle calling [[Call]] of built-in Float32Array object
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.4.1 step 1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_float32array_dispatch_call (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                         ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  return ecma_raise_type_error (ECMA_ERR_MSG (""));
+} /* ecma_builtin_float32array_dispatch_call */
+
+/**
+ * Handle calling [[Construct]] of built-in Float32Array object
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.4.1
+ *
+ * @return ecma value
+ */
+ecma_value_t
+ecma_builtin_float32array_dispatch_construct (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                              ecma_length_t arguments_list_len) /**< number of arguments */
+{
+  return ecma_op_create_typedarray_object (arguments_list_p, arguments_list_len, ECMA_TYPEDARRAY_FLOAT32);
+} /* ecma_builtin_float32array_dispatch_construct */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
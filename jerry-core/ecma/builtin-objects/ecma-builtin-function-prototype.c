@@ -247,6 +247,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
                                                             ECMA_INTERNAL_PROPERTY_BOUND_FUNCTION_TARGET_FUNCTION);
 
     ecma_object_t *this_arg_obj_p = ecma_get_object_from_value (this_arg);
+    ecma_gc_write_barrier (function_p, this_arg_obj_p);
     ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (target_function_prop_p)->value, this_arg_obj_p);
 
     /* 8. */
@@ -256,6 +257,11 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
 
     if (arg_count > 0)
     {
+      if (ecma_is_value_object (arguments_list_p[0]))
+      {
+        ecma_gc_write_barrier (function_p, ecma_get_object_from_value (arguments_list_p[0]));
+      }
+
       ecma_set_internal_property_value (bound_this_prop_p,
                                         ecma_copy_value_if_not_object (arguments_list_p[0]));
     }
@@ -267,6 +273,14 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
 
     if (arg_count > 1)
     {
+      for (ecma_length_t i = 1; i < arg_count; i++)
+      {
+        if (ecma_is_value_object (arguments_list_p[i]))
+        {
+          ecma_gc_write_barrier (function_p, ecma_get_object_from_value (arguments_list_p[i]));
+        }
+      }
+
       ecma_collection_header_t *bound_args_collection_p;
       bound_args_collection_p = ecma_new_values_collection (&arguments_list_p[1], arg_count - 1, false);
 
@@ -294,7 +308,7 @@ ecma_builtin_function_prototype_object_bind (ecma_value_t this_arg, /**< this ar
       const ecma_length_t bound_arg_count = arg_count > 1 ? arg_count - 1 : 0;
 
       /* 15.a */
-      *length_p = *ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
+      *length_p = ecma_get_number_from_value (get_len_value) - ((ecma_number_t) bound_arg_count);
       ecma_free_value (get_len_value);
 
       /* 15.b */
@@ -0,0 +1,23 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Int16Array.prototype built-in description
+ */
+
+#define TYPEDARRAY_PROTOTYPE_BUILTIN_ID ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE
+#define TYPEDARRAY_BUILTIN_ID ECMA_BUILTIN_ID_INT16ARRAY
+#define TYPEDARRAY_BYTES_PER_ELEMENT 2
+#include "ecma-builtin-typedarray-prototype-template.inc.h"
@@ -710,10 +710,19 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
 
   ecma_string_t *string_p = ecma_get_string_from_value (string);
 
-  ECMA_STRING_TO_UTF8_STRING (string_p, str_start_p, str_start_size);
+  /*
+   * The lexer relies on a zero terminated input and unescapes strings in place,
+   * so it works on a private copy of the characters.
+   */
+  const lit_utf8_size_t str_start_size = ecma_string_get_size (string_p);
+  lit_utf8_byte_t *str_start_p = (lit_utf8_byte_t *) mem_heap_alloc_block (str_start_size + 1);
+
+  lit_utf8_size_t sz = ecma_string_to_utf8_string (string_p, str_start_p, str_start_size);
+  JERRY_ASSERT (sz == str_start_size);
+  str_start_p[str_start_size] = LIT_CHAR_NULL;
 
   ecma_json_token_t token;
-  token.current_p = (lit_utf8_byte_t *) str_start_p;
+  token.current_p = str_start_p;
   token.end_p = str_start_p + str_start_size;
 
   ecma_value_t final_result = ecma_builtin_json_parse_value (&token);
@@ -760,7 +769,7 @@ ecma_builtin_json_parse (ecma_value_t this_arg __attr_unused___, /**< 'this' arg
     }
   }
 
-  ECMA_FINALIZE_UTF8_STRING (str_start_p, str_start_size);
+  mem_heap_free_block (str_start_p, str_start_size + 1);
 
   ECMA_FINALIZE (string);
   return ret_value;
@@ -1327,7 +1336,7 @@ ecma_builtin_json_str (ecma_string_t *key_p, /**< property key*/
     /* 9. */
     else if (ecma_is_value_number (my_val))
     {
-      ecma_number_t num_value_p = *ecma_get_number_from_value (my_val);
+      ecma_number_t num_value_p = ecma_get_number_from_value (my_val);
 
       /* 9.a */
       if (!ecma_number_is_nan (num_value_p) && !ecma_number_is_infinity (num_value_p))
@@ -30,7 +30,7 @@
 #endif /* !NUMBER_VALUE */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 #ifndef ROUTINE
@@ -45,56 +45,56 @@ OBJECT_ID (ECMA_BUILTIN_ID_MATH)
 
 // ECMA-262 v5, 15.8.1.1
 NUMBER_VALUE (LIT_MAGIC_STRING_E_U,
-              ECMA_NUMBER_E,
+              ECMA_BUILTIN_NUMBER_E,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.2
 NUMBER_VALUE (LIT_MAGIC_STRING_LN10_U,
-              ECMA_NUMBER_LN10,
+              ECMA_BUILTIN_NUMBER_LN10,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.3
 NUMBER_VALUE (LIT_MAGIC_STRING_LN2_U,
-              ECMA_NUMBER_LN2,
+              ECMA_BUILTIN_NUMBER_LN2,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.4
 NUMBER_VALUE (LIT_MAGIC_STRING_LOG2E_U,
-              ECMA_NUMBER_LOG2E,
+              ECMA_BUILTIN_NUMBER_LOG2E,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.5
 NUMBER_VALUE (LIT_MAGIC_STRING_LOG10E_U,
-              ECMA_NUMBER_LOG10E,
+              ECMA_BUILTIN_NUMBER_LOG10E,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.6
 NUMBER_VALUE (LIT_MAGIC_STRING_PI_U,
-              ECMA_NUMBER_PI,
+              ECMA_BUILTIN_NUMBER_PI,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.7
 NUMBER_VALUE (LIT_MAGIC_STRING_SQRT1_2_U,
-              ECMA_NUMBER_SQRT_1_2,
+              ECMA_BUILTIN_NUMBER_SQRT1_2,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // ECMA-262 v5, 15.8.1.8
 NUMBER_VALUE (LIT_MAGIC_STRING_SQRT2_U,
-              ECMA_NUMBER_SQRT2,
+              ECMA_BUILTIN_NUMBER_SQRT2,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
@@ -127,3 +127,4 @@ ROUTINE (LIT_MAGIC_STRING_TAN, ecma_builtin_math_object_tan, 1, 1)
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
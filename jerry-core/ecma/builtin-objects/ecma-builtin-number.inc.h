@@ -26,7 +26,7 @@
 #endif /* !NUMBER_VALUE */
 
 #ifndef OBJECT_VALUE
-# define OBJECT_VALUE(name, obj_getter, prop_writable, prop_enumerable, prop_configurable)
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
 #endif /* !OBJECT_VALUE */
 
 /* Object identifier */
@@ -44,45 +44,45 @@ NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
 
 // 15.7.3.4
 NUMBER_VALUE (LIT_MAGIC_STRING_NAN,
-              ecma_number_make_nan (),
+              ECMA_BUILTIN_NUMBER_NAN,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // 15.7.3.2
 NUMBER_VALUE (LIT_MAGIC_STRING_MAX_VALUE_U,
-              ECMA_NUMBER_MAX_VALUE,
+              ECMA_BUILTIN_NUMBER_MAX,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // 15.7.3.3
 NUMBER_VALUE (LIT_MAGIC_STRING_MIN_VALUE_U,
-              ECMA_NUMBER_MIN_VALUE,
+              ECMA_BUILTIN_NUMBER_MIN,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // 15.7.3.5
 NUMBER_VALUE (LIT_MAGIC_STRING_POSITIVE_INFINITY_U,
-              ecma_number_make_infinity (false),
+              ECMA_BUILTIN_NUMBER_POSITIVE_INFINITY,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 // 15.7.3.6
 NUMBER_VALUE (LIT_MAGIC_STRING_NEGATIVE_INFINITY_U,
-              ecma_number_make_infinity (true),
+              ECMA_BUILTIN_NUMBER_NEGATIVE_INFINITY,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
 
 /* Object properties:
- *  (property name, object pointer getter) */
+ *  (property name, built-in object identifier) */
 
 // 15.7.3.1
 OBJECT_VALUE (LIT_MAGIC_STRING_PROTOTYPE,
-              ecma_builtin_get (ECMA_BUILTIN_ID_NUMBER_PROTOTYPE),
+              ECMA_BUILTIN_ID_NUMBER_PROTOTYPE,
               ECMA_PROPERTY_NOT_WRITABLE,
               ECMA_PROPERTY_NOT_ENUMERABLE,
               ECMA_PROPERTY_NOT_CONFIGURABLE)
@@ -94,3 +94,4 @@ OBJECT_VALUE (LIT_MAGIC_STRING_PROTOTYPE,
 #undef OBJECT_VALUE
 #undef CP_UNIMPLEMENTED_VALUE
 #undef ROUTINE
+#undef ACCESSOR_READ_ONLY
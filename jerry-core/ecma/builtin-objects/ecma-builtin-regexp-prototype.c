@@ -90,7 +90,9 @@ ecma_builtin_regexp_prototype_compile (ecma_value_t this_arg, /**< this argument
         /* Get source. */
         ecma_string_t *magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_SOURCE);
         ecma_property_t *prop_p = ecma_op_object_get_property (target_p, magic_string_p);
-        pattern_string_p = ecma_get_string_from_value (ecma_get_named_data_property_value (prop_p));
+        /* The property may be overwritten by the following lookups (see also: ecma_builtin_is_constant_property). */
+        pattern_string_p = ecma_copy_or_ref_ecma_string (ecma_get_string_from_value (
+                                                           ecma_get_named_data_property_value (prop_p)));
         ecma_deref_ecma_string (magic_string_p);
 
         /* Get flags. */
@@ -151,6 +153,8 @@ ecma_builtin_regexp_prototype_compile (ecma_value_t this_arg, /**< this argument
         ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
 
         ECMA_FINALIZE (obj_this);
+
+        ecma_deref_ecma_string (pattern_string_p);
       }
     }
     else
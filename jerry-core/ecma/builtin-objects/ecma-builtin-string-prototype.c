@@ -508,7 +508,7 @@ ecma_builtin_string_prototype_object_match (ecma_value_t this_arg, /**< this arg
                           ecma_op_to_number (this_index_value),
                           ret_value);
 
-          ecma_number_t this_index = *ecma_get_number_from_value (this_index_number);
+          ecma_number_t this_index = ecma_get_number_from_value (this_index_number);
 
           /* 8.f.iii.2. */
           if (this_index == previous_last_index)
@@ -727,12 +727,12 @@ ecma_builtin_string_prototype_object_replace_match (ecma_builtin_replace_search_
       /* We use the length of the result string to determine the
        * match end. This works regardless the global flag is set. */
       ecma_string_t *result_string_p = ecma_get_string_from_value (result_string_value);
-      ecma_number_t *index_number_p = ecma_get_number_from_value (index_value);
+      ecma_number_t index_number = ecma_get_number_from_value (index_value);
 
-      context_p->match_start = (ecma_length_t) (*index_number_p);
+      context_p->match_start = (ecma_length_t) (index_number);
       context_p->match_end = context_p->match_start + (ecma_length_t) ecma_string_get_length (result_string_p);
 
-      JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (*index_number_p) == context_p->match_start);
+      JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (index_number) == context_p->match_start);
 
       ret_value = ecma_copy_value (match_value);
 
@@ -800,10 +800,10 @@ ecma_builtin_string_prototype_object_replace_get_string (ecma_builtin_replace_se
 
   JERRY_ASSERT (ecma_is_value_number (match_length_value));
 
-  ecma_number_t *match_length_number_p = ecma_get_number_from_value (match_length_value);
-  ecma_length_t match_length = (ecma_length_t) (*match_length_number_p);
+  ecma_number_t match_length_number = ecma_get_number_from_value (match_length_value);
+  ecma_length_t match_length = (ecma_length_t) (match_length_number);
 
-  JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (*match_length_number_p) == match_length);
+  JERRY_ASSERT ((ecma_length_t) ecma_number_to_uint32 (match_length_number) == match_length);
   JERRY_ASSERT (match_length >= 1);
 
   if (context_p->is_replace_callable)
@@ -1401,7 +1401,7 @@ ecma_builtin_string_prototype_object_search (ecma_value_t this_arg, /**< this ar
 
       JERRY_ASSERT (ecma_is_value_number (index_value));
 
-      offset = *ecma_get_number_from_value (index_value);
+      offset = ecma_get_number_from_value (index_value);
 
       ECMA_FINALIZE (index_value);
       ecma_deref_ecma_string (index_string_p);
@@ -1546,8 +1546,11 @@ ecma_builtin_helper_split_match (ecma_value_t input_string, /**< first argument
       ecma_string_t *magic_index_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_INDEX);
       ecma_property_t *index_prop_p = ecma_get_named_property (obj_p, magic_index_str_p);
 
-      ecma_number_t *index_num_p = ecma_get_number_from_value (ecma_get_named_data_property_value (index_prop_p));
-      *index_num_p += start_idx;
+      ecma_number_t index_num = ecma_get_number_from_value (ecma_get_named_data_property_value (index_prop_p));
+      ecma_value_t index_value = ecma_make_normalized_number_value (index_num + start_idx);
+
+      ecma_named_data_property_assign_value (obj_p, index_prop_p, index_value);
+      ecma_free_value (index_value);
 
       ecma_deref_ecma_string (magic_index_str_p);
     }
@@ -1809,10 +1812,10 @@ ecma_builtin_string_prototype_object_split (ecma_value_t this_arg, /**< this arg
               ecma_property_t *index_prop_p = ecma_get_named_property (match_array_obj_p, magic_index_str_p);
 
               ecma_value_t index_value = ecma_get_named_data_property_value (index_prop_p);
-              ecma_number_t *index_num_p = ecma_get_number_from_value (index_value);
-              JERRY_ASSERT (*index_num_p >= 0);
+              ecma_number_t index_num = ecma_get_number_from_value (index_value);
+              JERRY_ASSERT (index_num >= 0);
 
-              uint32_t end_pos = ecma_number_to_uint32 (*index_num_p);
+              uint32_t end_pos = ecma_number_to_uint32 (index_num);
 
               if (separator_is_empty)
               {
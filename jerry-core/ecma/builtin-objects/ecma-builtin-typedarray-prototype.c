@@ -0,0 +1,409 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtin-helpers.h"
+#include "ecma-builtins.h"
+#include "ecma-conversion.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt.h"
+#include "jrt-libc-includes.h"
+#include "mem-heap.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#define ECMA_BUILTINS_INTERNAL
+#include "ecma-builtins-internal.h"
+
+#define BUILTIN_INC_HEADER_NAME "ecma-builtin-typedarray-prototype.inc.h"
+#define BUILTIN_UNDERSCORED_ID typedarray_prototype
+#include "ecma-builtin-internal-routines-template.inc.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmabuiltins
+ * @{
+ *
+ * \addtogroup typedarrayprototype ECMA %TypedArrayPrototype% object built-in
+ * @{
+ */
+
+/**
+ * Get the view of the 'this' argument of the %TypedArrayPrototype% routines
+ *
+ * @return pointer to the view - if the argument is a typed array,
+ *         NULL - otherwise
+ */
+static ecma_typedarray_t *
+ecma_builtin_typedarray_prototype_get_typedarray (ecma_value_t this_arg) /**< this argument */
+{
+  if (!ecma_is_value_object (this_arg))
+  {
+    return NULL;
+  }
+
+  return ecma_op_get_typedarray (ecma_get_object_from_value (this_arg));
+} /* ecma_builtin_typedarray_prototype_get_typedarray */
+
+/**
+ * Create a number value from an unsigned integer
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_make_number (uint32_t value) /**< value */
+{
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = (ecma_number_t) value;
+
+  return ecma_make_number_value (num_p);
+} /* ecma_builtin_typedarray_prototype_make_number */
+
+/**
+ * The %TypedArrayPrototype% object's 'buffer' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_buffer_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_object_t *arraybuffer_obj_p = ECMA_GET_NON_NULL_POINTER (ecma_object_t, typedarray_p->arraybuffer_cp);
+  ecma_ref_object (arraybuffer_obj_p);
+
+  return ecma_make_object_value (arraybuffer_obj_p);
+} /* ecma_builtin_typedarray_prototype_buffer_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'byteLength' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.2
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_bytelength_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  uint32_t element_size = ecma_op_typedarray_get_element_size ((ecma_typedarray_type_t) typedarray_p->type);
+
+  return ecma_builtin_typedarray_prototype_make_number (typedarray_p->length * element_size);
+} /* ecma_builtin_typedarray_prototype_bytelength_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'byteOffset' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_byteoffset_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  return ecma_builtin_typedarray_prototype_make_number (typedarray_p->byte_offset);
+} /* ecma_builtin_typedarray_prototype_byteoffset_getter */
+
+/**
+ * The %TypedArrayPrototype% object's 'length' getter
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.17
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_length_getter (ecma_value_t this_arg) /**< this argument */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  return ecma_builtin_typedarray_prototype_make_number (typedarray_p->length);
+} /* ecma_builtin_typedarray_prototype_length_getter */
+
+/**
+ * Copy the elements of a typed array to another typed array
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22.2
+ */
+static void
+ecma_builtin_typedarray_prototype_copy_elements (ecma_typedarray_t *target_p, /**< target view */
+                                                 uint32_t target_offset, /**< first target element */
+                                                 ecma_typedarray_t *source_p) /**< source view */
+{
+  JERRY_ASSERT (target_offset <= target_p->length
+                && source_p->length <= target_p->length - target_offset);
+
+  ecma_typedarray_type_t target_type = (ecma_typedarray_type_t) target_p->type;
+  ecma_typedarray_type_t source_type = (ecma_typedarray_type_t) source_p->type;
+  uint32_t target_element_size = ecma_op_typedarray_get_element_size (target_type);
+  uint32_t source_element_size = ecma_op_typedarray_get_element_size (source_type);
+  uint32_t source_byte_length = source_p->length * source_element_size;
+  uint8_t *target_buffer_p = target_p->buffer_p + target_offset * target_element_size;
+
+  if (target_type == source_type)
+  {
+    memmove (target_buffer_p, source_p->buffer_p, source_byte_length);
+    return;
+  }
+
+  const uint8_t *source_buffer_p = source_p->buffer_p;
+  uint8_t *source_copy_p = NULL;
+
+  if (target_p->arraybuffer_cp == source_p->arraybuffer_cp
+      && source_byte_length > 0)
+  {
+    /* The views share the ArrayBuffer, so the source elements might be overwritten before they are read. */
+    source_copy_p = (uint8_t *) mem_heap_alloc_block (source_byte_length);
+    memcpy (source_copy_p, source_buffer_p, source_byte_length);
+    source_buffer_p = source_copy_p;
+  }
+
+  for (uint32_t index = 0; index < source_p->length; index++)
+  {
+    ecma_number_t num = ecma_op_typedarray_read_number (source_type, source_buffer_p + index * source_element_size);
+    ecma_op_typedarray_write_number (target_type, target_buffer_p + index * target_element_size, num);
+  }
+
+  if (source_copy_p != NULL)
+  {
+    mem_heap_free_block (source_copy_p, source_byte_length);
+  }
+} /* ecma_builtin_typedarray_prototype_copy_elements */
+
+/**
+ * The %TypedArrayPrototype% object's 'set' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.22
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_set (ecma_value_t this_arg, /**< this argument */
+                                              ecma_value_t arg1, /**< array or typed array */
+                                              ecma_value_t arg2) /**< offset */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t offset = 0;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (offset_num, arg2, ret_value);
+
+  ecma_number_t offset_integer = ecma_number_is_nan (offset_num) ? ECMA_NUMBER_ZERO : ecma_number_trunc (offset_num);
+
+  if (offset_integer < ECMA_NUMBER_ZERO || offset_integer > (ecma_number_t) typedarray_p->length)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else
+  {
+    offset = (uint32_t) offset_integer;
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (offset_num);
+
+  if (!ecma_is_value_empty (ret_value))
+  {
+    return ret_value;
+  }
+
+  ecma_typedarray_t *source_typedarray_p = NULL;
+
+  if (ecma_is_value_object (arg1))
+  {
+    source_typedarray_p = ecma_op_get_typedarray (ecma_get_object_from_value (arg1));
+  }
+
+  if (source_typedarray_p != NULL)
+  {
+    if (source_typedarray_p->length > typedarray_p->length - offset)
+    {
+      return ecma_raise_range_error (ECMA_ERR_MSG (""));
+    }
+
+    ecma_builtin_typedarray_prototype_copy_elements (typedarray_p, offset, source_typedarray_p);
+
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  }
+
+  ECMA_TRY_CATCH (source_value, ecma_op_to_object (arg1), ret_value);
+
+  ecma_object_t *source_obj_p = ecma_get_object_from_value (source_value);
+  ecma_string_t *length_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value, ecma_op_object_get (source_obj_p, length_str_p), ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  ecma_number_t length_integer = ((ecma_number_is_nan (length_num) || length_num <= ECMA_NUMBER_ZERO)
+                                  ? ECMA_NUMBER_ZERO
+                                  : ecma_number_trunc (length_num));
+
+  if (length_integer > (ecma_number_t) (typedarray_p->length - offset))
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else
+  {
+    uint32_t length = (uint32_t) length_integer;
+
+    for (uint32_t index = 0; index < length && ecma_is_value_empty (ret_value); index++)
+    {
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+      ECMA_TRY_CATCH (element_value, ecma_op_object_get (source_obj_p, index_str_p), ret_value);
+
+      ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+      ecma_op_typedarray_set_element (typedarray_p, offset + index, element_num);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+      ECMA_FINALIZE (element_value);
+
+      ecma_deref_ecma_string (index_str_p);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+    }
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (length_str_p);
+
+  ECMA_FINALIZE (source_value);
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_set */
+
+/**
+ * The %TypedArrayPrototype% object's 'subarray' routine
+ *
+ * See also:
+ *          ECMA-262 v6, 22.2.3.26
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value.
+ */
+static ecma_value_t
+ecma_builtin_typedarray_prototype_object_subarray (ecma_value_t this_arg, /**< this argument */
+                                                   ecma_value_t arg1, /**< begin */
+                                                   ecma_value_t arg2) /**< end */
+{
+  ecma_typedarray_t *typedarray_p = ecma_builtin_typedarray_prototype_get_typedarray (this_arg);
+
+  if (typedarray_p == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  const uint32_t len = typedarray_p->length;
+  uint32_t begin = 0, end = len;
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (begin_num, arg1, ret_value);
+
+  begin = ecma_builtin_helper_array_index_normalize (begin_num, len);
+
+  if (!ecma_is_value_undefined (arg2))
+  {
+    ECMA_OP_TO_NUMBER_TRY_CATCH (end_num, arg2, ret_value);
+
+    end = ecma_builtin_helper_array_index_normalize (end_num, len);
+
+    ECMA_OP_TO_NUMBER_FINALIZE (end_num);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (begin_num);
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    JERRY_ASSERT (begin <= len && end <= len);
+
+    ecma_typedarray_type_t type = (ecma_typedarray_type_t) typedarray_p->type;
+    uint32_t element_size = ecma_op_typedarray_get_element_size (type);
+    uint32_t new_len = (end > begin) ? (end - begin) : 0;
+
+    /* The new typed array views the same ArrayBuffer. */
+    ecma_object_t *obj_p = ecma_op_create_typedarray_view (ECMA_GET_NON_NULL_POINTER (ecma_object_t,
+                                                                                      typedarray_p->arraybuffer_cp),
+                                                           type,
+                                                           typedarray_p->byte_offset + begin * element_size,
+                                                           new_len);
+
+    ret_value = ecma_make_object_value (obj_p);
+  }
+
+  return ret_value;
+} /* ecma_builtin_typedarray_prototype_object_subarray */
+
+/**
+ * @}
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
@@ -0,0 +1,82 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+/*
+ * Common description of the typed array constructor built-ins
+ *
+ * The including description defines the following macros, which are undefined at the end:
+ *   TYPEDARRAY_BUILTIN_ID - identifier of the constructor built-in
+ *   TYPEDARRAY_PROTOTYPE_BUILTIN_ID - identifier of the prototype built-in
+ *   TYPEDARRAY_BYTES_PER_ELEMENT - size of the elements
+ */
+
+#ifndef TYPEDARRAY_BUILTIN_ID
+# error "Please define TYPEDARRAY_BUILTIN_ID"
+#endif /* !TYPEDARRAY_BUILTIN_ID */
+
+#ifndef OBJECT_ID
+# define OBJECT_ID(builtin_object_id)
+#endif /* !OBJECT_ID */
+
+#ifndef OBJECT_VALUE
+# define OBJECT_VALUE(name, builtin_id, prop_writable, prop_enumerable, prop_configurable)
+#endif /* !OBJECT_VALUE */
+
+#ifndef NUMBER_VALUE
+# define NUMBER_VALUE(name, number_value, prop_writable, prop_enumerable, prop_configurable)
+#endif /* !NUMBER_VALUE */
+
+/* Object identifier */
+OBJECT_ID (TYPEDARRAY_BUILTIN_ID)
+
+/* Object properties:
+ *  (property name, built-in object identifier) */
+
+// ECMA-262 v6, 22.2.5.2
+OBJECT_VALUE (LIT_MAGIC_STRING_PROTOTYPE,
+              TYPEDARRAY_PROTOTYPE_BUILTIN_ID,
+              ECMA_PROPERTY_NOT_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_NOT_CONFIGURABLE)
+
+/* Number properties:
+ *  (property name, number value, writable, enumerable, configurable) */
+
+// ECMA-262 v6, 22.2.5
+NUMBER_VALUE (LIT_MAGIC_STRING_LENGTH,
+              3,
+              ECMA_PROPERTY_NOT_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_NOT_CONFIGURABLE)
+
+// ECMA-262 v6, 22.2.5.1
+NUMBER_VALUE (LIT_MAGIC_STRING_BYTES_PER_ELEMENT_U,
+              TYPEDARRAY_BYTES_PER_ELEMENT,
+              ECMA_PROPERTY_NOT_WRITABLE,
+              ECMA_PROPERTY_NOT_ENUMERABLE,
+              ECMA_PROPERTY_NOT_CONFIGURABLE)
+
+#undef TYPEDARRAY_BUILTIN_ID
+#undef TYPEDARRAY_PROTOTYPE_BUILTIN_ID
+#undef TYPEDARRAY_BYTES_PER_ELEMENT
+
+#undef OBJECT_ID
+#undef SIMPLE_VALUE
+#undef NUMBER_VALUE
+#undef STRING_VALUE
+#undef OBJECT_VALUE
+#undef CP_UNIMPLEMENTED_VALUE
+#undef ROUTINE
+#undef ACCESSOR_READ_ONLY
@@ -57,6 +57,85 @@
  */
 #define ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH (8)
 
+/**
+ * Type of a built-in property
+ */
+typedef enum
+{
+  ECMA_BUILTIN_PROPERTY_SIMPLE, /**< simple value property */
+  ECMA_BUILTIN_PROPERTY_NUMBER, /**< number value property */
+  ECMA_BUILTIN_PROPERTY_STRING, /**< magic string value property */
+  ECMA_BUILTIN_PROPERTY_OBJECT, /**< built-in object value property */
+  ECMA_BUILTIN_PROPERTY_ROUTINE, /**< built-in routine property */
+  ECMA_BUILTIN_PROPERTY_ACCESSOR_READ_ONLY, /**< read-only accessor property with a built-in routine getter */
+  ECMA_BUILTIN_PROPERTY_CP_UNIMPLEMENTED, /**< property, which is not implemented in the compact profile */
+  ECMA_BUILTIN_PROPERTY_END, /**< end of the property list */
+} ecma_builtin_property_type_t;
+
+/**
+ * Number values of built-in properties, which are not small integers
+ *
+ * Note:
+ *      the value of a number property is either a small integer,
+ *      or one of these identifiers (see also: ecma_builtin_get_number_value)
+ */
+typedef enum
+{
+  ECMA_BUILTIN_NUMBER_MAX = 256, /**< ECMA_NUMBER_MAX_VALUE */
+  ECMA_BUILTIN_NUMBER_MIN, /**< ECMA_NUMBER_MIN_VALUE */
+  ECMA_BUILTIN_NUMBER_E, /**< ECMA_NUMBER_E */
+  ECMA_BUILTIN_NUMBER_PI, /**< ECMA_NUMBER_PI */
+  ECMA_BUILTIN_NUMBER_LN10, /**< ECMA_NUMBER_LN10 */
+  ECMA_BUILTIN_NUMBER_LN2, /**< ECMA_NUMBER_LN2 */
+  ECMA_BUILTIN_NUMBER_LOG2E, /**< ECMA_NUMBER_LOG2E */
+  ECMA_BUILTIN_NUMBER_LOG10E, /**< ECMA_NUMBER_LOG10E */
+  ECMA_BUILTIN_NUMBER_SQRT2, /**< ECMA_NUMBER_SQRT2 */
+  ECMA_BUILTIN_NUMBER_SQRT1_2, /**< ECMA_NUMBER_SQRT_1_2 */
+  ECMA_BUILTIN_NUMBER_NAN, /**< NaN */
+  ECMA_BUILTIN_NUMBER_POSITIVE_INFINITY, /**< +Infinity */
+  ECMA_BUILTIN_NUMBER_NEGATIVE_INFINITY, /**< -Infinity */
+} ecma_builtin_number_type_t;
+
+/**
+ * 'Writable' attribute of a built-in property descriptor
+ */
+#define ECMA_BUILTIN_PROPERTY_FLAG_WRITABLE (1u << 0)
+
+/**
+ * 'Enumerable' attribute of a built-in property descriptor
+ */
+#define ECMA_BUILTIN_PROPERTY_FLAG_ENUMERABLE (1u << 1)
+
+/**
+ * 'Configurable' attribute of a built-in property descriptor
+ */
+#define ECMA_BUILTIN_PROPERTY_FLAG_CONFIGURABLE (1u << 2)
+
+/**
+ * Compute the attributes of a built-in property descriptor
+ */
+#define ECMA_BUILTIN_PROPERTY_ATTRIBUTES(prop_writable, prop_enumerable, prop_configurable) \
+  ((uint8_t) (((prop_writable) ? ECMA_BUILTIN_PROPERTY_FLAG_WRITABLE : 0) \
+              | ((prop_enumerable) ? ECMA_BUILTIN_PROPERTY_FLAG_ENUMERABLE : 0) \
+              | ((prop_configurable) ? ECMA_BUILTIN_PROPERTY_FLAG_CONFIGURABLE : 0)))
+
+/**
+ * Description of a property of a built-in object
+ *
+ * Note:
+ *      the descriptors are constant data, which is shared by all engine instances;
+ *      a property is only copied to the heap, when it is first accessed
+ *      (see also: ecma_builtin_try_to_instantiate_property)
+ */
+typedef struct
+{
+  uint16_t magic_string_id; /**< name of the property */
+  uint8_t type; /**< type of the property (ecma_builtin_property_type_t) */
+  uint8_t attributes; /**< attributes of the property (ECMA_BUILTIN_PROPERTY_FLAG_*) */
+  uint16_t value; /**< value of the property: a simple value, a small integer or ecma_builtin_number_type_t,
+                   *   a magic string id, a built-in object id, or the 'length' of a built-in routine */
+} ecma_builtin_property_descriptor_t;
+
 /* ecma-builtins.c */
 extern ecma_object_t *
 ecma_builtin_make_function_object_for_routine (ecma_builtin_id_t, uint16_t, uint8_t);
@@ -78,14 +157,8 @@ ecma_builtin_ ## lowercase_name ## _dispatch_routine (uint16_t builtin_routine_i
                                                       ecma_value_t this_arg_value, \
                                                       const ecma_value_t [], \
                                                       ecma_length_t); \
-extern ecma_property_t * \
-ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (ecma_object_t *, \
-                                                                 ecma_string_t *); \
-extern void \
-ecma_builtin_ ## lowercase_name ## _list_lazy_property_names (ecma_object_t *, \
-                                                              bool, \
-                                                              ecma_collection_header_t *, \
-                                                              ecma_collection_header_t *);
+extern const ecma_builtin_property_descriptor_t \
+ecma_builtin_ ## lowercase_name ## _property_descriptor_list[];
 #include "ecma-builtins.inc.h"
 
 #endif /* !ECMA_BUILTINS_INTERNAL_H */
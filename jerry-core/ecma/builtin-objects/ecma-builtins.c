@@ -45,6 +45,30 @@ static void ecma_instantiate_builtin (ecma_builtin_id_t id);
  */
 static ecma_object_t *ecma_builtin_objects[ECMA_BUILTIN_ID__COUNT];
 
+/**
+ * Property pair, whose first property describes the constant built-in property of the last request
+ *
+ * Note:
+ *      constant properties (see also: ecma_builtin_is_constant_descriptor) are not instantiated
+ *      by [[GetOwnProperty]], their values are read from the descriptor lists instead
+ */
+static ecma_property_pair_t ecma_builtin_constant_property;
+
+/**
+ * Property descriptor lists of built-in objects
+ */
+static const ecma_builtin_property_descriptor_t * const ecma_builtin_property_lists[ECMA_BUILTIN_ID__COUNT] =
+{
+#define BUILTIN(builtin_id, \
+                object_type, \
+                object_prototype_builtin_id, \
+                is_extensible, \
+                is_static, \
+                lowercase_name) \
+  ecma_builtin_ ## lowercase_name ## _property_descriptor_list,
+#include "ecma-builtins.inc.h"
+};
+
 /**
  * Check if passed object is the instance of specified built-in.
  */
@@ -103,6 +127,10 @@ ecma_builtin_init_object (ecma_builtin_id_t obj_builtin_id, /**< built-in ID */
 {
   ecma_object_t *object_obj_p = ecma_create_object (prototype_obj_p, is_extensible, obj_type);
 
+  /* Built-in objects store their properties in property pairs, so the flag must be set before
+   * creating the first property (see also: ecma_create_property). */
+  ecma_set_object_is_builtin (object_obj_p);
+
   /*
    * [[Class]] property of built-in object is not stored explicitly.
    *
@@ -113,8 +141,6 @@ ecma_builtin_init_object (ecma_builtin_id_t obj_builtin_id, /**< built-in ID */
                                                                        ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
   ecma_set_internal_property_value (built_in_id_prop_p, obj_builtin_id);
 
-  ecma_set_object_is_builtin (object_obj_p);
-
   /** Initializing [[PrimitiveValue]] properties of built-in prototype objects */
   switch (obj_builtin_id)
   {
@@ -201,6 +227,14 @@ ecma_init_builtins (void)
   {
     ecma_builtin_objects[id] = NULL;
   }
+
+  ecma_builtin_constant_property.header.types[0].type_and_flags = ECMA_PROPERTY_TYPE_NAMEDDATA;
+  ecma_builtin_constant_property.header.types[1].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  ecma_builtin_constant_property.header.next_property_cp = ECMA_NULL_POINTER;
+  ecma_builtin_constant_property.values[0].value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (ecma_builtin_constant_property.header.types + 0)
+                == ecma_builtin_constant_property.values + 0);
 } /* ecma_init_builtins */
 
 /**
@@ -261,6 +295,9 @@ ecma_instantiate_builtin (ecma_builtin_id_t id) /**< built-in id */
 void
 ecma_finalize_builtins (void)
 {
+  ecma_free_value_if_not_object (ecma_builtin_constant_property.values[0].value);
+  ecma_builtin_constant_property.values[0].value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
   for (ecma_builtin_id_t id = (ecma_builtin_id_t) 0;
        id < ECMA_BUILTIN_ID__COUNT;
        id = (ecma_builtin_id_t) (id + 1))
@@ -273,17 +310,399 @@ ecma_finalize_builtins (void)
   }
 } /* ecma_finalize_builtins */
 
+/**
+ * Get the property descriptor list of a built-in object, which is not a built-in routine
+ *
+ * @return pointer to the first descriptor of the list
+ */
+static const ecma_builtin_property_descriptor_t *
+ecma_builtin_get_property_list (ecma_object_t *object_p, /**< built-in object */
+                                ecma_builtin_id_t *out_builtin_id_p) /**< [out] id of the built-in object */
+{
+  ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (object_p,
+                                                                    ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
+  ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) ecma_get_internal_property_value (built_in_id_prop_p);
+
+  JERRY_ASSERT (builtin_id < ECMA_BUILTIN_ID__COUNT);
+  JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
+
+  *out_builtin_id_p = builtin_id;
+  return ecma_builtin_property_lists[builtin_id];
+} /* ecma_builtin_get_property_list */
+
+/**
+ * Get the bit, which marks that a built-in property was instantiated,
+ * and the internal property, which stores the bit
+ *
+ * @return the bit of the property
+ */
+static uint32_t
+ecma_builtin_get_property_instantiated_bit (uint32_t index, /**< index of the property in the descriptor list */
+                                            ecma_internal_property_id_t *out_mask_prop_id_p) /**< [out] id of
+                                                                                              *   the internal
+                                                                                              *   property */
+{
+  JERRY_ASSERT (index < sizeof (uint64_t) * JERRY_BITSINBYTE);
+
+  if (index >= 32)
+  {
+    *out_mask_prop_id_p = ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_32_63;
+    return (uint32_t) 1u << (index - 32);
+  }
+
+  *out_mask_prop_id_p = ECMA_INTERNAL_PROPERTY_NON_INSTANTIATED_BUILT_IN_MASK_0_31;
+  return (uint32_t) 1u << index;
+} /* ecma_builtin_get_property_instantiated_bit */
+
+/**
+ * Get the number value of a built-in property descriptor
+ *
+ * @return the number
+ */
+static ecma_number_t
+ecma_builtin_get_number_value (uint16_t value) /**< value field of the descriptor */
+{
+  if (value < ECMA_BUILTIN_NUMBER_MAX)
+  {
+    return (ecma_number_t) value;
+  }
+
+  switch ((ecma_builtin_number_type_t) value)
+  {
+    case ECMA_BUILTIN_NUMBER_MAX:
+    {
+      return ECMA_NUMBER_MAX_VALUE;
+    }
+    case ECMA_BUILTIN_NUMBER_MIN:
+    {
+      return ECMA_NUMBER_MIN_VALUE;
+    }
+    case ECMA_BUILTIN_NUMBER_E:
+    {
+      return ECMA_NUMBER_E;
+    }
+    case ECMA_BUILTIN_NUMBER_PI:
+    {
+      return ECMA_NUMBER_PI;
+    }
+    case ECMA_BUILTIN_NUMBER_LN10:
+    {
+      return ECMA_NUMBER_LN10;
+    }
+    case ECMA_BUILTIN_NUMBER_LN2:
+    {
+      return ECMA_NUMBER_LN2;
+    }
+    case ECMA_BUILTIN_NUMBER_LOG2E:
+    {
+      return ECMA_NUMBER_LOG2E;
+    }
+    case ECMA_BUILTIN_NUMBER_LOG10E:
+    {
+      return ECMA_NUMBER_LOG10E;
+    }
+    case ECMA_BUILTIN_NUMBER_SQRT2:
+    {
+      return ECMA_NUMBER_SQRT2;
+    }
+    case ECMA_BUILTIN_NUMBER_SQRT1_2:
+    {
+      return ECMA_NUMBER_SQRT_1_2;
+    }
+    case ECMA_BUILTIN_NUMBER_NAN:
+    {
+      return ecma_number_make_nan ();
+    }
+    case ECMA_BUILTIN_NUMBER_POSITIVE_INFINITY:
+    {
+      return ecma_number_make_infinity (false);
+    }
+    case ECMA_BUILTIN_NUMBER_NEGATIVE_INFINITY:
+    {
+      return ecma_number_make_infinity (true);
+    }
+  }
+
+  JERRY_UNREACHABLE ();
+  return ECMA_NUMBER_ZERO;
+} /* ecma_builtin_get_number_value */
+
+/**
+ * Check whether a built-in property is constant: its value is a simple value, a number,
+ * a string or a built-in object, and the property is neither writable nor configurable
+ *
+ * @return true - if the property is constant,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+ecma_builtin_is_constant_descriptor (const ecma_builtin_property_descriptor_t *property_p) /**< descriptor */
+{
+  return (property_p->type <= ECMA_BUILTIN_PROPERTY_OBJECT
+          && (property_p->attributes & (ECMA_BUILTIN_PROPERTY_FLAG_WRITABLE
+                                        | ECMA_BUILTIN_PROPERTY_FLAG_CONFIGURABLE)) == 0);
+} /* ecma_builtin_is_constant_descriptor */
+
+/**
+ * Describe a constant built-in property with the constant property
+ *
+ * Note:
+ *      the returned property is valid until the next request for a constant built-in property
+ *
+ * @return pointer to the constant property
+ */
+static ecma_property_t *
+ecma_builtin_set_constant_property (ecma_value_t value, /**< value of the property,
+                                                         *   the reference is taken over */
+                                    bool is_enumerable) /**< 'Enumerable' attribute */
+{
+  ecma_property_t *prop_p = ecma_builtin_constant_property.header.types + 0;
+
+  prop_p->type_and_flags = (uint8_t) (is_enumerable ? (ECMA_PROPERTY_TYPE_NAMEDDATA | ECMA_PROPERTY_FLAG_ENUMERABLE)
+                                                    : ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+  /* Built-in objects are referenced by ecma_builtin_objects, so the value does not reference them. */
+  if (ecma_is_value_object (value))
+  {
+    ecma_deref_object (ecma_get_object_from_value (value));
+  }
+
+  ecma_free_value_if_not_object (ecma_builtin_constant_property.values[0].value);
+  ecma_builtin_constant_property.values[0].value = value;
+
+  return prop_p;
+} /* ecma_builtin_set_constant_property */
+
+/**
+ * Instantiate a property of a built-in object (which is not a built-in routine)
+ * from the descriptor list of the object
+ *
+ * Note:
+ *      if is_constant_described is true, constant properties are described
+ *      with the constant property instead of being instantiated
+ *
+ * @return pointer property, if one was instantiated,
+ *         NULL - otherwise.
+ */
+static ecma_property_t *
+ecma_builtin_try_to_instantiate_property_from_list (ecma_object_t *object_p, /**< object */
+                                                    ecma_string_t *string_p, /**< property's name */
+                                                    bool is_constant_described) /**< describe constant
+                                                                                 *   properties */
+{
+  JERRY_ASSERT (ecma_find_named_property (object_p, string_p) == NULL);
+
+  lit_magic_string_id_t magic_string_id;
+
+  if (!ecma_is_string_magic (string_p, &magic_string_id))
+  {
+    return NULL;
+  }
+
+  ecma_builtin_id_t builtin_id;
+  const ecma_builtin_property_descriptor_t *property_list_p = ecma_builtin_get_property_list (object_p,
+                                                                                             &builtin_id);
+  const ecma_builtin_property_descriptor_t *curr_property_p = property_list_p;
+
+  while (curr_property_p->magic_string_id != magic_string_id)
+  {
+    if (curr_property_p->type == ECMA_BUILTIN_PROPERTY_END)
+    {
+      return NULL;
+    }
+
+    curr_property_p++;
+  }
+
+  ecma_internal_property_id_t mask_prop_id;
+  uint32_t bit = ecma_builtin_get_property_instantiated_bit ((uint32_t) (curr_property_p - property_list_p),
+                                                             &mask_prop_id);
+
+  ecma_property_t *mask_prop_p = ecma_find_internal_property (object_p, mask_prop_id);
+  uint32_t bit_mask = (mask_prop_p != NULL) ? ecma_get_internal_property_value (mask_prop_p) : 0;
+
+  if (bit_mask & bit)
+  {
+    return NULL;
+  }
+
+  is_constant_described = is_constant_described && ecma_builtin_is_constant_descriptor (curr_property_p);
+
+  if (!is_constant_described)
+  {
+    if (mask_prop_p == NULL)
+    {
+      mask_prop_p = ecma_create_internal_property (object_p, mask_prop_id);
+    }
+
+    ecma_set_internal_property_value (mask_prop_p, bit_mask | bit);
+  }
+
+  ecma_value_t value;
+
+  switch ((ecma_builtin_property_type_t) curr_property_p->type)
+  {
+    case ECMA_BUILTIN_PROPERTY_SIMPLE:
+    {
+      value = ecma_make_simple_value ((ecma_simple_value_t) curr_property_p->value);
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_NUMBER:
+    {
+      ecma_number_t *num_p = ecma_alloc_number ();
+      *num_p = ecma_builtin_get_number_value (curr_property_p->value);
+
+      value = ecma_make_number_value (num_p);
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_STRING:
+    {
+      value = ecma_make_string_value (ecma_get_magic_string ((lit_magic_string_id_t) curr_property_p->value));
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_OBJECT:
+    {
+      value = ecma_make_object_value (ecma_builtin_get ((ecma_builtin_id_t) curr_property_p->value));
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_ROUTINE:
+    {
+      ecma_object_t *func_obj_p = ecma_builtin_make_function_object_for_routine (builtin_id,
+                                                                                 magic_string_id,
+                                                                                 (uint8_t) curr_property_p->value);
+      value = ecma_make_object_value (func_obj_p);
+      break;
+    }
+    case ECMA_BUILTIN_PROPERTY_ACCESSOR_READ_ONLY:
+    {
+      /* The getter is a built-in routine, which is dispatched like the other routines of the object */
+      ecma_object_t *getter_p = ecma_builtin_make_function_object_for_routine (builtin_id, magic_string_id, 0);
+      bool is_configurable = (curr_property_p->attributes & ECMA_BUILTIN_PROPERTY_FLAG_CONFIGURABLE) != 0;
+
+      ecma_property_t *accessor_prop_p = ecma_create_named_accessor_property (object_p,
+                                                                              string_p,
+                                                                              getter_p,
+                                                                              NULL,
+                                                                              false,
+                                                                              is_configurable);
+      ecma_deref_object (getter_p);
+
+      return accessor_prop_p;
+    }
+    case ECMA_BUILTIN_PROPERTY_CP_UNIMPLEMENTED:
+    {
+#ifdef CONFIG_ECMA_COMPACT_PROFILE
+      /* The object throws CompactProfileError upon invocation */
+      ecma_object_t *get_set_p = ecma_builtin_get (ECMA_BUILTIN_ID_COMPACT_PROFILE_ERROR);
+      ecma_property_t *compact_profile_thrower_property_p = ecma_create_named_accessor_property (object_p,
+                                                                                                 string_p,
+                                                                                                 get_set_p,
+                                                                                                 get_set_p,
+                                                                                                 true,
+                                                                                                 false);
+      ecma_deref_object (get_set_p);
+
+      return compact_profile_thrower_property_p;
+#else /* !CONFIG_ECMA_COMPACT_PROFILE */
+      JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
+#endif /* CONFIG_ECMA_COMPACT_PROFILE */
+    }
+    default:
+    {
+      JERRY_UNREACHABLE ();
+      return NULL;
+    }
+  }
+
+  uint8_t attributes = curr_property_p->attributes;
+  bool is_writable = (attributes & ECMA_BUILTIN_PROPERTY_FLAG_WRITABLE) != 0;
+  bool is_enumerable = (attributes & ECMA_BUILTIN_PROPERTY_FLAG_ENUMERABLE) != 0;
+  bool is_configurable = (attributes & ECMA_BUILTIN_PROPERTY_FLAG_CONFIGURABLE) != 0;
+
+  if (is_constant_described)
+  {
+    return ecma_builtin_set_constant_property (value, is_enumerable);
+  }
+
+  ecma_property_t *prop_p = ecma_create_named_data_property (object_p,
+                                                             string_p,
+                                                             is_writable,
+                                                             is_enumerable,
+                                                             is_configurable);
+
+  ecma_named_data_property_assign_value (object_p, prop_p, value);
+
+  ecma_free_value (value);
+
+  return prop_p;
+} /* ecma_builtin_try_to_instantiate_property_from_list */
+
+/**
+ * List names of the lazy instantiated properties of a built-in object (which is not a built-in routine)
+ * from the descriptor list of the object
+ */
+static void
+ecma_builtin_list_lazy_property_names_from_list (ecma_object_t *object_p, /**< a built-in object */
+                                                 bool separate_enumerable, /**< true - list enumerable properties
+                                                                            *          into main collection, and
+                                                                            *          non-enumerable to collection
+                                                                            *          of 'skipped non-enumerable'
+                                                                            *          properties,
+                                                                            *   false - list all properties into
+                                                                            *           main collection */
+                                                 ecma_collection_header_t *main_collection_p, /**< 'main'
+                                                                                               *   collection */
+                                                 ecma_collection_header_t *non_enum_collection_p) /**< skipped
+                                                                                                   *   'non-enumerable'
+                                                                                                   *   collection */
+{
+  ecma_collection_header_t *for_non_enumerable_p = separate_enumerable ? non_enum_collection_p : main_collection_p;
+
+  ecma_builtin_id_t builtin_id;
+  const ecma_builtin_property_descriptor_t *property_list_p = ecma_builtin_get_property_list (object_p,
+                                                                                             &builtin_id);
+
+  for (const ecma_builtin_property_descriptor_t *curr_property_p = property_list_p;
+       curr_property_p->type != ECMA_BUILTIN_PROPERTY_END;
+       curr_property_p++)
+  {
+    ecma_internal_property_id_t mask_prop_id;
+    uint32_t bit = ecma_builtin_get_property_instantiated_bit ((uint32_t) (curr_property_p - property_list_p),
+                                                               &mask_prop_id);
+
+    ecma_property_t *mask_prop_p = ecma_find_internal_property (object_p, mask_prop_id);
+    bool is_instantiated = (mask_prop_p != NULL && (ecma_get_internal_property_value (mask_prop_p) & bit) != 0);
+
+    ecma_string_t *name_p = ecma_get_magic_string ((lit_magic_string_id_t) curr_property_p->magic_string_id);
+
+    /* The properties, which are not instantiated yet, will be instantiated upon first request */
+    if (!is_instantiated || ecma_op_object_get_own_property (object_p, name_p) != NULL)
+    {
+      ecma_append_to_values_collection (for_non_enumerable_p,
+                                        ecma_make_string_value (name_p),
+                                        true);
+    }
+
+    ecma_deref_ecma_string (name_p);
+  }
+} /* ecma_builtin_list_lazy_property_names_from_list */
+
 /**
  * If the property's name is one of built-in properties of the object
  * that is not instantiated yet, instantiate the property and
  * return pointer to the instantiated property.
  *
+ * Note:
+ *      if is_constant_described is true, constant properties are described
+ *      with the constant property instead of being instantiated
+ *
  * @return pointer property, if one was instantiated,
  *         NULL - otherwise.
  */
-ecma_property_t *
-ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
-                                          ecma_string_t *string_p) /**< property's name */
+static ecma_property_t *
+ecma_builtin_try_to_instantiate_property_helper (ecma_object_t *object_p, /**< object */
+                                                 ecma_string_t *string_p, /**< property's name */
+                                                 bool is_constant_described) /**< describe constant
+                                                                              *   properties */
 {
   JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
 
@@ -317,15 +736,19 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
                                                                    ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_POS,
                                                                    ECMA_BUILTIN_ROUTINE_ID_LENGTH_VALUE_WIDTH);
 
+      ecma_number_t *len_p = ecma_alloc_number ();
+      *len_p = length_prop_value;
+
+      if (is_constant_described)
+      {
+        return ecma_builtin_set_constant_property (ecma_make_number_value (len_p), false);
+      }
+
       ecma_property_t *len_prop_p = ecma_create_named_data_property (object_p,
                                                                      string_p,
                                                                      false, false, false);
 
-
-      ecma_number_t *len_p = ecma_alloc_number ();
-      *len_p = length_prop_value;
-
-      ecma_set_named_data_property_value (len_prop_p, ecma_make_number_value (len_p));
+      ecma_set_named_data_property_value (object_p, len_prop_p, ecma_make_number_value (len_p));
 
       JERRY_ASSERT (!ecma_is_property_configurable (len_prop_p));
       return len_prop_p;
@@ -335,45 +758,62 @@ ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object *
   }
   else
   {
-    ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (object_p,
-                                                                      ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
-    ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) ecma_get_internal_property_value (built_in_id_prop_p);
+    return ecma_builtin_try_to_instantiate_property_from_list (object_p, string_p, is_constant_described);
+  }
+} /* ecma_builtin_try_to_instantiate_property_helper */
+
+/**
+ * If the property's name is one of built-in properties of the object
+ * that is not instantiated yet, instantiate the property and
+ * return pointer to the instantiated property.
+ *
+ * Note:
+ *      constant properties are not instantiated, they are described with the constant property,
+ *      which is valid until the next request for a constant built-in property
+ *      (see also: ecma_builtin_is_constant_property)
+ *
+ * @return pointer property, if one was instantiated or described,
+ *         NULL - otherwise.
+ */
+ecma_property_t *
+ecma_builtin_try_to_instantiate_property (ecma_object_t *object_p, /**< object */
+                                          ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
 
-    JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
+  return ecma_builtin_try_to_instantiate_property_helper (object_p, string_p, true);
+} /* ecma_builtin_try_to_instantiate_property */
 
-    switch (builtin_id)
-    {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-      case builtin_id: \
-      { \
-        return ecma_builtin_ ## lowercase_name ## _try_to_instantiate_property (object_p, \
-                                                                                string_p); \
-      }
-#include "ecma-builtins.inc.h"
+/**
+ * Check whether a property is the constant property, which describes a constant built-in property
+ * that is not instantiated
+ *
+ * @return true - if the property is the constant property,
+ *         false - otherwise
+ */
+bool
+ecma_builtin_is_constant_property (const ecma_property_t *prop_p) /**< property */
+{
+  return prop_p == ecma_builtin_constant_property.header.types + 0;
+} /* ecma_builtin_is_constant_property */
 
-      case ECMA_BUILTIN_ID__COUNT:
-      {
-        JERRY_UNREACHABLE ();
-      }
+/**
+ * Instantiate a constant built-in property, which was described with the constant property,
+ * before its attributes or value are changed
+ *
+ * @return pointer to the instantiated property
+ */
+ecma_property_t *
+ecma_builtin_instantiate_constant_property (ecma_object_t *object_p, /**< object */
+                                            ecma_string_t *string_p) /**< property's name */
+{
+  JERRY_ASSERT (ecma_get_object_is_builtin (object_p));
 
-      default:
-      {
-#ifdef CONFIG_ECMA_COMPACT_PROFILE
-        JERRY_UNREACHABLE ();
-#else /* !CONFIG_ECMA_COMPACT_PROFILE */
-        JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* CONFIG_ECMA_COMPACT_PROFILE */
-      }
-    }
+  ecma_property_t *prop_p = ecma_builtin_try_to_instantiate_property_helper (object_p, string_p, false);
 
-    JERRY_UNREACHABLE ();
-  }
-} /* ecma_builtin_try_to_instantiate_property */
+  JERRY_ASSERT (prop_p != NULL && !ecma_builtin_is_constant_property (prop_p));
+  return prop_p;
+} /* ecma_builtin_instantiate_constant_property */
 
 /**
  * List names of a built-in object's lazy instantiated properties
@@ -409,46 +849,10 @@ ecma_builtin_list_lazy_property_names (ecma_object_t *object_p, /**< a built-in
   }
   else
   {
-    ecma_property_t *built_in_id_prop_p = ecma_get_internal_property (object_p,
-                                                                      ECMA_INTERNAL_PROPERTY_BUILT_IN_ID);
-    ecma_builtin_id_t builtin_id = (ecma_builtin_id_t) ecma_get_internal_property_value (built_in_id_prop_p);
-
-    JERRY_ASSERT (ecma_builtin_is (object_p, builtin_id));
-
-    switch (builtin_id)
-    {
-#define BUILTIN(builtin_id, \
-                object_type, \
-                object_prototype_builtin_id, \
-                is_extensible, \
-                is_static, \
-                lowercase_name) \
-      case builtin_id: \
-                       { \
-                         ecma_builtin_ ## lowercase_name ## _list_lazy_property_names (object_p, \
-                                                                                       separate_enumerable, \
-                                                                                       main_collection_p, \
-                                                                                       non_enum_collection_p); \
-                         return; \
-                       }
-#include "ecma-builtins.inc.h"
-
-      case ECMA_BUILTIN_ID__COUNT:
-      {
-        JERRY_UNREACHABLE ();
-      }
-
-      default:
-      {
-#ifdef CONFIG_ECMA_COMPACT_PROFILE
-        JERRY_UNREACHABLE ();
-#else /* !CONFIG_ECMA_COMPACT_PROFILE */
-        JERRY_UNIMPLEMENTED ("The built-in is not implemented.");
-#endif /* CONFIG_ECMA_COMPACT_PROFILE */
-      }
-    }
-
-    JERRY_UNREACHABLE ();
+    ecma_builtin_list_lazy_property_names_from_list (object_p,
+                                                     separate_enumerable,
+                                                     main_collection_p,
+                                                     non_enum_collection_p);
   }
 } /* ecma_builtin_list_lazy_property_names */
 
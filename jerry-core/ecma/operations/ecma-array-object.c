@@ -33,6 +33,246 @@
  * @{
  */
 
+/**
+ * Maximum number of holes, which can be added to the fast element storage of an array besides
+ * the number of its elements, when the storage is grown.
+ *
+ * Arrays, which would become sparser, store their elements as named properties.
+ */
+#define ECMA_ARRAY_FAST_ELEMENTS_MAX_GAP 16
+
+/**
+ * Get the fast element storage referenced by the internal property of an array.
+ */
+#define ECMA_ARRAY_GET_FAST_ELEMENTS(elements_prop_p) \
+  ECMA_GET_NON_NULL_POINTER (ecma_array_elements_t, ECMA_PROPERTY_VALUE_PTR (elements_prop_p)->value)
+
+/**
+ * Compute the capacity of a fast element storage, which can hold the specified number of slots.
+ *
+ * @return capacity (a multiple of ECMA_PROPERTY_GROUP_ITEM_COUNT)
+ */
+static inline uint32_t __attr_always_inline___
+ecma_op_array_get_fast_elements_capacity (uint32_t slot_count) /**< number of slots */
+{
+  return (uint32_t) JERRY_ALIGNUP (slot_count, ECMA_PROPERTY_GROUP_ITEM_COUNT);
+} /* ecma_op_array_get_fast_elements_capacity */
+
+/**
+ * Change the capacity of the fast element storage of an array.
+ *
+ * Note:
+ *      the slots above the new capacity must be holes
+ *
+ * @return pointer to the new element storage
+ */
+static ecma_array_elements_t *
+ecma_op_array_resize_fast_elements (ecma_property_t *elements_prop_p, /**< internal property of the array,
+                                                                        *   which references the storage */
+                                    uint32_t new_capacity) /**< new capacity */
+{
+  JERRY_ASSERT (new_capacity == ecma_op_array_get_fast_elements_capacity (new_capacity));
+
+  ecma_array_elements_t *elements_p = ECMA_ARRAY_GET_FAST_ELEMENTS (elements_prop_p);
+  ecma_array_elements_t *new_elements_p = ecma_alloc_array_elements (ECMA_ARRAY_ELEMENTS_SIZE (new_capacity));
+  uint32_t copied_count = JERRY_MIN (elements_p->capacity, new_capacity);
+
+  memcpy (ECMA_ARRAY_ELEMENTS_GET_GROUPS (new_elements_p),
+          ECMA_ARRAY_ELEMENTS_GET_GROUPS (elements_p),
+          (copied_count / ECMA_PROPERTY_GROUP_ITEM_COUNT) * sizeof (ecma_property_group_t));
+
+  for (uint32_t index = copied_count; index < new_capacity; index++)
+  {
+    ECMA_ARRAY_ELEMENTS_GET_PROPERTY (new_elements_p, index)->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+#ifndef JERRY_NDEBUG
+  for (uint32_t index = copied_count; index < elements_p->capacity; index++)
+  {
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index))
+                  == ECMA_PROPERTY_TYPE_DELETED);
+  }
+#endif /* !JERRY_NDEBUG */
+
+  new_elements_p->capacity = new_capacity;
+  new_elements_p->count = elements_p->count;
+
+  ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (elements_prop_p)->value, new_elements_p);
+
+  ecma_dealloc_array_elements (elements_p, ECMA_ARRAY_ELEMENTS_SIZE (elements_p->capacity));
+
+  return new_elements_p;
+} /* ecma_op_array_resize_fast_elements */
+
+/**
+ * Convert the fast element storage of an array to named properties.
+ *
+ * After the conversion the array is sparse: its elements are ordinary named properties.
+ */
+static void
+ecma_op_array_convert_fast_elements (ecma_object_t *obj_p, /**< the array object */
+                                     ecma_property_t *elements_prop_p) /**< internal property of the array,
+                                                                        *   which references the storage */
+{
+  ecma_array_elements_t *elements_p = ECMA_ARRAY_GET_FAST_ELEMENTS (elements_prop_p);
+
+  for (uint32_t index = 0; index < elements_p->capacity; index++)
+  {
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+    if (ECMA_PROPERTY_GET_TYPE (element_p) == ECMA_PROPERTY_TYPE_DELETED)
+    {
+      continue;
+    }
+
+    JERRY_ASSERT (ECMA_PROPERTY_GET_TYPE (element_p) == ECMA_PROPERTY_TYPE_NAMEDDATA);
+
+    ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+    ecma_property_t *property_p = ecma_create_named_data_property (obj_p,
+                                                                   index_str_p,
+                                                                   true, /* Writable */
+                                                                   true, /* Enumerable */
+                                                                   true); /* Configurable */
+    ecma_deref_ecma_string (index_str_p);
+
+    /* The value is moved, so it is neither copied nor freed. */
+    ecma_set_named_data_property_value (obj_p, property_p, ecma_get_named_data_property_value (element_p));
+    element_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  }
+
+  /* The storage contains only holes, so it is simply freed with the internal property
+   * (property pairs are never moved, so the internal property is not changed by the new properties). */
+  ecma_delete_property (obj_p, elements_prop_p);
+} /* ecma_op_array_convert_fast_elements */
+
+/**
+ * Define an element in the fast element storage of an array.
+ *
+ * The storage holds writable, enumerable and configurable data elements, which are not
+ * far above the other elements. Defining any other element converts the storage to named properties.
+ *
+ * @return true - if the element is defined in the storage,
+ *         false - if the storage is converted, so the element must be defined as a named property
+ */
+static bool
+ecma_op_array_object_define_fast_element (ecma_object_t *obj_p, /**< the array object */
+                                          ecma_property_t *elements_prop_p, /**< internal property of the array,
+                                                                             *   which references the storage */
+                                          uint32_t index, /**< index of the element */
+                                          const ecma_property_descriptor_t *property_desc_p) /**< property
+                                                                                              *   descriptor */
+{
+  ecma_array_elements_t *elements_p = ECMA_ARRAY_GET_FAST_ELEMENTS (elements_prop_p);
+
+  bool is_default_data_descriptor = (!property_desc_p->is_get_defined
+                                     && !property_desc_p->is_set_defined
+                                     && (!property_desc_p->is_writable_defined
+                                         || property_desc_p->is_writable)
+                                     && (!property_desc_p->is_enumerable_defined
+                                         || property_desc_p->is_enumerable)
+                                     && (!property_desc_p->is_configurable_defined
+                                         || property_desc_p->is_configurable));
+
+  if (is_default_data_descriptor)
+  {
+    if (index < elements_p->capacity
+        && ECMA_PROPERTY_GET_TYPE (ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index)) != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      /* The attributes of the element are not changed by the descriptor. */
+      if (property_desc_p->is_value_defined)
+      {
+        ecma_named_data_property_assign_value (obj_p,
+                                               ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index),
+                                               property_desc_p->value);
+      }
+
+      return true;
+    }
+
+    /* The missing attributes of new properties are false (ECMA-262 v5, 8.12.9, 4.a). */
+    bool is_new_element_allowed = (property_desc_p->is_writable_defined
+                                   && property_desc_p->is_enumerable_defined
+                                   && property_desc_p->is_configurable_defined
+                                   && ecma_get_object_extensible (obj_p));
+
+    if (is_new_element_allowed && index >= elements_p->capacity)
+    {
+      if (index < CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY
+          && index - elements_p->count <= elements_p->count + ECMA_ARRAY_FAST_ELEMENTS_MAX_GAP)
+      {
+        uint32_t new_capacity = elements_p->capacity + elements_p->capacity / 2;
+
+        if (new_capacity <= index || new_capacity > CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY)
+        {
+          new_capacity = index + 1;
+        }
+
+        elements_p = ecma_op_array_resize_fast_elements (elements_prop_p,
+                                                         ecma_op_array_get_fast_elements_capacity (new_capacity));
+      }
+      else
+      {
+        is_new_element_allowed = false;
+      }
+    }
+
+    if (is_new_element_allowed)
+    {
+      ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+      element_p->type_and_flags = (ECMA_PROPERTY_TYPE_NAMEDDATA
+                                   | ECMA_PROPERTY_FLAG_CONFIGURABLE
+                                   | ECMA_PROPERTY_FLAG_ENUMERABLE
+                                   | ECMA_PROPERTY_FLAG_WRITABLE);
+      ecma_set_named_data_property_value (obj_p, element_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+      elements_p->count++;
+
+      if (property_desc_p->is_value_defined)
+      {
+        ecma_named_data_property_assign_value (obj_p, element_p, property_desc_p->value);
+      }
+
+      return true;
+    }
+  }
+
+  ecma_op_array_convert_fast_elements (obj_p, elements_prop_p);
+
+  return false;
+} /* ecma_op_array_object_define_fast_element */
+
+/**
+ * Delete the elements, whose index is greater than or equal to the new length,
+ * from the fast element storage of an array.
+ */
+static void
+ecma_op_array_truncate_fast_elements (ecma_property_t *elements_prop_p, /**< internal property of the array,
+                                                                          *   which references the storage */
+                                      uint32_t new_length) /**< new length of the array */
+{
+  ecma_array_elements_t *elements_p = ECMA_ARRAY_GET_FAST_ELEMENTS (elements_prop_p);
+
+  for (uint32_t index = new_length; index < elements_p->capacity; index++)
+  {
+    ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+    if (ECMA_PROPERTY_GET_TYPE (element_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+    {
+      ecma_free_value_if_not_object (ecma_get_named_data_property_value (element_p));
+      element_p->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+      elements_p->count--;
+    }
+  }
+
+  /* The storage is shrunk, when most of it is unused. */
+  uint32_t new_capacity = ecma_op_array_get_fast_elements_capacity (new_length);
+
+  if (new_capacity < elements_p->capacity / 2)
+  {
+    ecma_op_array_resize_fast_elements (elements_prop_p, new_capacity);
+  }
+} /* ecma_op_array_truncate_fast_elements */
+
 /**
  * Array object creation operation.
  *
@@ -64,9 +304,9 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
       && arguments_list_len == 1
       && ecma_is_value_number (arguments_list_p[0]))
   {
-    ecma_number_t *num_p = ecma_get_number_from_value (arguments_list_p[0]);
-    uint32_t num_uint32 = ecma_number_to_uint32 (*num_p);
-    if (*num_p != ((ecma_number_t) num_uint32))
+    ecma_number_t num = ecma_get_number_from_value (arguments_list_p[0]);
+    uint32_t num_uint32 = ecma_number_to_uint32 (num);
+    if (num != ((ecma_number_t) num_uint32))
     {
       return ecma_raise_range_error (ECMA_ERR_MSG (""));
     }
@@ -99,6 +339,31 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
    * See also: ecma_object_get_class_name
    */
 
+  /*
+   * The elements are stored in a fast element storage, until the array becomes sparse.
+   *
+   * See also: ecma_array_elements_t
+   */
+  ecma_array_elements_t *elements_p = NULL;
+
+  if (array_items_count <= CONFIG_ECMA_ARRAY_FAST_ELEMENTS_MAX_CAPACITY)
+  {
+    uint32_t capacity = ecma_op_array_get_fast_elements_capacity ((uint32_t) array_items_count);
+
+    elements_p = ecma_alloc_array_elements (ECMA_ARRAY_ELEMENTS_SIZE (capacity));
+    elements_p->capacity = capacity;
+    elements_p->count = 0;
+
+    for (uint32_t index = 0; index < capacity; index++)
+    {
+      ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index)->type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+    }
+
+    ecma_property_t *elements_prop_p;
+    elements_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES);
+    ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (elements_prop_p)->value, elements_p);
+  }
+
   ecma_string_t *length_magic_string_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
   ecma_number_t *length_num_p = ecma_alloc_number ();
   *length_num_p = ((ecma_number_t) length);
@@ -106,7 +371,7 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
   ecma_property_t *length_prop_p = ecma_create_named_data_property (obj_p,
                                                                     length_magic_string_p,
                                                                     true, false, false);
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_num_p));
+  ecma_set_named_data_property_value (obj_p, length_prop_p, ecma_make_number_value (length_num_p));
 
   ecma_deref_ecma_string (length_magic_string_p);
 
@@ -119,6 +384,21 @@ ecma_op_create_array_object (const ecma_value_t *arguments_list_p, /**< list of
       continue;
     }
 
+    if (elements_p != NULL)
+    {
+      ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+      element_p->type_and_flags = (ECMA_PROPERTY_TYPE_NAMEDDATA
+                                   | ECMA_PROPERTY_FLAG_CONFIGURABLE
+                                   | ECMA_PROPERTY_FLAG_ENUMERABLE
+                                   | ECMA_PROPERTY_FLAG_WRITABLE);
+      ecma_set_named_data_property_value (obj_p, element_p, ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED));
+      elements_p->count++;
+
+      ecma_named_data_property_assign_value (obj_p, element_p, array_items_p[index]);
+      continue;
+    }
+
     ecma_string_t *item_name_string_p = ecma_new_ecma_string_from_uint32 (index);
 
     ecma_builtin_helper_def_prop (obj_p,
@@ -162,8 +442,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   // 2.
   ecma_value_t old_len_value = ecma_get_named_data_property_value (len_prop_p);
 
-  ecma_number_t *num_p = ecma_get_number_from_value (old_len_value);
-  uint32_t old_len_uint32 = ecma_number_to_uint32 (*num_p);
+  uint32_t old_len_uint32 = ecma_number_to_uint32 (ecma_get_number_from_value (old_len_value));
 
   // 3.
   bool is_property_name_equal_length = ecma_compare_ecma_strings (property_name_p,
@@ -190,7 +469,7 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     JERRY_ASSERT (!ecma_is_value_error (completion)
                   && ecma_is_value_number (completion));
 
-    ecma_number_t new_len_num = *ecma_get_number_from_value (completion);
+    ecma_number_t new_len_num = ecma_get_number_from_value (completion);
 
     ecma_free_value (completion);
 
@@ -271,85 +550,97 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
             // l
             JERRY_ASSERT (new_len_uint32 < old_len_uint32);
 
-            /*
-             * Item i. is replaced with faster iteration: only indices that actually exist in the array, are iterated
-             */
             bool is_reduce_succeeded = true;
 
-            ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
-                                                                                               true,
-                                                                                               false,
-                                                                                               false);
-
-            ecma_length_t array_index_props_num = array_index_props_p->unit_number;
+            ecma_property_t *elements_prop_p;
+            elements_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES);
 
-            MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
+            if (elements_prop_p != NULL)
+            {
+              /* The elements in the fast element storage are configurable, so they are always deleted. */
+              ecma_op_array_truncate_fast_elements (elements_prop_p, new_len_uint32);
+            }
+            else
+            {
+              /*
+               * Item i. is replaced with faster iteration: only indices that actually exist in the array,
+               * are iterated
+               */
+              ecma_collection_header_t *array_index_props_p = ecma_op_object_get_property_names (obj_p,
+                                                                                                 true,
+                                                                                                 false,
+                                                                                                 false);
 
-            ecma_collection_iterator_t iter;
-            ecma_collection_iterator_init (&iter, array_index_props_p);
+              ecma_length_t array_index_props_num = array_index_props_p->unit_number;
 
-            uint32_t array_index_values_pos = 0;
+              MEM_DEFINE_LOCAL_ARRAY (array_index_values_p, array_index_props_num, uint32_t);
 
-            while (ecma_collection_iterator_next (&iter))
-            {
-              ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
+              ecma_collection_iterator_t iter;
+              ecma_collection_iterator_init (&iter, array_index_props_p);
 
-              uint32_t index;
-              bool is_index = ecma_string_get_array_index (property_name_p, &index);
-              JERRY_ASSERT (is_index);
-              JERRY_ASSERT (index < old_len_uint32);
+              uint32_t array_index_values_pos = 0;
 
-              array_index_values_p[array_index_values_pos++] = index;
-            }
+              while (ecma_collection_iterator_next (&iter))
+              {
+                ecma_string_t *property_name_p = ecma_get_string_from_value (*iter.current_value_p);
 
-            JERRY_ASSERT (array_index_values_pos == array_index_props_num);
+                uint32_t index;
+                bool is_index = ecma_string_get_array_index (property_name_p, &index);
+                JERRY_ASSERT (is_index);
+                JERRY_ASSERT (index < old_len_uint32);
 
-            while (array_index_values_pos != 0
-                   && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
-            {
-              uint32_t index = array_index_values_p[array_index_values_pos];
+                array_index_values_p[array_index_values_pos++] = index;
+              }
 
-              // ii.
-              ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
-              ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
-              ecma_deref_ecma_string (index_string_p);
+              JERRY_ASSERT (array_index_values_pos == array_index_props_num);
 
-              if (ecma_is_value_false (delete_succeeded))
+              while (array_index_values_pos != 0
+                     && array_index_values_p[--array_index_values_pos] >= new_len_uint32)
               {
-                // iii.
-                new_len_uint32 = (index + 1u);
+                uint32_t index = array_index_values_p[array_index_values_pos];
 
-                ecma_number_t *new_len_num_p = ecma_get_number_from_value (new_len_property_desc.value);
+                // ii.
+                ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+                ecma_value_t delete_succeeded = ecma_op_object_delete (obj_p, index_string_p, false);
+                ecma_deref_ecma_string (index_string_p);
 
-                // 1.
-                *new_len_num_p = ((ecma_number_t) index + 1u);
-
-                // 2.
-                if (!new_writable)
+                if (ecma_is_value_false (delete_succeeded))
                 {
-                  new_len_property_desc.is_writable_defined = true;
-                  new_len_property_desc.is_writable = false;
-                }
+                  // iii.
+                  new_len_uint32 = (index + 1u);
 
-                // 3.
-                ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
-                ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
-                                                                                      magic_string_length_p,
-                                                                                      &new_len_property_desc,
-                                                                                      false);
-                ecma_deref_ecma_string (magic_string_length_p);
+                  ecma_number_t *new_len_num_p = ecma_get_float_from_value (new_len_property_desc.value);
 
-                JERRY_ASSERT (ecma_is_value_boolean (completion));
+                  // 1.
+                  *new_len_num_p = ((ecma_number_t) index + 1u);
 
-                is_reduce_succeeded = false;
+                  // 2.
+                  if (!new_writable)
+                  {
+                    new_len_property_desc.is_writable_defined = true;
+                    new_len_property_desc.is_writable = false;
+                  }
 
-                break;
+                  // 3.
+                  ecma_string_t *magic_string_length_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+                  ecma_value_t completion = ecma_op_general_object_define_own_property (obj_p,
+                                                                                        magic_string_length_p,
+                                                                                        &new_len_property_desc,
+                                                                                        false);
+                  ecma_deref_ecma_string (magic_string_length_p);
+
+                  JERRY_ASSERT (ecma_is_value_boolean (completion));
+
+                  is_reduce_succeeded = false;
+
+                  break;
+                }
               }
-            }
 
-            MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
+              MEM_FINALIZE_LOCAL_ARRAY (array_index_values_p);
 
-            ecma_free_values_collection (array_index_props_p, true);
+              ecma_free_values_collection (array_index_props_p, true);
+            }
 
             if (!is_reduce_succeeded)
             {
@@ -412,16 +703,23 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
     }
 
     // c.
-    ecma_value_t succeeded = ecma_op_general_object_define_own_property (obj_p,
-                                                                         property_name_p,
-                                                                         property_desc_p,
-                                                                         false);
-    // d.
-    JERRY_ASSERT (ecma_is_value_boolean (succeeded));
+    ecma_property_t *elements_prop_p;
+    elements_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_NUMBER_INDEXED_ARRAY_VALUES);
 
-    if (ecma_is_value_false (succeeded))
+    if (elements_prop_p == NULL
+        || !ecma_op_array_object_define_fast_element (obj_p, elements_prop_p, index, property_desc_p))
     {
-      return ecma_reject (is_throw);
+      ecma_value_t succeeded = ecma_op_general_object_define_own_property (obj_p,
+                                                                           property_name_p,
+                                                                           property_desc_p,
+                                                                           false);
+      // d.
+      JERRY_ASSERT (ecma_is_value_boolean (succeeded));
+
+      if (ecma_is_value_false (succeeded))
+      {
+        return ecma_reject (is_throw);
+      }
     }
 
     // e.
@@ -443,6 +741,95 @@ ecma_op_array_object_define_own_property (ecma_object_t *obj_p, /**< the array o
   JERRY_UNREACHABLE ();
 } /* ecma_op_array_object_define_own_property */
 
+/**
+ * [[GetOwnProperty]] ecma array object's operation
+ *
+ * See also:
+ *          ECMA-262 v5, 8.6.2; ECMA-262 v5, Table 8
+ *          ECMA-262 v5, 8.12.1
+ *
+ * @return pointer to a property - if it exists,
+ *         NULL (i.e. ecma-undefined) - otherwise.
+ */
+ecma_property_t *
+ecma_op_array_object_get_own_property (ecma_object_t *obj_p, /**< the array object */
+                                       ecma_string_t *property_name_p) /**< property name */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  ecma_array_elements_t *elements_p = ecma_get_array_elements (obj_p);
+  uint32_t index;
+
+  if (elements_p != NULL
+      && ecma_string_get_array_index (property_name_p, &index))
+  {
+    /* The elements of the fast element storage are not named properties, so they are never
+     * looked up in the property list (and are not registered in the LCache). */
+    if (index < elements_p->capacity)
+    {
+      ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+      if (ECMA_PROPERTY_GET_TYPE (element_p) != ECMA_PROPERTY_TYPE_DELETED)
+      {
+        return element_p;
+      }
+    }
+
+    return NULL;
+  }
+
+  return ecma_op_general_object_get_own_property (obj_p, property_name_p);
+} /* ecma_op_array_object_get_own_property */
+
+/**
+ * List names of the elements in the fast element storage of an array
+ *
+ * Note:
+ *      the names are listed in descending order of the indices, like the names of array elements,
+ *      which are stored in the property list
+ */
+void
+ecma_op_array_list_lazy_property_names (ecma_object_t *obj_p, /**< the array object */
+                                        bool separate_enumerable, /**< true -  list enumerable properties
+                                                                   *           into main collection,
+                                                                   *           and non-enumerable to collection of
+                                                                   *           'skipped non-enumerable' properties,
+                                                                   *   false - list all properties into main
+                                                                   *           collection.
+                                                                   */
+                                        ecma_collection_header_t *main_collection_p, /**< 'main'
+                                                                                      *   collection */
+                                        ecma_collection_header_t *non_enum_collection_p) /**< skipped
+                                                                                          *   'non-enumerable'
+                                                                                          *   collection */
+{
+  JERRY_ASSERT (ecma_get_object_type (obj_p) == ECMA_OBJECT_TYPE_ARRAY);
+
+  /* the elements are enumerable */
+  (void) separate_enumerable;
+  (void) non_enum_collection_p;
+
+  ecma_array_elements_t *elements_p = ecma_get_array_elements (obj_p);
+
+  if (elements_p == NULL)
+  {
+    return;
+  }
+
+  for (uint32_t index = elements_p->capacity; index > 0; index--)
+  {
+    if (ECMA_PROPERTY_GET_TYPE (ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index - 1))
+        != ECMA_PROPERTY_TYPE_DELETED)
+    {
+      ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (index - 1);
+
+      ecma_append_to_values_collection (main_collection_p, ecma_make_string_value (name_p), true);
+
+      ecma_deref_ecma_string (name_p);
+    }
+  }
+} /* ecma_op_array_list_lazy_property_names */
+
 /**
  * @}
  * @}
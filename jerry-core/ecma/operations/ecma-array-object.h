@@ -31,6 +31,15 @@ ecma_op_create_array_object (const ecma_value_t *, ecma_length_t, bool);
 extern ecma_value_t
 ecma_op_array_object_define_own_property (ecma_object_t *, ecma_string_t *, const ecma_property_descriptor_t *, bool);
 
+extern ecma_property_t *
+ecma_op_array_object_get_own_property (ecma_object_t *, ecma_string_t *);
+
+extern void
+ecma_op_array_list_lazy_property_names (ecma_object_t *,
+                                        bool,
+                                        ecma_collection_header_t *,
+                                        ecma_collection_header_t *);
+
 /**
  * @}
  * @}
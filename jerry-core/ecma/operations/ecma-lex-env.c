@@ -418,7 +418,7 @@ ecma_op_create_immutable_binding (ecma_object_t *lex_env_p, /**< lexical environ
 
   JERRY_ASSERT (ecma_is_value_undefined (ecma_get_named_data_property_value (prop_p)));
 
-  ecma_set_named_data_property_value (prop_p,
+  ecma_set_named_data_property_value (lex_env_p, prop_p,
                                       ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY));
 } /* ecma_op_create_immutable_binding */
 
@@ -48,7 +48,9 @@ ecma_op_create_number_object (ecma_value_t arg) /**< argument passed to the Numb
     return conv_to_num_completion;
   }
 
-  ecma_number_t *prim_value_p = ecma_get_number_from_value (conv_to_num_completion);
+  ecma_number_t *prim_value_p = ecma_alloc_number ();
+  *prim_value_p = ecma_get_number_from_value (conv_to_num_completion);
+  ecma_free_value (conv_to_num_completion);
 
 #ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_NUMBER_BUILTIN
   ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_NUMBER_PROTOTYPE);
@@ -169,15 +169,21 @@ ecma_op_create_arguments_object (ecma_object_t *func_obj_p, /**< callee function
        * [[Class]] property is not stored explicitly for objects of ECMA_OBJECT_TYPE_ARGUMENTS type.
        *
        * See also: ecma_object_get_class_name
+       *
+       * Note:
+       *      the property is looked up again, since creating the properties above might have moved it
        */
+      class_prop_p = ecma_get_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
       ecma_delete_property (obj_p, class_prop_p);
 
       ecma_property_t *parameters_map_prop_p = ecma_create_internal_property (obj_p,
                                                                               ECMA_INTERNAL_PROPERTY_PARAMETERS_MAP);
+      ecma_gc_write_barrier (obj_p, map_p);
       ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (parameters_map_prop_p)->value, map_p);
 
       ecma_property_t *scope_prop_p = ecma_create_internal_property (map_p,
                                                                      ECMA_INTERNAL_PROPERTY_SCOPE);
+      ecma_gc_write_barrier (map_p, lex_env_p);
       ECMA_SET_POINTER (ECMA_PROPERTY_VALUE_PTR (scope_prop_p)->value, lex_env_p);
 
       ecma_deref_object (map_p);
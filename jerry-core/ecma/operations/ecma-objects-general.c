@@ -21,6 +21,7 @@
 #include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "ecma-helpers.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-try-catch-macro.h"
@@ -235,14 +236,40 @@ ecma_op_general_object_get_property (ecma_object_t *obj_p, /**< the object */
   ecma_object_t *prototype_p = ecma_get_object_prototype (obj_p);
 
   // 4., 5.
-  if (prototype_p != NULL)
+  if (prototype_p == NULL)
   {
-    return ecma_op_object_get_property (prototype_p, property_name_p);
+    return NULL;
   }
-  else
+
+  if (ecma_lcache_chain_lookup (prototype_p, property_name_p, &prop_p))
   {
-    return NULL;
+    return prop_p;
+  }
+
+  /* The [[GetProperty]] operation of every object type is the general one,
+   * so the rest of the prototype chain is walked without recursion. */
+  ecma_object_t *holder_p = prototype_p;
+
+  do
+  {
+    prop_p = ecma_op_object_get_own_property (holder_p, property_name_p);
+
+    if (prop_p != NULL)
+    {
+      break;
+    }
+
+    holder_p = ecma_get_object_prototype (holder_p);
+  }
+  while (holder_p != NULL);
+
+  /* The constant property of built-ins describes a different property upon each request. */
+  if (prop_p == NULL || !ecma_builtin_is_constant_property (prop_p))
+  {
+    ecma_lcache_chain_insert (prototype_p, property_name_p, holder_p, prop_p);
   }
+
+  return prop_p;
 } /* ecma_op_general_object_get_property */
 
 /**
@@ -604,6 +631,11 @@ ecma_op_general_object_define_own_property (ecma_object_t *obj_p, /**< the objec
   // 1.
   ecma_property_t *current_p = ecma_op_object_get_own_property (obj_p, property_name_p);
 
+  if (current_p != NULL && ecma_builtin_is_constant_property (current_p))
+  {
+    current_p = ecma_builtin_instantiate_constant_property (obj_p, property_name_p);
+  }
+
   // 2.
   bool extensible = ecma_get_object_extensible (obj_p);
 
@@ -13,8 +13,10 @@
  * limitations under the License.
  */
 
+#include "ecma-alloc.h"
 #include "ecma-array-object.h"
 #include "ecma-builtins.h"
+#include "ecma-conversion.h"
 #include "ecma-exceptions.h"
 #include "ecma-globals.h"
 #include "ecma-function-object.h"
@@ -23,6 +25,9 @@
 #include "ecma-objects-arguments.h"
 #include "ecma-objects-general.h"
 #include "ecma-objects.h"
+#include "ecma-shape.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
 
 /** \addtogroup ecma ECMA
  * @{
@@ -31,6 +36,11 @@
  * @{
  */
 
+/**
+ * Number of bits in the property name hash bitmaps of ecma_op_object_get_property_names
+ */
+#define ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE 256
+
 /**
  * Assert that specified object type value is valid
  */
@@ -91,6 +101,132 @@ ecma_op_object_get (ecma_object_t *obj_p, /**< the object */
   return ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 } /* ecma_op_object_get */
 
+/**
+ * [[Get]] ecma object's operation with an index as property name
+ *
+ * Note:
+ *      the elements of arrays, typed arrays, Arguments objects and String objects are read
+ *      without creating a string for the property name. The name is only created, if the
+ *      property is not an own data property of the object (e.g. it is inherited).
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_object_get_by_index (ecma_object_t *obj_p, /**< the object */
+                             uint32_t index) /**< property name */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+
+  const ecma_object_type_t type = ecma_get_object_type (obj_p);
+  ecma_assert_object_type_is_valid (type);
+
+  switch (type)
+  {
+    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+      ecma_array_elements_t *elements_p = ecma_get_array_elements (obj_p);
+
+      if (elements_p != NULL)
+      {
+        if (index < elements_p->capacity)
+        {
+          ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+          if (ECMA_PROPERTY_GET_TYPE (element_p) != ECMA_PROPERTY_TYPE_DELETED)
+          {
+            return ecma_copy_value (ecma_get_named_data_property_value (element_p));
+          }
+        }
+
+        /* Holes are looked up in the prototype chain. */
+        break;
+      }
+
+      /* FALLTHRU */
+    }
+
+    case ECMA_OBJECT_TYPE_GENERAL:
+    case ECMA_OBJECT_TYPE_ARGUMENTS:
+    {
+      /* The properties of built-in objects are instantiated lazily. */
+      if (ecma_get_object_is_builtin (obj_p))
+      {
+        break;
+      }
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+      ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (obj_p);
+
+      if (typedarray_p != NULL)
+      {
+        if (index < typedarray_p->length)
+        {
+          ecma_number_t *num_p = ecma_alloc_number ();
+          *num_p = ecma_op_typedarray_get_element (typedarray_p, index);
+
+          return ecma_make_number_value (num_p);
+        }
+
+        break;
+      }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+      /* The name is only used for lookups, so it is never referenced by a property. */
+      ecma_string_t index_string;
+      ecma_init_ecma_string_from_uint32 (&index_string, index);
+
+      ecma_property_t *property_p = ecma_find_named_property (obj_p, &index_string);
+
+      if (property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA)
+      {
+        if (type == ECMA_OBJECT_TYPE_ARGUMENTS)
+        {
+          /* The value of a mapped argument is read from the lexical environment. */
+          return ecma_op_arguments_object_get (obj_p, &index_string);
+        }
+
+        return ecma_copy_value (ecma_get_named_data_property_value (property_p));
+      }
+
+      break;
+    }
+
+    case ECMA_OBJECT_TYPE_STRING:
+    {
+      ecma_property_t *prim_value_prop_p = ecma_get_internal_property (obj_p,
+                                                                       ECMA_INTERNAL_PROPERTY_PRIMITIVE_STRING_VALUE);
+      ecma_string_t *prim_value_str_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t,
+                                                                   ECMA_PROPERTY_VALUE_PTR (prim_value_prop_p)->value);
+
+      /* The index properties of String objects are neither writable nor configurable. */
+      if (index < ecma_string_get_length (prim_value_str_p))
+      {
+        ecma_char_t c = ecma_string_get_char_at_pos (prim_value_str_p, index);
+
+        return ecma_make_string_value (ecma_new_ecma_string_from_code_unit (c));
+      }
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+  ecma_value_t ret_value = ecma_op_object_get (obj_p, index_string_p);
+
+  ecma_deref_ecma_string (index_string_p);
+
+  return ret_value;
+} /* ecma_op_object_get_by_index */
+
 /**
  * Long path for ecma_op_object_get_own_property
  *
@@ -111,7 +247,29 @@ ecma_op_object_get_own_property_longpath (ecma_object_t *obj_p, /**< the object
   switch (type)
   {
     case ECMA_OBJECT_TYPE_GENERAL:
-    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+      uint32_t index;
+
+      /* The elements of typed arrays are not stored in the property list. */
+      if (ecma_string_get_array_index (property_name_p, &index))
+      {
+        ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (obj_p);
+
+        if (typedarray_p != NULL)
+        {
+          prop_p = ecma_op_typedarray_get_element_property (typedarray_p, index);
+
+          break;
+        }
+      }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+      prop_p = ecma_op_general_object_get_own_property (obj_p, property_name_p);
+
+      break;
+    }
+
     case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
     case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
     case ECMA_OBJECT_TYPE_BUILT_IN_FUNCTION:
@@ -121,6 +279,13 @@ ecma_op_object_get_own_property_longpath (ecma_object_t *obj_p, /**< the object
       break;
     }
 
+    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+      prop_p = ecma_op_array_object_get_own_property (obj_p, property_name_p);
+
+      break;
+    }
+
     case ECMA_OBJECT_TYPE_FUNCTION:
     {
       prop_p = ecma_op_function_object_get_own_property (obj_p, property_name_p);
@@ -175,6 +340,14 @@ ecma_op_object_get_own_property (ecma_object_t *obj_p, /**< the object */
 
   if (likely (ecma_lcache_lookup (obj_p, property_name_p, &prop_p)))
   {
+    /* Constant built-in properties are not instantiated, so the LCache only records
+     * that the object has no property with the name. */
+    if (unlikely (prop_p == NULL)
+        && ecma_get_object_is_builtin (obj_p))
+    {
+      return ecma_builtin_try_to_instantiate_property (obj_p, property_name_p);
+    }
+
     return prop_p;
   }
   else
@@ -265,6 +438,132 @@ ecma_op_object_put (ecma_object_t *obj_p, /**< the object */
   return ecma_op_general_object_put (obj_p, property_name_p, value, is_throw);
 } /* ecma_op_object_put */
 
+/**
+ * [[Put]] ecma object's operation with an index as property name
+ *
+ * Note:
+ *      the existing elements of arrays, typed arrays and Arguments objects are written
+ *      without creating a string for the property name. The name is only created, if the
+ *      property is not an own writable data property of the object (e.g. it is a new element).
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_object_put_by_index (ecma_object_t *obj_p, /**< the object */
+                             uint32_t index, /**< property name */
+                             ecma_value_t value, /**< ecma value */
+                             bool is_throw) /**< flag that controls failure handling */
+{
+  JERRY_ASSERT (obj_p != NULL
+                && !ecma_is_lexical_environment (obj_p));
+
+  const ecma_object_type_t type = ecma_get_object_type (obj_p);
+  ecma_assert_object_type_is_valid (type);
+
+  switch (type)
+  {
+    case ECMA_OBJECT_TYPE_ARRAY:
+    {
+      ecma_array_elements_t *elements_p = ecma_get_array_elements (obj_p);
+
+      if (elements_p != NULL)
+      {
+        /* The elements of the fast element storage are writable data properties. */
+        if (index < elements_p->capacity)
+        {
+          ecma_property_t *element_p = ECMA_ARRAY_ELEMENTS_GET_PROPERTY (elements_p, index);
+
+          if (ECMA_PROPERTY_GET_TYPE (element_p) != ECMA_PROPERTY_TYPE_DELETED)
+          {
+            ecma_named_data_property_assign_value (obj_p, element_p, value);
+
+            return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+          }
+        }
+
+        break;
+      }
+
+      /* FALLTHRU */
+    }
+
+    case ECMA_OBJECT_TYPE_GENERAL:
+    case ECMA_OBJECT_TYPE_ARGUMENTS:
+    {
+      if (ecma_get_object_is_builtin (obj_p))
+      {
+        break;
+      }
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+      ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (obj_p);
+
+      if (typedarray_p != NULL)
+      {
+        if (index < typedarray_p->length)
+        {
+          ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+          ECMA_OP_TO_NUMBER_TRY_CATCH (num, value, ret_value);
+
+          ecma_op_typedarray_set_element (typedarray_p, index, num);
+          ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+
+          ECMA_OP_TO_NUMBER_FINALIZE (num);
+
+          return ret_value;
+        }
+
+        break;
+      }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+      /* The name is only used for lookups, so it is never referenced by a property. */
+      ecma_string_t index_string;
+      ecma_init_ecma_string_from_uint32 (&index_string, index);
+
+      ecma_property_t *property_p = ecma_find_named_property (obj_p, &index_string);
+
+      if (property_p != NULL
+          && ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
+          && ecma_is_property_writable (property_p))
+      {
+        if (type == ECMA_OBJECT_TYPE_ARGUMENTS)
+        {
+          /* Mapped arguments are also written to the lexical environment (ECMA-262 v5, 8.12.5 step 3). */
+          ecma_property_descriptor_t value_desc = ecma_make_empty_property_descriptor ();
+          {
+            value_desc.is_value_defined = true;
+            value_desc.value = value;
+          }
+
+          return ecma_op_arguments_object_define_own_property (obj_p, &index_string, &value_desc, is_throw);
+        }
+
+        ecma_named_data_property_assign_value (obj_p, property_p, value);
+
+        return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+      }
+
+      break;
+    }
+
+    default:
+    {
+      break;
+    }
+  }
+
+  ecma_string_t *index_string_p = ecma_new_ecma_string_from_uint32 (index);
+
+  ecma_value_t ret_value = ecma_op_object_put (obj_p, index_string_p, value, is_throw);
+
+  ecma_deref_ecma_string (index_string_p);
+
+  return ret_value;
+} /* ecma_op_object_put_by_index */
+
 /**
  * [[CanPut]] ecma object's operation
  *
@@ -419,6 +718,27 @@ ecma_op_object_define_own_property (ecma_object_t *obj_p, /**< the object */
   switch (type)
   {
     case ECMA_OBJECT_TYPE_GENERAL:
+    {
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+      uint32_t index;
+
+      if (ecma_string_get_array_index (property_name_p, &index))
+      {
+        ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (obj_p);
+
+        if (typedarray_p != NULL)
+        {
+          return ecma_op_typedarray_define_element (typedarray_p, index, property_desc_p, is_throw);
+        }
+      }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+      return ecma_op_general_object_define_own_property (obj_p,
+                                                         property_name_p,
+                                                         property_desc_p,
+                                                         is_throw);
+    }
+
     case ECMA_OBJECT_TYPE_FUNCTION:
     case ECMA_OBJECT_TYPE_BOUND_FUNCTION:
     case ECMA_OBJECT_TYPE_EXTERNAL_FUNCTION:
@@ -529,6 +849,8 @@ ecma_op_object_is_prototype_of (ecma_object_t *base_p, /**< base object */
  *      Implementation of the routine assumes that new properties are appended to beginning of corresponding object's
  *      property list, and the list is not reordered (in other words, properties are stored in order that is reversed
  *      to the properties' addition order).
+ *      Slot arrays of objects with shape store the properties in addition order, so they are traversed backwards.
+ *      The property name hash map (if any) is only an index of the list, so it is skipped.
  *
  * @return collection of strings - property names
  */
@@ -550,7 +872,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
   ecma_assert_object_type_is_valid (type);
 
   const size_t bitmap_row_size = sizeof (uint32_t) * JERRY_BITSINBYTE;
-  uint32_t names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+  uint32_t names_hashes_bitmap[ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE / bitmap_row_size];
 
   memset (names_hashes_bitmap, 0, sizeof (names_hashes_bitmap));
 
@@ -604,17 +926,38 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
+    /* The elements of arrays with fast element storage are not stored in the property list. */
+    if (ecma_get_object_type (prototype_chain_iter_p) == ECMA_OBJECT_TYPE_ARRAY)
+    {
+      ecma_op_array_list_lazy_property_names (prototype_chain_iter_p,
+                                              is_enumerable_only,
+                                              prop_names_p,
+                                              skipped_non_enumerable_p);
+    }
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+    else
+    {
+      /* The elements of typed arrays are not stored in the property list either. */
+      ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (prototype_chain_iter_p);
+
+      if (typedarray_p != NULL)
+      {
+        ecma_op_typedarray_list_lazy_property_names (typedarray_p, prop_names_p);
+      }
+    }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
     ecma_collection_iterator_t iter;
     ecma_collection_iterator_init (&iter, prop_names_p);
 
-    uint32_t own_names_hashes_bitmap[(1u << LIT_STRING_HASH_BITS) / bitmap_row_size];
+    uint32_t own_names_hashes_bitmap[ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE / bitmap_row_size];
     memset (own_names_hashes_bitmap, 0, sizeof (own_names_hashes_bitmap));
 
     while (ecma_collection_iterator_next (&iter))
     {
       ecma_string_t *name_p = ecma_get_string_from_value (*iter.current_value_p);
 
-      lit_string_hash_t hash = name_p->hash;
+      uint32_t hash = name_p->hash % ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE;
       uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
       uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -624,25 +967,59 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
       }
     }
 
+    /* The names in the property list are unique, so they only need to be checked against the lazy names. */
+    ecma_length_t lazy_names_count = prop_names_p->unit_number;
+
     ecma_property_header_t *prop_iter_p = ecma_get_property_list (prototype_chain_iter_p);
 
+    if (prop_iter_p != NULL && ECMA_PROPERTY_IS_HASHMAP (prop_iter_p))
+    {
+      prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
+                                      prop_iter_p->next_property_cp);
+    }
+
     while (prop_iter_p != NULL)
     {
-      JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+      ecma_shape_t *shape_p = NULL;
+      uint32_t item_count = ECMA_PROPERTY_PAIR_ITEM_COUNT;
+
+      if (ECMA_PROPERTY_IS_SLOTS (prop_iter_p))
+      {
+        shape_p = ECMA_GET_NON_NULL_POINTER (ecma_shape_t, ((ecma_property_slots_t *) prop_iter_p)->shape_cp);
+        item_count = shape_p->property_count;
+      }
+      else
+      {
+        JERRY_ASSERT (ECMA_PROPERTY_IS_PROPERTY_PAIR (prop_iter_p));
+      }
 
-      for (int i = 0; i < ECMA_PROPERTY_PAIR_ITEM_COUNT; i++)
+      for (uint32_t i = 0; i < item_count; i++)
       {
-        ecma_property_t *property_p = prop_iter_p->types + i;
+        ecma_property_t *property_p;
+        ecma_string_t *name_p;
+
+        if (shape_p != NULL)
+        {
+          /* Slots are visited backwards, since they are in the properties' addition order. */
+          uint32_t index = item_count - 1 - i;
+
+          property_p = ECMA_PROPERTY_SLOTS_GET_PROPERTY ((ecma_property_slots_t *) prop_iter_p, index);
+          name_p = ecma_shape_get_property_name (shape_p, index);
+        }
+        else
+        {
+          property_p = prop_iter_p->types + i;
+          name_p = ECMA_GET_POINTER (ecma_string_t, ((ecma_property_pair_t *) prop_iter_p)->names_cp[i]);
+        }
 
         if (ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDDATA
             || ECMA_PROPERTY_GET_TYPE (property_p) == ECMA_PROPERTY_TYPE_NAMEDACCESSOR)
         {
-          ecma_property_pair_t *prop_pair_p = (ecma_property_pair_t *) prop_iter_p;
-          ecma_string_t *name_p = ECMA_GET_NON_NULL_POINTER (ecma_string_t, prop_pair_p->names_cp[i]);
+          JERRY_ASSERT (name_p != NULL);
 
           if (!(is_enumerable_only && !ecma_is_property_enumerable (property_p)))
           {
-            lit_string_hash_t hash = name_p->hash;
+            uint32_t hash = name_p->hash % ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE;
             uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
             uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -652,7 +1029,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
             {
               ecma_collection_iterator_init (&iter, prop_names_p);
 
-              while (ecma_collection_iterator_next (&iter))
+              for (ecma_length_t j = 0; j < lazy_names_count && ecma_collection_iterator_next (&iter); j++)
               {
                 ecma_string_t *name2_p = ecma_get_string_from_value (*iter.current_value_p);
 
@@ -666,8 +1043,6 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
             if (is_add)
             {
-              own_names_hashes_bitmap[bitmap_row] |= (1u << bitmap_column);
-
               ecma_append_to_values_collection (prop_names_p,
                                                 ecma_make_string_value (name_p),
                                                 true);
@@ -681,7 +1056,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
                                               ecma_make_string_value (name_p),
                                               true);
 
-            lit_string_hash_t hash = name_p->hash;
+            uint32_t hash = name_p->hash % ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE;
             uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
             uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -693,6 +1068,12 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
         }
       }
 
+      if (shape_p != NULL)
+      {
+        /* The slot array is the only item of the list. */
+        break;
+      }
+
       prop_iter_p = ECMA_GET_POINTER (ecma_property_header_t,
                                       prop_iter_p->next_property_cp);
     }
@@ -736,6 +1117,13 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
         JERRY_ASSERT (array_index_name_pos < array_index_named_properties_count);
 
         uint32_t insertion_pos = 0;
+
+        /* The names of array elements are usually listed in descending order, so they are appended. */
+        if (array_index_name_pos > 0 && index < array_index_names_p[array_index_name_pos - 1])
+        {
+          insertion_pos = array_index_name_pos;
+        }
+
         while (insertion_pos < array_index_name_pos
                && index < array_index_names_p[insertion_pos])
         {
@@ -799,7 +1187,7 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
 
       ecma_string_t *name_p = names_p[i];
 
-      lit_string_hash_t hash = name_p->hash;
+      uint32_t hash = name_p->hash % ECMA_OBJECT_NAMES_HASH_BITMAP_SIZE;
       uint32_t bitmap_row = (uint32_t) (hash / bitmap_row_size);
       uint32_t bitmap_column = (uint32_t) (hash % bitmap_row_size);
 
@@ -816,15 +1204,22 @@ ecma_op_object_get_property_names (ecma_object_t *obj_p, /**< object */
         bool is_equal_found = false;
 
         ecma_collection_iterator_t iter;
-        ecma_collection_iterator_init (&iter, ret_p);
 
-        while (ecma_collection_iterator_next (&iter))
+        /* The own property names of the object are unique, so they are only
+         * checked against the collected names when visiting the prototypes. */
+        if (prototype_chain_iter_p != obj_p)
         {
-          ecma_string_t *iter_name_p = ecma_get_string_from_value (*iter.current_value_p);
+          ecma_collection_iterator_init (&iter, ret_p);
 
-          if (ecma_compare_ecma_strings (name_p, iter_name_p))
+          while (ecma_collection_iterator_next (&iter))
           {
-            is_equal_found = true;
+            ecma_string_t *iter_name_p = ecma_get_string_from_value (*iter.current_value_p);
+
+            if (ecma_compare_ecma_strings (name_p, iter_name_p))
+            {
+              is_equal_found = true;
+              break;
+            }
           }
         }
 
@@ -961,6 +1356,24 @@ ecma_object_get_class_name (ecma_object_t *obj_p) /**< object */
             return LIT_MAGIC_STRING_REGEXP_UL;
           }
 #endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_REGEXP_BUILTIN */
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+          case ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE:
+          case ECMA_BUILTIN_ID_TYPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE:
+          case ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE:
+          {
+            /* The prototypes are ordinary objects in ECMA-262 v6. */
+            return LIT_MAGIC_STRING_OBJECT_UL;
+          }
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
           default:
           {
             JERRY_ASSERT (ecma_builtin_is (obj_p, ECMA_BUILTIN_ID_GLOBAL));
@@ -27,9 +27,11 @@
  */
 
 extern ecma_value_t ecma_op_object_get (ecma_object_t *, ecma_string_t *);
+extern ecma_value_t ecma_op_object_get_by_index (ecma_object_t *, uint32_t);
 extern ecma_property_t *ecma_op_object_get_own_property (ecma_object_t *, ecma_string_t *);
 extern ecma_property_t *ecma_op_object_get_property (ecma_object_t *, ecma_string_t *);
 extern ecma_value_t ecma_op_object_put (ecma_object_t *, ecma_string_t *, ecma_value_t, bool);
+extern ecma_value_t ecma_op_object_put_by_index (ecma_object_t *, uint32_t, ecma_value_t, bool);
 extern bool ecma_op_object_can_put (ecma_object_t *, ecma_string_t *);
 extern ecma_value_t ecma_op_object_delete (ecma_object_t *, ecma_string_t *, bool);
 extern ecma_value_t ecma_op_object_default_value (ecma_object_t *, ecma_preferred_type_hint_t);
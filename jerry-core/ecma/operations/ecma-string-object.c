@@ -104,7 +104,7 @@ ecma_op_create_string_object (const ecma_value_t *arguments_list_p, /**< list of
                                                                     false, false, false);
   ecma_number_t *length_prop_value_p = ecma_alloc_number ();
   *length_prop_value_p = length_value;
-  ecma_set_named_data_property_value (length_prop_p, ecma_make_number_value (length_prop_value_p));
+  ecma_set_named_data_property_value (obj_p, length_prop_p, ecma_make_number_value (length_prop_value_p));
   ecma_deref_ecma_string (length_magic_string_p);
 
   return ecma_make_object_value (obj_p);
@@ -194,7 +194,7 @@ ecma_op_string_object_get_own_property (ecma_object_t *obj_p, /**< a String obje
                                                   new_prop_name_p,
                                                   false, true, false);
 
-    ecma_set_named_data_property_value (new_prop_p,
+    ecma_set_named_data_property_value (obj_p, new_prop_p,
                                         ecma_make_string_value (new_prop_str_value_p));
   }
 
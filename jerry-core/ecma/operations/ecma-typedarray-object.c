@@ -0,0 +1,999 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#include "ecma-alloc.h"
+#include "ecma-builtins.h"
+#include "ecma-exceptions.h"
+#include "ecma-gc.h"
+#include "ecma-globals.h"
+#include "ecma-helpers.h"
+#include "ecma-objects.h"
+#include "ecma-objects-general.h"
+#include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
+#include "jrt-libc-includes.h"
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA ArrayBuffer, typed array and DataView object related routines
+ * @{
+ */
+
+/**
+ * Maximum byte length of an ArrayBuffer
+ */
+#define ECMA_ARRAYBUFFER_MAX_LENGTH ((uint32_t) CONFIG_MEM_HEAP_AREA_SIZE)
+
+/**
+ * Prototypes of the typed arrays and the DataView objects (indexed by ecma_typedarray_type_t)
+ */
+static const ecma_builtin_id_t ecma_typedarray_prototype_ids[] =
+{
+  ECMA_BUILTIN_ID_INT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT8CLAMPEDARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT16ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_INT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_UINT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT32ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_FLOAT64ARRAY_PROTOTYPE,
+  ECMA_BUILTIN_ID_DATAVIEW_PROTOTYPE
+};
+
+/**
+ * Class names of the typed arrays and the DataView objects (indexed by ecma_typedarray_type_t)
+ */
+static const uint16_t ecma_typedarray_class_names[] =
+{
+  LIT_MAGIC_STRING_INT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL,
+  LIT_MAGIC_STRING_INT16_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT16_ARRAY_UL,
+  LIT_MAGIC_STRING_INT32_ARRAY_UL,
+  LIT_MAGIC_STRING_UINT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT32_ARRAY_UL,
+  LIT_MAGIC_STRING_FLOAT64_ARRAY_UL,
+  LIT_MAGIC_STRING_DATA_VIEW_UL
+};
+
+/**
+ * Binary logarithm of the element sizes (indexed by ecma_typedarray_type_t)
+ *
+ * Note:
+ *      the view of a DataView is indexed by bytes
+ */
+static const uint8_t ecma_typedarray_element_size_log2[] =
+{
+  0, /* Int8Array */
+  0, /* Uint8Array */
+  0, /* Uint8ClampedArray */
+  1, /* Int16Array */
+  1, /* Uint16Array */
+  2, /* Int32Array */
+  2, /* Uint32Array */
+  2, /* Float32Array */
+  3, /* Float64Array */
+  0  /* DataView */
+};
+
+JERRY_STATIC_ASSERT (sizeof (ecma_typedarray_prototype_ids) / sizeof (ecma_typedarray_prototype_ids[0])
+                     == ECMA_TYPEDARRAY_DATAVIEW + 1,
+                     ecma_typedarray_prototype_ids_must_have_an_entry_for_each_view_type);
+JERRY_STATIC_ASSERT (sizeof (ecma_typedarray_element_size_log2) == ECMA_TYPEDARRAY_DATAVIEW + 1,
+                     ecma_typedarray_element_size_log2_must_have_an_entry_for_each_view_type);
+
+/**
+ * Create an ArrayBuffer object for a data block
+ *
+ * @return pointer to the new ArrayBuffer object
+ */
+static ecma_object_t *
+ecma_op_create_arraybuffer_object_for_data_block (ecma_arraybuffer_t *arraybuffer_p) /**< data block */
+{
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ECMA_BUILTIN_ID_ARRAYBUFFER_PROTOTYPE);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  ECMA_PROPERTY_VALUE_PTR (class_prop_p)->value = LIT_MAGIC_STRING_ARRAY_BUFFER_UL;
+
+  ecma_property_t *arraybuffer_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+  ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (arraybuffer_prop_p)->value, arraybuffer_p);
+
+  return obj_p;
+} /* ecma_op_create_arraybuffer_object_for_data_block */
+
+/**
+ * ArrayBuffer object creation operation.
+ *
+ * See also: ECMA-262 v6, 24.1.1.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_arraybuffer_object (uint32_t length) /**< byte length */
+{
+  if (length > ECMA_ARRAYBUFFER_MAX_LENGTH)
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_arraybuffer_t *arraybuffer_p = ecma_alloc_arraybuffer (sizeof (ecma_arraybuffer_t) + length);
+
+  arraybuffer_p->buffer_p = (uint8_t *) (arraybuffer_p + 1);
+  arraybuffer_p->free_cb = 0;
+  arraybuffer_p->length = length;
+
+  memset (arraybuffer_p->buffer_p, 0, length);
+
+  return ecma_make_object_value (ecma_op_create_arraybuffer_object_for_data_block (arraybuffer_p));
+} /* ecma_op_create_arraybuffer_object */
+
+/**
+ * Create an ArrayBuffer object, which uses an external (host) memory block as its data block
+ *
+ * Note:
+ *      the memory block is passed to the free callback (if any), when the object is freed
+ *
+ * @return pointer to the new ArrayBuffer object
+ */
+ecma_object_t *
+ecma_op_create_external_arraybuffer_object (uint8_t *buffer_p, /**< external memory block */
+                                            uint32_t length, /**< byte length of the memory block */
+                                            ecma_external_pointer_t free_cb) /**< free callback (or 0) */
+{
+  ecma_arraybuffer_t *arraybuffer_p = ecma_alloc_arraybuffer (sizeof (ecma_arraybuffer_t));
+
+  arraybuffer_p->buffer_p = buffer_p;
+  arraybuffer_p->free_cb = free_cb;
+  arraybuffer_p->length = length;
+
+  return ecma_op_create_arraybuffer_object_for_data_block (arraybuffer_p);
+} /* ecma_op_create_external_arraybuffer_object */
+
+/**
+ * Get the data block of an ArrayBuffer object
+ *
+ * @return pointer to the data block - if the object is an ArrayBuffer,
+ *         NULL - otherwise
+ */
+ecma_arraybuffer_t *
+ecma_op_get_arraybuffer (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL
+      || ecma_get_object_is_builtin (obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_property_t *arraybuffer_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_ARRAYBUFFER);
+
+  if (arraybuffer_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_arraybuffer_t, ECMA_PROPERTY_VALUE_PTR (arraybuffer_prop_p)->value);
+} /* ecma_op_get_arraybuffer */
+
+/**
+ * Get the view of a typed array or a DataView object
+ *
+ * Note:
+ *      the prototype of a view is checked first, so the property list of most objects is not searched
+ *
+ * @return pointer to the view - if the object is a typed array or a DataView,
+ *         NULL - otherwise
+ */
+static ecma_typedarray_t *
+ecma_op_get_view (ecma_object_t *obj_p) /**< object */
+{
+  if (ecma_get_object_type (obj_p) != ECMA_OBJECT_TYPE_GENERAL
+      || ecma_get_object_is_builtin (obj_p))
+  {
+    return NULL;
+  }
+
+  ecma_object_t *prototype_obj_p = ecma_get_object_prototype (obj_p);
+
+  if (prototype_obj_p == NULL
+      || !ecma_get_object_is_builtin (prototype_obj_p)
+      || ecma_builtin_is (prototype_obj_p, ECMA_BUILTIN_ID_OBJECT_PROTOTYPE))
+  {
+    return NULL;
+  }
+
+  uint32_t type;
+
+  for (type = 0; type <= ECMA_TYPEDARRAY_DATAVIEW; type++)
+  {
+    if (ecma_builtin_is (prototype_obj_p, ecma_typedarray_prototype_ids[type]))
+    {
+      break;
+    }
+  }
+
+  if (type > ECMA_TYPEDARRAY_DATAVIEW)
+  {
+    return NULL;
+  }
+
+  ecma_property_t *typedarray_prop_p = ecma_find_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY);
+
+  if (typedarray_prop_p == NULL)
+  {
+    return NULL;
+  }
+
+  return ECMA_GET_NON_NULL_POINTER (ecma_typedarray_t, ECMA_PROPERTY_VALUE_PTR (typedarray_prop_p)->value);
+} /* ecma_op_get_view */
+
+/**
+ * Get the view of a typed array object
+ *
+ * @return pointer to the view - if the object is a typed array,
+ *         NULL - otherwise
+ */
+ecma_typedarray_t *
+ecma_op_get_typedarray (ecma_object_t *obj_p) /**< object */
+{
+  ecma_typedarray_t *typedarray_p = ecma_op_get_view (obj_p);
+
+  if (typedarray_p == NULL || typedarray_p->type == ECMA_TYPEDARRAY_DATAVIEW)
+  {
+    return NULL;
+  }
+
+  return typedarray_p;
+} /* ecma_op_get_typedarray */
+
+/**
+ * Get the view of a DataView object
+ *
+ * @return pointer to the view - if the object is a DataView,
+ *         NULL - otherwise
+ */
+ecma_typedarray_t *
+ecma_op_get_dataview (ecma_object_t *obj_p) /**< object */
+{
+  ecma_typedarray_t *typedarray_p = ecma_op_get_view (obj_p);
+
+  if (typedarray_p == NULL || typedarray_p->type != ECMA_TYPEDARRAY_DATAVIEW)
+  {
+    return NULL;
+  }
+
+  return typedarray_p;
+} /* ecma_op_get_dataview */
+
+/**
+ * Get the size of the elements of a view type
+ *
+ * @return size in bytes
+ */
+uint32_t
+ecma_op_typedarray_get_element_size (ecma_typedarray_type_t type) /**< view type */
+{
+  JERRY_ASSERT (type <= ECMA_TYPEDARRAY_DATAVIEW);
+
+  return 1u << ecma_typedarray_element_size_log2[type];
+} /* ecma_op_typedarray_get_element_size */
+
+/**
+ * Read a number from the memory in the native byte order
+ *
+ * @return the number
+ */
+ecma_number_t
+ecma_op_typedarray_read_number (ecma_typedarray_type_t type, /**< element type */
+                                const uint8_t *src_p) /**< first byte of the number */
+{
+  /* The elements of external data blocks might be unaligned, so they are copied. */
+  switch (type)
+  {
+    case ECMA_TYPEDARRAY_INT8:
+    {
+      return (ecma_number_t) (int8_t) src_p[0];
+    }
+    case ECMA_TYPEDARRAY_UINT8:
+    case ECMA_TYPEDARRAY_UINT8_CLAMPED:
+    {
+      return (ecma_number_t) src_p[0];
+    }
+    case ECMA_TYPEDARRAY_INT16:
+    {
+      int16_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_UINT16:
+    {
+      uint16_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_INT32:
+    {
+      int32_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_UINT32:
+    {
+      uint32_t value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    case ECMA_TYPEDARRAY_FLOAT32:
+    {
+      float value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_TYPEDARRAY_FLOAT64);
+
+      double value;
+      memcpy (&value, src_p, sizeof (value));
+      return (ecma_number_t) value;
+    }
+  }
+} /* ecma_op_typedarray_read_number */
+
+/**
+ * Convert a number to the value of an Uint8ClampedArray element
+ *
+ * See also: ECMA-262 v6, 7.1.11
+ *
+ * @return the clamped value
+ */
+static uint8_t
+ecma_op_typedarray_clamp_number (ecma_number_t num) /**< number */
+{
+  if (ecma_number_is_nan (num) || num <= ECMA_NUMBER_ZERO)
+  {
+    return 0;
+  }
+
+  if (num >= (ecma_number_t) 255)
+  {
+    return 255;
+  }
+
+  ecma_number_t floor = ecma_number_trunc (num);
+  ecma_number_t half = DOUBLE_TO_ECMA_NUMBER_T (0.5);
+  uint8_t result = (uint8_t) floor;
+
+  /* Ties are rounded to even. */
+  if (floor + half < num
+      || (floor + half == num && (result & 0x1) != 0))
+  {
+    result++;
+  }
+
+  return result;
+} /* ecma_op_typedarray_clamp_number */
+
+/**
+ * Write a number to the memory in the native byte order
+ *
+ * See also: ECMA-262 v6, 24.1.1.6
+ */
+void
+ecma_op_typedarray_write_number (ecma_typedarray_type_t type, /**< element type */
+                                 uint8_t *dst_p, /**< first byte of the number */
+                                 ecma_number_t num) /**< number */
+{
+  switch (type)
+  {
+    case ECMA_TYPEDARRAY_INT8:
+    case ECMA_TYPEDARRAY_UINT8:
+    {
+      dst_p[0] = (uint8_t) ecma_number_to_uint32 (num);
+      break;
+    }
+    case ECMA_TYPEDARRAY_UINT8_CLAMPED:
+    {
+      dst_p[0] = ecma_op_typedarray_clamp_number (num);
+      break;
+    }
+    case ECMA_TYPEDARRAY_INT16:
+    case ECMA_TYPEDARRAY_UINT16:
+    {
+      uint16_t value = (uint16_t) ecma_number_to_uint32 (num);
+      memcpy (dst_p, &value, sizeof (value));
+      break;
+    }
+    case ECMA_TYPEDARRAY_INT32:
+    case ECMA_TYPEDARRAY_UINT32:
+    {
+      uint32_t value = ecma_number_to_uint32 (num);
+      memcpy (dst_p, &value, sizeof (value));
+      break;
+    }
+    case ECMA_TYPEDARRAY_FLOAT32:
+    {
+      float value = (float) num;
+      memcpy (dst_p, &value, sizeof (value));
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (type == ECMA_TYPEDARRAY_FLOAT64);
+
+      double value = (double) num;
+      memcpy (dst_p, &value, sizeof (value));
+      break;
+    }
+  }
+} /* ecma_op_typedarray_write_number */
+
+/**
+ * Get the value of an element of a typed array
+ *
+ * @return the number stored in the element
+ */
+ecma_number_t
+ecma_op_typedarray_get_element (ecma_typedarray_t *typedarray_p, /**< view of a typed array */
+                                uint32_t index) /**< element index (less than the length) */
+{
+  JERRY_ASSERT (index < typedarray_p->length);
+
+  ecma_typedarray_type_t type = (ecma_typedarray_type_t) typedarray_p->type;
+
+  return ecma_op_typedarray_read_number (type,
+                                         typedarray_p->buffer_p + (index << ecma_typedarray_element_size_log2[type]));
+} /* ecma_op_typedarray_get_element */
+
+/**
+ * Set the value of an element of a typed array
+ */
+void
+ecma_op_typedarray_set_element (ecma_typedarray_t *typedarray_p, /**< view of a typed array */
+                                uint32_t index, /**< element index (less than the length) */
+                                ecma_number_t num) /**< new value */
+{
+  JERRY_ASSERT (index < typedarray_p->length);
+
+  ecma_typedarray_type_t type = (ecma_typedarray_type_t) typedarray_p->type;
+
+  ecma_op_typedarray_write_number (type,
+                                   typedarray_p->buffer_p + (index << ecma_typedarray_element_size_log2[type]),
+                                   num);
+} /* ecma_op_typedarray_set_element */
+
+/**
+ * ToIndex operation for the offsets and lengths of the views
+ *
+ * See also: ECMA-262 v7, 7.1.17
+ *
+ * @return empty value - if the value is converted to an index,
+ *         error - otherwise
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_to_index (ecma_value_t value, /**< value to convert */
+                             uint32_t *index_p) /**< [out] index */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, value, ret_value);
+
+  ecma_number_t integer = ecma_number_is_nan (num) ? ECMA_NUMBER_ZERO : ecma_number_trunc (num);
+
+  if (integer < ECMA_NUMBER_ZERO || integer > (ecma_number_t) UINT32_MAX)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else
+  {
+    *index_p = (uint32_t) integer;
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+
+  return ret_value;
+} /* ecma_op_typedarray_to_index */
+
+/**
+ * Create a typed array or a DataView object, which views a part of an ArrayBuffer
+ *
+ * @return pointer to the new object
+ */
+ecma_object_t *
+ecma_op_create_typedarray_view (ecma_object_t *arraybuffer_obj_p, /**< ArrayBuffer object */
+                                ecma_typedarray_type_t type, /**< view type */
+                                uint32_t byte_offset, /**< offset of the view in the ArrayBuffer */
+                                uint32_t length) /**< number of elements */
+{
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_get_arraybuffer (arraybuffer_obj_p);
+
+  JERRY_ASSERT (arraybuffer_p != NULL);
+  JERRY_ASSERT (byte_offset <= arraybuffer_p->length
+                && length <= ((arraybuffer_p->length - byte_offset) >> ecma_typedarray_element_size_log2[type]));
+
+  ecma_object_t *prototype_obj_p = ecma_builtin_get (ecma_typedarray_prototype_ids[type]);
+  ecma_object_t *obj_p = ecma_create_object (prototype_obj_p, true, ECMA_OBJECT_TYPE_GENERAL);
+  ecma_deref_object (prototype_obj_p);
+
+  ecma_property_t *class_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_CLASS);
+  ECMA_PROPERTY_VALUE_PTR (class_prop_p)->value = ecma_typedarray_class_names[type];
+
+  ecma_typedarray_t *typedarray_p = ecma_alloc_typedarray ();
+
+  /* The element property is a writable, enumerable, but not configurable named data property. */
+  typedarray_p->element_header.types[0].type_and_flags = (uint8_t) (ECMA_PROPERTY_TYPE_NAMEDDATA
+                                                                    | ECMA_PROPERTY_FLAG_WRITABLE
+                                                                    | ECMA_PROPERTY_FLAG_ENUMERABLE);
+  typedarray_p->element_header.types[1].type_and_flags = ECMA_PROPERTY_TYPE_DELETED;
+  typedarray_p->element_header.next_property_cp = ECMA_NULL_POINTER;
+  typedarray_p->element_value.value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+
+  ECMA_SET_NON_NULL_POINTER (typedarray_p->arraybuffer_cp, arraybuffer_obj_p);
+  typedarray_p->type = (uint8_t) type;
+  typedarray_p->byte_offset = byte_offset;
+  typedarray_p->length = length;
+  typedarray_p->buffer_p = arraybuffer_p->buffer_p + byte_offset;
+
+  JERRY_ASSERT (ECMA_PROPERTY_VALUE_PTR (typedarray_p->element_header.types + 0) == &typedarray_p->element_value);
+
+  ecma_property_t *typedarray_prop_p = ecma_create_internal_property (obj_p, ECMA_INTERNAL_PROPERTY_TYPEDARRAY);
+  ECMA_SET_NON_NULL_POINTER (ECMA_PROPERTY_VALUE_PTR (typedarray_prop_p)->value, typedarray_p);
+
+  return obj_p;
+} /* ecma_op_create_typedarray_view */
+
+/**
+ * Create a typed array with a new ArrayBuffer
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_create_typedarray_with_length (ecma_typedarray_type_t type, /**< element type */
+                                       uint32_t length) /**< number of elements */
+{
+  uint32_t element_size_log2 = ecma_typedarray_element_size_log2[type];
+
+  if (length > (ECMA_ARRAYBUFFER_MAX_LENGTH >> element_size_log2))
+  {
+    return ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_TRY_CATCH (arraybuffer_value,
+                  ecma_op_create_arraybuffer_object (length << element_size_log2),
+                  ret_value);
+
+  ecma_object_t *obj_p = ecma_op_create_typedarray_view (ecma_get_object_from_value (arraybuffer_value),
+                                                         type,
+                                                         0,
+                                                         length);
+  ret_value = ecma_make_object_value (obj_p);
+
+  ECMA_FINALIZE (arraybuffer_value);
+
+  return ret_value;
+} /* ecma_op_create_typedarray_with_length */
+
+/**
+ * Create a typed array, which views a part of an ArrayBuffer
+ *
+ * See also: ECMA-262 v6, 22.2.1.4
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_create_typedarray_from_arraybuffer (ecma_object_t *arraybuffer_obj_p, /**< ArrayBuffer object */
+                                            ecma_value_t byte_offset_value, /**< byteOffset argument */
+                                            ecma_value_t length_value, /**< length argument */
+                                            ecma_typedarray_type_t type) /**< element type */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_get_arraybuffer (arraybuffer_obj_p);
+  uint32_t element_size_log2 = ecma_typedarray_element_size_log2[type];
+  uint32_t element_size_mask = (1u << element_size_log2) - 1;
+  uint32_t byte_offset = 0;
+
+  ECMA_TRY_CATCH (byte_offset_completion,
+                  ecma_op_typedarray_to_index (byte_offset_value, &byte_offset),
+                  ret_value);
+
+  if ((byte_offset & element_size_mask) != 0
+      || byte_offset > arraybuffer_p->length)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else if (ecma_is_value_undefined (length_value))
+  {
+    if ((arraybuffer_p->length & element_size_mask) != 0)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+    }
+    else
+    {
+      uint32_t length = (arraybuffer_p->length - byte_offset) >> element_size_log2;
+
+      ret_value = ecma_make_object_value (ecma_op_create_typedarray_view (arraybuffer_obj_p,
+                                                                          type,
+                                                                          byte_offset,
+                                                                          length));
+    }
+  }
+  else
+  {
+    uint32_t length = 0;
+
+    ECMA_TRY_CATCH (length_completion,
+                    ecma_op_typedarray_to_index (length_value, &length),
+                    ret_value);
+
+    if (length > ((arraybuffer_p->length - byte_offset) >> element_size_log2))
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+    }
+    else
+    {
+      ret_value = ecma_make_object_value (ecma_op_create_typedarray_view (arraybuffer_obj_p,
+                                                                          type,
+                                                                          byte_offset,
+                                                                          length));
+    }
+
+    ECMA_FINALIZE (length_completion);
+  }
+
+  ECMA_FINALIZE (byte_offset_completion);
+
+  return ret_value;
+} /* ecma_op_create_typedarray_from_arraybuffer */
+
+/**
+ * Create a typed array from the elements of an array-like object
+ *
+ * See also: ECMA-262 v6, 22.2.1.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+static ecma_value_t
+ecma_op_create_typedarray_from_array_like (ecma_object_t *source_obj_p, /**< array-like object */
+                                           ecma_typedarray_type_t type) /**< element type */
+{
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_typedarray_t *source_typedarray_p = ecma_op_get_typedarray (source_obj_p);
+
+  if (source_typedarray_p != NULL)
+  {
+    /* The elements of typed arrays are numbers, so they are converted without calling [[Get]]. */
+    ECMA_TRY_CATCH (typedarray_value,
+                    ecma_op_create_typedarray_with_length (type, source_typedarray_p->length),
+                    ret_value);
+
+    ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (ecma_get_object_from_value (typedarray_value));
+
+    for (uint32_t index = 0; index < source_typedarray_p->length; index++)
+    {
+      ecma_op_typedarray_set_element (typedarray_p,
+                                      index,
+                                      ecma_op_typedarray_get_element (source_typedarray_p, index));
+    }
+
+    ret_value = ecma_copy_value (typedarray_value);
+
+    ECMA_FINALIZE (typedarray_value);
+
+    return ret_value;
+  }
+
+  ecma_string_t *length_str_p = ecma_get_magic_string (LIT_MAGIC_STRING_LENGTH);
+
+  ECMA_TRY_CATCH (length_value,
+                  ecma_op_object_get (source_obj_p, length_str_p),
+                  ret_value);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (length_num, length_value, ret_value);
+
+  /* ToLength: negative lengths are clamped to zero. */
+  uint32_t length = 0;
+
+  if (!ecma_number_is_nan (length_num) && length_num > ECMA_NUMBER_ZERO)
+  {
+    ecma_number_t integer = ecma_number_trunc (length_num);
+
+    if (integer > (ecma_number_t) UINT32_MAX)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+    }
+    else
+    {
+      length = (uint32_t) integer;
+    }
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ECMA_TRY_CATCH (typedarray_value,
+                    ecma_op_create_typedarray_with_length (type, length),
+                    ret_value);
+
+    ecma_typedarray_t *typedarray_p = ecma_op_get_typedarray (ecma_get_object_from_value (typedarray_value));
+
+    for (uint32_t index = 0; index < length && ecma_is_value_empty (ret_value); index++)
+    {
+      ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (index);
+
+      ECMA_TRY_CATCH (element_value,
+                      ecma_op_object_get (source_obj_p, index_str_p),
+                      ret_value);
+
+      ECMA_OP_TO_NUMBER_TRY_CATCH (element_num, element_value, ret_value);
+
+      ecma_op_typedarray_set_element (typedarray_p, index, element_num);
+
+      ECMA_OP_TO_NUMBER_FINALIZE (element_num);
+      ECMA_FINALIZE (element_value);
+
+      ecma_deref_ecma_string (index_str_p);
+    }
+
+    if (ecma_is_value_empty (ret_value))
+    {
+      ret_value = ecma_copy_value (typedarray_value);
+    }
+
+    ECMA_FINALIZE (typedarray_value);
+  }
+
+  ECMA_OP_TO_NUMBER_FINALIZE (length_num);
+  ECMA_FINALIZE (length_value);
+
+  ecma_deref_ecma_string (length_str_p);
+
+  return ret_value;
+} /* ecma_op_create_typedarray_from_array_like */
+
+/**
+ * Typed array object creation operation.
+ *
+ * See also: ECMA-262 v6, 22.2.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_typedarray_object (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                  ecma_length_t arguments_list_len, /**< length of the arguments list */
+                                  ecma_typedarray_type_t type) /**< element type */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+  JERRY_ASSERT (type < ECMA_TYPEDARRAY_DATAVIEW);
+
+  ecma_value_t undefined_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  ecma_value_t first_arg = (arguments_list_len > 0) ? arguments_list_p[0] : undefined_value;
+
+  if (!ecma_is_value_object (first_arg))
+  {
+    ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+    uint32_t length = 0;
+
+    ECMA_TRY_CATCH (length_completion,
+                    ecma_op_typedarray_to_index (first_arg, &length),
+                    ret_value);
+
+    ret_value = ecma_op_create_typedarray_with_length (type, length);
+
+    ECMA_FINALIZE (length_completion);
+
+    return ret_value;
+  }
+
+  ecma_object_t *source_obj_p = ecma_get_object_from_value (first_arg);
+
+  if (ecma_op_get_arraybuffer (source_obj_p) != NULL)
+  {
+    return ecma_op_create_typedarray_from_arraybuffer (source_obj_p,
+                                                       (arguments_list_len > 1) ? arguments_list_p[1]
+                                                                                : undefined_value,
+                                                       (arguments_list_len > 2) ? arguments_list_p[2]
+                                                                                : undefined_value,
+                                                       type);
+  }
+
+  return ecma_op_create_typedarray_from_array_like (source_obj_p, type);
+} /* ecma_op_create_typedarray_object */
+
+/**
+ * DataView object creation operation.
+ *
+ * See also: ECMA-262 v6, 24.2.2.1
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_create_dataview_object (const ecma_value_t *arguments_list_p, /**< arguments list */
+                                ecma_length_t arguments_list_len) /**< length of the arguments list */
+{
+  JERRY_ASSERT (arguments_list_len == 0 || arguments_list_p != NULL);
+
+  if (arguments_list_len == 0
+      || !ecma_is_value_object (arguments_list_p[0])
+      || ecma_op_get_arraybuffer (ecma_get_object_from_value (arguments_list_p[0])) == NULL)
+  {
+    return ecma_raise_type_error (ECMA_ERR_MSG (""));
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  ecma_value_t undefined_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
+  ecma_value_t byte_offset_value = (arguments_list_len > 1) ? arguments_list_p[1] : undefined_value;
+  ecma_value_t byte_length_value = (arguments_list_len > 2) ? arguments_list_p[2] : undefined_value;
+
+  ecma_object_t *arraybuffer_obj_p = ecma_get_object_from_value (arguments_list_p[0]);
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_get_arraybuffer (arraybuffer_obj_p);
+  uint32_t byte_offset = 0;
+  uint32_t byte_length = 0;
+
+  ECMA_TRY_CATCH (byte_offset_completion,
+                  ecma_op_typedarray_to_index (byte_offset_value, &byte_offset),
+                  ret_value);
+
+  if (byte_offset > arraybuffer_p->length)
+  {
+    ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+  }
+  else if (ecma_is_value_undefined (byte_length_value))
+  {
+    byte_length = arraybuffer_p->length - byte_offset;
+  }
+  else
+  {
+    ECMA_TRY_CATCH (byte_length_completion,
+                    ecma_op_typedarray_to_index (byte_length_value, &byte_length),
+                    ret_value);
+
+    if (byte_length > arraybuffer_p->length - byte_offset)
+    {
+      ret_value = ecma_raise_range_error (ECMA_ERR_MSG (""));
+    }
+
+    ECMA_FINALIZE (byte_length_completion);
+  }
+
+  if (ecma_is_value_empty (ret_value))
+  {
+    ret_value = ecma_make_object_value (ecma_op_create_typedarray_view (arraybuffer_obj_p,
+                                                                        ECMA_TYPEDARRAY_DATAVIEW,
+                                                                        byte_offset,
+                                                                        byte_length));
+  }
+
+  ECMA_FINALIZE (byte_offset_completion);
+
+  return ret_value;
+} /* ecma_op_create_dataview_object */
+
+/**
+ * [[GetOwnProperty]] operation of typed arrays for element names
+ *
+ * See also: ECMA-262 v6, 9.4.5.1
+ *
+ * Note:
+ *      the returned property is the element property of the view, which is valid
+ *      until the next request for an element of the same typed array
+ *
+ * @return pointer to the element property - if the index is less than the length,
+ *         NULL - otherwise
+ */
+ecma_property_t *
+ecma_op_typedarray_get_element_property (ecma_typedarray_t *typedarray_p, /**< view of a typed array */
+                                         uint32_t index) /**< element index */
+{
+  if (index >= typedarray_p->length)
+  {
+    return NULL;
+  }
+
+  ecma_number_t *num_p = ecma_alloc_number ();
+  *num_p = ecma_op_typedarray_get_element (typedarray_p, index);
+
+  ecma_free_value (typedarray_p->element_value.value);
+  typedarray_p->element_value.value = ecma_make_number_value (num_p);
+
+  return typedarray_p->element_header.types + 0;
+} /* ecma_op_typedarray_get_element_property */
+
+/**
+ * [[DefineOwnProperty]] operation of typed arrays for element names
+ *
+ * See also: ECMA-262 v6, 9.4.5.3
+ *
+ * @return ecma value
+ *         Returned value must be freed with ecma_free_value
+ */
+ecma_value_t
+ecma_op_typedarray_define_element (ecma_typedarray_t *typedarray_p, /**< view of a typed array */
+                                   uint32_t index, /**< element index */
+                                   const ecma_property_descriptor_t *property_desc_p, /**< property
+                                                                                       *   descriptor */
+                                   bool is_throw) /**< flag that controls failure handling */
+{
+  /* The elements are writable, enumerable, but not configurable data properties. */
+  if (index >= typedarray_p->length
+      || property_desc_p->is_get_defined
+      || property_desc_p->is_set_defined
+      || (property_desc_p->is_configurable_defined && property_desc_p->is_configurable)
+      || (property_desc_p->is_enumerable_defined && !property_desc_p->is_enumerable)
+      || (property_desc_p->is_writable_defined && !property_desc_p->is_writable))
+  {
+    return ecma_reject (is_throw);
+  }
+
+  if (!property_desc_p->is_value_defined)
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
+  ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+
+  ECMA_OP_TO_NUMBER_TRY_CATCH (num, property_desc_p->value, ret_value);
+
+  ecma_op_typedarray_set_element (typedarray_p, index, num);
+  ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+
+  ECMA_OP_TO_NUMBER_FINALIZE (num);
+
+  return ret_value;
+} /* ecma_op_typedarray_define_element */
+
+/**
+ * List names of the elements of a typed array
+ *
+ * Note:
+ *      the names are listed in descending order of the indices, like the names of array elements,
+ *      which are stored in the property list
+ */
+void
+ecma_op_typedarray_list_lazy_property_names (ecma_typedarray_t *typedarray_p, /**< view of a typed array */
+                                             ecma_collection_header_t *main_collection_p) /**< 'main'
+                                                                                           *   collection */
+{
+  /* the elements are enumerable */
+  for (uint32_t index = typedarray_p->length; index > 0; index--)
+  {
+    ecma_string_t *name_p = ecma_new_ecma_string_from_uint32 (index - 1);
+
+    ecma_append_to_values_collection (main_collection_p, ecma_make_string_value (name_p), true);
+
+    ecma_deref_ecma_string (name_p);
+  }
+} /* ecma_op_typedarray_list_lazy_property_names */
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
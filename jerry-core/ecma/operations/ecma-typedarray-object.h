@@ -0,0 +1,75 @@
+/* Copyright 2016 University of Szeged.
+ *
+ * Licensed under the Apache License, Version 2.0 (the "License");
+ * you may not use this file except in compliance with the License.
+ * You may obtain a copy of the License at
+ *
+ *     http://www.apache.org/licenses/LICENSE-2.0
+ *
+ * Unless required by applicable law or agreed to in writing, software
+ * distributed under the License is distributed on an "AS IS" BASIS
+ * WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+ * See the License for the specific language governing permissions and
+ * limitations under the License.
+ */
+
+#ifndef ECMA_TYPEDARRAY_OBJECT_H
+#define ECMA_TYPEDARRAY_OBJECT_H
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+
+#include "ecma-globals.h"
+
+/** \addtogroup ecma ECMA
+ * @{
+ *
+ * \addtogroup ecmatypedarrayobject ECMA ArrayBuffer, typed array and DataView object related routines
+ * @{
+ */
+
+extern ecma_value_t
+ecma_op_create_arraybuffer_object (uint32_t);
+extern ecma_object_t *
+ecma_op_create_external_arraybuffer_object (uint8_t *, uint32_t, ecma_external_pointer_t);
+extern ecma_arraybuffer_t *
+ecma_op_get_arraybuffer (ecma_object_t *);
+
+extern ecma_typedarray_t *
+ecma_op_get_typedarray (ecma_object_t *);
+extern ecma_typedarray_t *
+ecma_op_get_dataview (ecma_object_t *);
+extern uint32_t
+ecma_op_typedarray_get_element_size (ecma_typedarray_type_t);
+extern ecma_number_t
+ecma_op_typedarray_read_number (ecma_typedarray_type_t, const uint8_t *);
+extern void
+ecma_op_typedarray_write_number (ecma_typedarray_type_t, uint8_t *, ecma_number_t);
+extern ecma_number_t
+ecma_op_typedarray_get_element (ecma_typedarray_t *, uint32_t);
+extern void
+ecma_op_typedarray_set_element (ecma_typedarray_t *, uint32_t, ecma_number_t);
+extern ecma_value_t
+ecma_op_typedarray_to_index (ecma_value_t, uint32_t *);
+
+extern ecma_object_t *
+ecma_op_create_typedarray_view (ecma_object_t *, ecma_typedarray_type_t, uint32_t, uint32_t);
+extern ecma_value_t
+ecma_op_create_typedarray_object (const ecma_value_t *, ecma_length_t, ecma_typedarray_type_t);
+extern ecma_value_t
+ecma_op_create_dataview_object (const ecma_value_t *, ecma_length_t);
+
+extern ecma_property_t *
+ecma_op_typedarray_get_element_property (ecma_typedarray_t *, uint32_t);
+extern ecma_value_t
+ecma_op_typedarray_define_element (ecma_typedarray_t *, uint32_t, const ecma_property_descriptor_t *, bool);
+extern void
+ecma_op_typedarray_list_lazy_property_names (ecma_typedarray_t *, ecma_collection_header_t *);
+
+/**
+ * @}
+ * @}
+ */
+
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+#endif /* !ECMA_TYPEDARRAY_OBJECT_H */
@@ -144,6 +144,91 @@ typedef void (*jerry_object_free_callback_t) (const uintptr_t native_p);
 typedef bool (*jerry_object_field_foreach_t) (const jerry_api_string_t *field_name_p,
                                               const jerry_api_value_t *field_value_p,
                                               void *user_data_p);
+
+/**
+ * Policy of starting garbage collection upon growth of the heap
+ *
+ * Garbage collection is started, when both thresholds are achieved.
+ */
+typedef struct
+{
+  size_t min_allocated_bytes; /**< minimum growth of the heap since last garbage collection (in bytes) */
+  uint32_t heap_growth_percent; /**< growth of the heap since last garbage collection
+                                 *   (in percents of the heap usage after the collection) */
+} jerry_api_gc_policy_t;
+
+/**
+ * Kind of a garbage collection pause
+ */
+typedef enum
+{
+  JERRY_API_GC_PAUSE_MINOR, /**< collection of objects, which have not survived a garbage collection yet */
+  JERRY_API_GC_PAUSE_FULL, /**< complete garbage collection session */
+  JERRY_API_GC_PAUSE_STEP /**< step of incremental garbage collection session */
+} jerry_api_gc_pause_kind_t;
+
+/**
+ * Record of a garbage collection pause
+ */
+typedef struct
+{
+  jerry_api_gc_pause_kind_t kind; /**< kind of the pause */
+  bool is_finished; /**< false - the pause is starting (the counters are zero),
+                     *   true - the pause is finished */
+  size_t marked_objects; /**< number of objects, which were traversed by marking */
+  size_t swept_objects; /**< number of freed objects */
+  size_t freed_bytes; /**< decrease of the heap usage (in bytes) */
+  size_t lcache_invalidations; /**< number of invalidated property lookup cache entries */
+  size_t regexp_cache_entries_freed; /**< number of freed RegExp bytecode cache entries */
+} jerry_api_gc_event_t;
+
+/**
+ * Garbage collection event callback
+ *
+ * Note:
+ *      the callback is invoked upon both start and finish of each garbage collection pause,
+ *      so duration of the pause can be measured with a clock of the embedder
+ */
+typedef void (*jerry_gc_callback_t) (const jerry_api_gc_event_t *event_p);
+
+/**
+ * Statistics of the heap and the garbage collector
+ */
+typedef struct
+{
+  size_t heap_size; /**< size of the heap (in bytes) */
+  size_t allocated_bytes; /**< current heap usage (in bytes) */
+  size_t peak_allocated_bytes; /**< peak heap usage since initialization of the engine (in bytes) */
+  size_t objects; /**< number of objects (including lexical environments) */
+  size_t young_objects; /**< number of objects, which have not survived a garbage collection yet */
+  size_t full_gc_sessions; /**< number of completed full garbage collection sessions */
+  size_t minor_gcs; /**< number of minor garbage collections */
+  size_t marked_objects; /**< total number of objects, which were traversed by marking */
+  size_t swept_objects; /**< total number of freed objects */
+  size_t freed_bytes; /**< total number of bytes, freed by the garbage collector */
+  size_t lcache_invalidations; /**< total number of property lookup cache entries, invalidated during GC */
+  size_t regexp_cache_entries_freed; /**< total number of freed RegExp bytecode cache entries */
+} jerry_api_heap_stats_t;
+
+/**
+ * Statistics of the property access caches
+ */
+typedef struct
+{
+  size_t inline_cache_get_hits; /**< number of property reads, which were served by an inline cache */
+  size_t inline_cache_get_misses; /**< number of cacheable property reads, which required a property lookup */
+  size_t inline_cache_put_hits; /**< number of property writes, which were served by an inline cache */
+  size_t inline_cache_put_misses; /**< number of cacheable property writes, which required a property lookup */
+  size_t lcache_hits; /**< number of property lookups, which were served by the property lookup cache */
+  size_t lcache_misses; /**< number of property lookups, which were not found in the property lookup cache */
+  size_t lcache_evictions; /**< number of property lookup cache entries, which were replaced by newer ones */
+  size_t lcache_invalidations; /**< number of property lookup cache entries, which were invalidated */
+  size_t prototype_chain_cache_hits; /**< number of prototype chain lookups, which were served
+                                      *   by the prototype chain cache */
+  size_t prototype_chain_cache_misses; /**< number of cacheable prototype chain lookups, which required
+                                        *   walking the prototype chain */
+} jerry_api_property_cache_stats_t;
+
 /**
  * Returns whether the given jerry_api_value_t is void.
  */
@@ -280,6 +365,9 @@ void jerry_api_release_value (jerry_api_value_t *);
 
 jerry_api_object_t *jerry_api_create_array_object (jerry_api_size_t);
 jerry_api_object_t *jerry_api_create_object (void);
+jerry_api_object_t *jerry_api_create_arraybuffer (jerry_api_size_t);
+jerry_api_object_t *jerry_api_create_external_arraybuffer (jerry_api_size_t, uint8_t *, jerry_object_free_callback_t);
+uint8_t *jerry_api_get_arraybuffer_pointer (jerry_api_object_t *, jerry_api_size_t *);
 jerry_api_string_t *jerry_api_create_string (const jerry_api_char_t *);
 jerry_api_string_t *jerry_api_create_string_sz (const jerry_api_char_t *, jerry_api_size_t);
 
@@ -315,6 +403,12 @@ jerry_completion_code_t jerry_api_eval (const jerry_api_char_t *, size_t, bool,
 jerry_api_object_t *jerry_api_get_global (void);
 
 void jerry_api_gc (void);
+bool jerry_api_gc_step (size_t);
+void jerry_api_get_gc_policy (jerry_api_gc_policy_t *);
+void jerry_api_set_gc_policy (const jerry_api_gc_policy_t *);
+void jerry_api_set_gc_callback (jerry_gc_callback_t);
+void jerry_api_get_heap_stats (jerry_api_heap_stats_t *);
+void jerry_api_get_property_cache_stats (jerry_api_property_cache_stats_t *);
 void jerry_register_external_magic_strings (const jerry_api_char_ptr_t *, uint32_t, const jerry_api_length_t *);
 
 size_t jerry_parse_and_save_snapshot (const jerry_api_char_t *, size_t, bool, uint8_t *, size_t);
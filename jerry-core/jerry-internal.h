@@ -20,6 +20,7 @@
 #ifndef JERRY_INTERNAL_H
 #define JERRY_INTERNAL_H
 
+#include "ecma-gc.h"
 #include "ecma-globals.h"
 #include "jerry-api.h"
 
@@ -29,4 +30,7 @@ jerry_dispatch_external_function (ecma_object_t *, ecma_external_pointer_t, ecma
 extern void
 jerry_dispatch_object_free_callback (ecma_external_pointer_t, ecma_external_pointer_t);
 
+extern void
+jerry_dispatch_gc_callback (ecma_gc_pause_kind_t, bool, const ecma_gc_counters_t *);
+
 #endif /* !JERRY_INTERNAL_H */
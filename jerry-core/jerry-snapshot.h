@@ -36,7 +36,14 @@ typedef struct
 
 /**
  * Jerry snapshot format version
+ *
+ * Literal tables of byte code have 32-bit entries in the large heap profile,
+ * so its snapshots are not compatible with the default profile.
  */
-#define JERRY_SNAPSHOT_VERSION (4u)
+#ifdef CONFIG_MEM_LARGE_HEAP
+#define JERRY_SNAPSHOT_VERSION (0x10008u)
+#else /* !CONFIG_MEM_LARGE_HEAP */
+#define JERRY_SNAPSHOT_VERSION (8u)
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 #endif /* !JERRY_SNAPSHOT_H */
@@ -25,9 +25,12 @@
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
 #include "ecma-init-finalize.h"
+#include "ecma-inline-cache.h"
+#include "ecma-lcache.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
 #include "ecma-try-catch-macro.h"
+#include "ecma-typedarray-object.h"
 #include "jerry-snapshot.h"
 #include "lit-literal.h"
 #include "lit-magic-strings.h"
@@ -58,6 +61,11 @@ const char * const jerry_branch_name = JERRY_BRANCH_NAME;
  */
 static jerry_flag_t jerry_flags;
 
+/**
+ * Garbage collection event callback
+ */
+static jerry_gc_callback_t jerry_gc_callback = NULL;
+
 /**
  * Jerry API availability flag
  */
@@ -397,14 +405,14 @@ jerry_api_convert_ecma_value_to_api_value (jerry_api_value_t *out_value_p, /**<
   }
   else if (ecma_is_value_number (value))
   {
-    ecma_number_t *num = ecma_get_number_from_value (value);
+    ecma_number_t num = ecma_get_number_from_value (value);
 
 #if CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT32;
-    out_value_p->u.v_float32 = *num;
+    out_value_p->u.v_float32 = num;
 #elif CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT64
     out_value_p->type = JERRY_API_DATA_TYPE_FLOAT64;
-    out_value_p->u.v_float64 = *num;
+    out_value_p->u.v_float64 = num;
 #endif /* CONFIG_ECMA_NUMBER_TYPE == CONFIG_ECMA_NUMBER_FLOAT32 */
   }
   else if (ecma_is_value_string (value))
@@ -747,6 +755,102 @@ jerry_api_create_array_object (jerry_api_size_t size) /* size of array */
   return obj_p;
 } /* jerry_api_create_array_object */
 
+/**
+ * Create an ArrayBuffer object with zero initialized data block
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object - if the size of the data block is acceptable,
+ *         NULL - otherwise (or if the ArrayBuffer built-in is disabled)
+ */
+jerry_api_object_t *
+jerry_api_create_arraybuffer (jerry_api_size_t size) /**< size of the data block in bytes */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  ecma_value_t arraybuffer_completion = ecma_op_create_arraybuffer_object (size);
+
+  if (ecma_is_value_error (arraybuffer_completion))
+  {
+    ecma_free_value (arraybuffer_completion);
+    return NULL;
+  }
+
+  return ecma_get_object_from_value (arraybuffer_completion);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  (void) size;
+
+  return NULL;
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+} /* jerry_api_create_arraybuffer */
+
+/**
+ * Create an ArrayBuffer object, which uses the specified memory block as its data block
+ *
+ * Note:
+ *      the memory block must be valid until the free callback is called.
+ *      If free callback is specified, it is called with the pointer to the memory block
+ *      upon the ArrayBuffer object is freed (by GC).
+ *
+ * Note:
+ *      caller should release the object with jerry_api_release_object, just when the value becomes unnecessary.
+ *
+ * @return pointer to created ArrayBuffer object - if the ArrayBuffer built-in is enabled,
+ *         NULL - otherwise
+ */
+jerry_api_object_t *
+jerry_api_create_external_arraybuffer (jerry_api_size_t size, /**< size of the memory block in bytes */
+                                       uint8_t *buffer_p, /**< memory block */
+                                       jerry_object_free_callback_t freecb_p) /**< free callback or NULL */
+{
+  jerry_assert_api_available ();
+  JERRY_ASSERT (size == 0 || buffer_p != NULL);
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  return ecma_op_create_external_arraybuffer_object (buffer_p, size, (ecma_external_pointer_t) freecb_p);
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  (void) size;
+  (void) buffer_p;
+  (void) freecb_p;
+
+  return NULL;
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+} /* jerry_api_create_external_arraybuffer */
+
+/**
+ * Get the data block of an ArrayBuffer object
+ *
+ * Note:
+ *      the data block of an ArrayBuffer object is never moved, so the returned pointer
+ *      remains valid while the object is alive
+ *
+ * @return pointer to the first byte of the data block - if the object is an ArrayBuffer,
+ *         NULL - otherwise
+ */
+uint8_t *
+jerry_api_get_arraybuffer_pointer (jerry_api_object_t *object_p, /**< ArrayBuffer object */
+                                   jerry_api_size_t *out_size_p) /**< out: size of the data block in bytes */
+{
+  jerry_assert_api_available ();
+
+#ifndef CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN
+  ecma_arraybuffer_t *arraybuffer_p = ecma_op_get_arraybuffer (object_p);
+
+  if (arraybuffer_p != NULL)
+  {
+    *out_size_p = arraybuffer_p->length;
+    return arraybuffer_p->buffer_p;
+  }
+#else /* CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+  (void) object_p;
+#endif /* !CONFIG_ECMA_COMPACT_PROFILE_DISABLE_TYPEDARRAY_BUILTIN */
+
+  *out_size_p = 0;
+  return NULL;
+} /* jerry_api_get_arraybuffer_pointer */
+
 /**
  * Set value of field in the specified array object
  *
@@ -1002,6 +1106,64 @@ jerry_dispatch_object_free_callback (ecma_external_pointer_t freecb_p, /**< poin
   jerry_make_api_available ();
 } /* jerry_dispatch_object_free_callback */
 
+/**
+ * Dispatch call to the GC event callback, if it is set
+ *
+ * Note:
+ *      the callback is called in the middle of garbage collection, so usage of the API is not allowed in it
+ */
+void
+jerry_dispatch_gc_callback (ecma_gc_pause_kind_t kind, /**< kind of the pause */
+                            bool is_finished, /**< is the pause finished */
+                            const ecma_gc_counters_t *counters_p) /**< counters of the pause,
+                                                                   *   or NULL - if the pause is starting */
+{
+  if (likely (jerry_gc_callback == NULL))
+  {
+    return;
+  }
+
+  jerry_api_gc_event_t event;
+  memset (&event, 0, sizeof (event));
+
+  switch (kind)
+  {
+    case ECMA_GC_PAUSE_MINOR:
+    {
+      event.kind = JERRY_API_GC_PAUSE_MINOR;
+      break;
+    }
+    case ECMA_GC_PAUSE_FULL:
+    {
+      event.kind = JERRY_API_GC_PAUSE_FULL;
+      break;
+    }
+    default:
+    {
+      JERRY_ASSERT (kind == ECMA_GC_PAUSE_STEP);
+      event.kind = JERRY_API_GC_PAUSE_STEP;
+      break;
+    }
+  }
+
+  event.is_finished = is_finished;
+
+  if (counters_p != NULL)
+  {
+    event.marked_objects = counters_p->marked_objects;
+    event.swept_objects = counters_p->swept_objects;
+    event.freed_bytes = counters_p->freed_bytes;
+    event.lcache_invalidations = counters_p->lcache_invalidations;
+    event.regexp_cache_entries_freed = counters_p->regexp_cache_entries_freed;
+  }
+
+  jerry_make_api_unavailable ();
+
+  jerry_gc_callback (&event);
+
+  jerry_make_api_available ();
+} /* jerry_dispatch_gc_callback */
+
 /**
  * Check if the specified object is a function object.
  *
@@ -1066,18 +1228,33 @@ jerry_api_add_object_field (jerry_api_object_t *object_p, /**< object to add fie
 
     if (prop_p == NULL)
     {
-      is_successful = true;
-
       ecma_value_t value_to_put;
       jerry_api_convert_api_value_to_ecma_value (&value_to_put, field_value_p);
 
-      prop_p = ecma_create_named_data_property (object_p,
-                                                field_name_str_p,
-                                                is_writable,
-                                                true,
-                                                true);
-      ecma_named_data_property_assign_value (object_p, prop_p, value_to_put);
+      /* The field is defined through the object's [[DefineOwnProperty]] operation,
+       * since e.g. the elements of arrays are not necessarily stored as named properties. */
+      ecma_property_descriptor_t prop_desc = ecma_make_empty_property_descriptor ();
+
+      prop_desc.is_value_defined = true;
+      prop_desc.value = value_to_put;
+
+      prop_desc.is_writable_defined = true;
+      prop_desc.is_writable = is_writable;
+
+      prop_desc.is_enumerable_defined = true;
+      prop_desc.is_enumerable = true;
+
+      prop_desc.is_configurable_defined = true;
+      prop_desc.is_configurable = true;
 
+      ecma_value_t completion = ecma_op_object_define_own_property (object_p,
+                                                                    field_name_str_p,
+                                                                    &prop_desc,
+                                                                    false);
+
+      is_successful = ecma_is_value_true (completion);
+
+      ecma_free_value (completion);
       ecma_free_value (value_to_put);
     }
 
@@ -1625,6 +1802,114 @@ jerry_api_gc (void)
   ecma_gc_run ();
 } /* jerry_api_gc */
 
+/**
+ * Perform a step of incremental GC
+ *
+ * A GC session is started, if no session is in progress. The session is completed in one or more steps.
+ *
+ * @return true - if the GC session was completed during the step,
+ *         false - otherwise.
+ */
+bool
+jerry_api_gc_step (size_t budget) /**< maximum number of objects to process during the step */
+{
+  jerry_assert_api_available ();
+
+  return ecma_gc_step (budget == 0 ? 1 : budget);
+} /* jerry_api_gc_step */
+
+/**
+ * Get the policy of starting GC upon growth of the heap
+ */
+void
+jerry_api_get_gc_policy (jerry_api_gc_policy_t *policy_p) /**< [out] GC policy */
+{
+  jerry_assert_api_available ();
+
+  ecma_gc_get_policy (&policy_p->min_allocated_bytes, &policy_p->heap_growth_percent);
+} /* jerry_api_get_gc_policy */
+
+/**
+ * Set the policy of starting GC upon growth of the heap
+ *
+ * Note:
+ *      the policy is reset to the default one (see also: CONFIG_ECMA_GC_MIN_ALLOCATED_BYTES and
+ *      CONFIG_ECMA_GC_HEAP_GROWTH_PERCENT) upon initialization of the engine
+ */
+void
+jerry_api_set_gc_policy (const jerry_api_gc_policy_t *policy_p) /**< GC policy */
+{
+  jerry_assert_api_available ();
+
+  ecma_gc_set_policy (policy_p->min_allocated_bytes, policy_p->heap_growth_percent);
+} /* jerry_api_set_gc_policy */
+
+/**
+ * Set callback, which is invoked upon start and finish of each GC pause
+ *
+ * Note:
+ *      NULL unregisters the callback
+ */
+void
+jerry_api_set_gc_callback (jerry_gc_callback_t callback) /**< GC event callback, or NULL */
+{
+  jerry_assert_api_available ();
+
+  jerry_gc_callback = callback;
+} /* jerry_api_set_gc_callback */
+
+/**
+ * Get statistics of the heap and the garbage collector
+ */
+void
+jerry_api_get_heap_stats (jerry_api_heap_stats_t *out_stats_p) /**< [out] heap statistics */
+{
+  jerry_assert_api_available ();
+
+  ecma_gc_stats_t gc_stats;
+  ecma_gc_get_stats (&gc_stats);
+
+  out_stats_p->heap_size = MEM_HEAP_SIZE;
+  out_stats_p->allocated_bytes = mem_heap_get_allocated_size ();
+  out_stats_p->peak_allocated_bytes = mem_heap_get_peak_allocated_size ();
+  out_stats_p->objects = gc_stats.objects;
+  out_stats_p->young_objects = gc_stats.young_objects;
+  out_stats_p->full_gc_sessions = gc_stats.full_gc_sessions;
+  out_stats_p->minor_gcs = gc_stats.minor_gcs;
+  out_stats_p->marked_objects = gc_stats.totals.marked_objects;
+  out_stats_p->swept_objects = gc_stats.totals.swept_objects;
+  out_stats_p->freed_bytes = gc_stats.totals.freed_bytes;
+  out_stats_p->lcache_invalidations = gc_stats.totals.lcache_invalidations;
+  out_stats_p->regexp_cache_entries_freed = gc_stats.totals.regexp_cache_entries_freed;
+} /* jerry_api_get_heap_stats */
+
+/**
+ * Get statistics of the property access caches
+ */
+void
+jerry_api_get_property_cache_stats (jerry_api_property_cache_stats_t *out_stats_p) /**< [out] cache statistics */
+{
+  jerry_assert_api_available ();
+
+  ecma_inline_cache_stats_t inline_cache_stats;
+  ecma_inline_cache_get_stats (&inline_cache_stats);
+
+  out_stats_p->inline_cache_get_hits = inline_cache_stats.get_hits;
+  out_stats_p->inline_cache_get_misses = inline_cache_stats.get_misses;
+  out_stats_p->inline_cache_put_hits = inline_cache_stats.put_hits;
+  out_stats_p->inline_cache_put_misses = inline_cache_stats.put_misses;
+
+  ecma_lcache_stats_t lcache_stats;
+  ecma_lcache_get_stats (&lcache_stats);
+
+  out_stats_p->lcache_hits = lcache_stats.hits;
+  out_stats_p->lcache_misses = lcache_stats.misses;
+  out_stats_p->lcache_evictions = lcache_stats.evictions;
+  out_stats_p->lcache_invalidations = lcache_stats.invalidations;
+  out_stats_p->prototype_chain_cache_hits = lcache_stats.chain_hits;
+  out_stats_p->prototype_chain_cache_misses = lcache_stats.chain_misses;
+} /* jerry_api_get_property_cache_stats */
+
 /**
  * Jerry engine initialization
  */
@@ -1653,6 +1938,7 @@ jerry_init (jerry_flag_t flags) /**< combination of Jerry flags */
   }
 
   jerry_flags = flags;
+  jerry_gc_callback = NULL;
 
   jerry_make_api_available ();
 
@@ -1906,14 +2192,14 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
   uint8_t *src_buffer_p = (uint8_t *) compiled_code_p;
   uint8_t *dst_buffer_p = (uint8_t *) copied_compiled_code_p;
   lit_cpointer_t *src_literal_start_p;
-  uint16_t *dst_literal_start_p;
+  lit_cpointer_t *dst_literal_start_p;
   uint32_t const_literal_end;
   uint32_t literal_end;
 
   if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint16_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint16_arguments_t));
 
     cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
@@ -1922,7 +2208,7 @@ snapshot_add_compiled_code (ecma_compiled_code_t *compiled_code_p) /**< compiled
   else
   {
     src_literal_start_p = (lit_cpointer_t *) (src_buffer_p + sizeof (cbc_uint8_arguments_t));
-    dst_literal_start_p = (uint16_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
+    dst_literal_start_p = (lit_cpointer_t *) (dst_buffer_p + sizeof (cbc_uint8_arguments_t));
 
     cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) src_buffer_p;
     literal_end = args_p->literal_end;
@@ -2007,7 +2293,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
               current_p++;
             }
 
-            literal_start_p[i] = (uint16_t) current_p->literal_offset;
+            literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
           }
         }
       }
@@ -2023,7 +2309,7 @@ jerry_snapshot_set_offsets (uint8_t *buffer_p, /**< buffer */
             current_p++;
           }
 
-          literal_start_p[i] = (uint16_t) current_p->literal_offset;
+          literal_start_p[i] = (lit_cpointer_t) current_p->literal_offset;
         }
       }
 
@@ -2218,7 +2504,7 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
   }
 
   if (copy_bytecode
-      || (header_size + (literal_end * sizeof (uint16_t)) + BYTECODE_NO_COPY_TRESHOLD > code_size))
+      || (header_size + (literal_end * sizeof (lit_cpointer_t)) + BYTECODE_NO_COPY_TRESHOLD > code_size))
   {
     bytecode_p = (ecma_compiled_code_t *) mem_heap_alloc_block (code_size);
 
@@ -2236,6 +2522,9 @@ snapshot_load_compiled_code (const uint8_t *snapshot_data_p, /**< snapshot data
     memcpy (bytecode_p, snapshot_data_p + offset, code_size);
 
     bytecode_p->size = (uint16_t) (total_size >> MEM_ALIGNMENT_LOG);
+    bytecode_p->status_flags |= CBC_CODE_FLAGS_READ_ONLY_BYTE_CODE;
+    /* The identifier depth table is not copied. */
+    bytecode_p->status_flags &= (uint16_t) ~CBC_CODE_FLAGS_STATIC_SCOPE;
 
     uint8_t *instructions_p = ((uint8_t *) bytecode_p);
 
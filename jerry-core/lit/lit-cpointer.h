@@ -22,15 +22,6 @@
 
 #define LIT_CPOINTER_WIDTH (MEM_CP_WIDTH + MEM_ALIGNMENT_LOG - MEM_ALIGNMENT_LOG)
 
-/**
- * Dynamic storage-specific extended compressed pointer
- *
- * Note:
- *      the pointer can represent addresses aligned by lit_DYN_STORAGE_LENGTH_UNIT,
- *      while mem_cpointer_t can only represent addresses aligned by MEM_ALIGNMENT.
- */
-typedef uint16_t lit_cpointer_t;
-
 extern lit_cpointer_t lit_cpointer_compress (lit_record_t *);
 extern lit_record_t *lit_cpointer_decompress (lit_cpointer_t);
 extern lit_cpointer_t lit_cpointer_null_cp ();
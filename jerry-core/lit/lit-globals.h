@@ -126,7 +126,7 @@ typedef uint32_t lit_code_point_t;
 /**
  * ECMA string hash
  */
-typedef uint8_t lit_string_hash_t;
+typedef uint16_t lit_string_hash_t;
 
 /**
  * ECMA string hash value length, in bits
@@ -33,10 +33,10 @@ lit_create_charset_literal (const lit_utf8_byte_t *str_p, /**< string to be plac
   lit_charset_record_t *rec_p = (lit_charset_record_t *) mem_heap_alloc_block (buf_size + LIT_CHARSET_HEADER_SIZE);
 
   rec_p->type = LIT_RECORD_TYPE_CHARSET;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
+  rec_p->next = lit_cpointer_compress (lit_storage);
   lit_storage = (lit_record_t *) rec_p;
 
-  rec_p->hash = (uint8_t) lit_utf8_string_calc_hash (str_p, buf_size);
+  rec_p->hash = lit_utf8_string_calc_hash (str_p, buf_size);
   rec_p->size = (uint16_t) buf_size;
   rec_p->length = (uint16_t) lit_utf8_string_length (str_p, buf_size);
   memcpy (rec_p + 1, str_p, buf_size);
@@ -54,7 +54,7 @@ lit_create_magic_literal (const lit_magic_string_id_t id) /**< id of magic strin
 {
   lit_magic_record_t *rec_p = (lit_magic_record_t *) mem_heap_alloc_block (sizeof (lit_magic_record_t));
   rec_p->type = LIT_RECORD_TYPE_MAGIC_STR;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
+  rec_p->next = lit_cpointer_compress (lit_storage);
   lit_storage = (lit_record_t *) rec_p;
 
   rec_p->magic_id = (uint32_t) id;
@@ -72,7 +72,7 @@ lit_create_magic_literal_ex (const lit_magic_string_ex_id_t id) /**< id of magic
 {
   lit_magic_record_t *rec_p = (lit_magic_record_t *) mem_heap_alloc_block (sizeof (lit_magic_record_t));
   rec_p->type = LIT_RECORD_TYPE_MAGIC_STR_EX;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
+  rec_p->next = lit_cpointer_compress (lit_storage);
   lit_storage = (lit_record_t *) rec_p;
 
   rec_p->magic_id = (uint32_t) id;
@@ -91,7 +91,7 @@ lit_create_number_literal (const ecma_number_t num) /**< numeric value */
   lit_number_record_t *rec_p = (lit_number_record_t *) mem_heap_alloc_block (sizeof (lit_number_record_t));
 
   rec_p->type = (uint8_t) LIT_RECORD_TYPE_NUMBER;
-  rec_p->next = (uint16_t) lit_cpointer_compress (lit_storage);
+  rec_p->next = lit_cpointer_compress (lit_storage);
   lit_storage = (lit_record_t *) rec_p;
 
   rec_p->number = num;
@@ -33,12 +33,21 @@ typedef enum
   LIT_RECORD_TYPE_NUMBER = 4 /**< Number record that holds a numeric value. */
 } lit_record_type_t;
 
+/**
+ * Dynamic storage-specific extended compressed pointer
+ *
+ * Note:
+ *      the pointer can represent addresses aligned by lit_DYN_STORAGE_LENGTH_UNIT,
+ *      while mem_cpointer_t can only represent addresses aligned by MEM_ALIGNMENT.
+ */
+typedef mem_cpointer_t lit_cpointer_t;
+
 /**
  * Record header
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  lit_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
 } lit_record_t;
 
@@ -56,9 +65,9 @@ typedef lit_record_t *lit_literal_t;
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  lit_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
-  uint8_t hash; /* Hash of the string */
+  lit_string_hash_t hash; /* Hash of the string */
   uint16_t size; /* Size of the string in bytes */
   uint16_t length; /* Number of character in the string */
 } lit_charset_record_t;
@@ -68,7 +77,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  lit_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   ecma_number_t number; /* Number stored in the record */
 } lit_number_record_t;
@@ -78,7 +87,7 @@ typedef struct
  */
 typedef struct
 {
-  uint16_t next; /* Compressed pointer to next record */
+  lit_cpointer_t next; /* Compressed pointer to next record */
   uint8_t type; /* Type of record */
   uint32_t magic_id; /* Magic ID stored in the record */
 } lit_magic_record_t;
@@ -228,6 +228,39 @@ LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_TEST, "test")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_NAME, "name")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_MESSAGE, "message")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_PRINT, "print")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_ARRAY_BUFFER_UL, "ArrayBuffer")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_DATA_VIEW_UL, "DataView")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_INT8_ARRAY_UL, "Int8Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_UINT8_ARRAY_UL, "Uint8Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_UINT8_CLAMPED_ARRAY_UL, "Uint8ClampedArray")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_INT16_ARRAY_UL, "Int16Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_UINT16_ARRAY_UL, "Uint16Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_INT32_ARRAY_UL, "Int32Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_UINT32_ARRAY_UL, "Uint32Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_FLOAT32_ARRAY_UL, "Float32Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_FLOAT64_ARRAY_UL, "Float64Array")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_BYTES_PER_ELEMENT_U, "BYTES_PER_ELEMENT")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_BUFFER, "buffer")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_BYTE_LENGTH_UL, "byteLength")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_BYTE_OFFSET_UL, "byteOffset")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_IS_VIEW_UL, "isView")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SUBARRAY, "subarray")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_INT8_UL, "getInt8")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_UINT8_UL, "getUint8")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_INT16_UL, "getInt16")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_UINT16_UL, "getUint16")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_INT32_UL, "getInt32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_UINT32_UL, "getUint32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_FLOAT32_UL, "getFloat32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_GET_FLOAT64_UL, "getFloat64")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_INT8_UL, "setInt8")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_UINT8_UL, "setUint8")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_INT16_UL, "setInt16")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_UINT16_UL, "setUint16")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_INT32_UL, "setInt32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_UINT32_UL, "setUint32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_FLOAT32_UL, "setFloat32")
+LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_SET_FLOAT64_UL, "setFloat64")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_G_CHAR, "g")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_I_CHAR, "i")
 LIT_MAGIC_STRING_DEF (LIT_MAGIC_STRING_M_CHAR, "m")
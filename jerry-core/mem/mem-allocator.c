@@ -27,6 +27,12 @@
 #define MEM_ALLOCATOR_INTERNAL
 #include "mem-allocator-internal.h"
 
+/**
+ * Check that compressed pointers are wide enough to address the whole heap
+ */
+JERRY_STATIC_ASSERT (sizeof (mem_cpointer_t) * JERRY_BITSINBYTE >= MEM_CP_WIDTH,
+                     size_of_mem_cpointer_t_must_be_large_enough_to_address_the_heap);
+
 /**
  * The 'try to give memory back' callback
  */
@@ -63,6 +69,20 @@ mem_finalize (bool is_show_mem_stats) /**< show heap memory stats
   mem_heap_finalize ();
 } /* mem_finalize */
 
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+/**
+ * Return the memory of entirely free heap chunks to the OS
+ *
+ * Free pool chunks are given back to the heap first, so that they don't keep heap chunks in use.
+ */
+void
+mem_release_free_memory (void)
+{
+  mem_pools_collect_empty ();
+  mem_heap_release_free_chunks ();
+} /* mem_release_free_memory */
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
 /**
  * Compress pointer
  *
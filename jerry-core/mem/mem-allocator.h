@@ -31,7 +31,11 @@
 /**
  * Compressed pointer
  */
+#ifdef CONFIG_MEM_LARGE_HEAP
+typedef uint32_t mem_cpointer_t;
+#else /* !CONFIG_MEM_LARGE_HEAP */
 typedef uint16_t mem_cpointer_t;
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
 /**
  * Representation of NULL value for compressed pointers
@@ -114,6 +118,10 @@ typedef void (*mem_try_give_memory_back_callback_t) (mem_try_give_memory_back_se
 extern void mem_init (void);
 extern void mem_finalize (bool);
 
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+extern void mem_release_free_memory (void);
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
 extern uintptr_t mem_compress_pointer (const void *);
 extern void *mem_decompress_pointer (uintptr_t);
 
@@ -33,6 +33,16 @@
  */
 #define MEM_POOL_CHUNK_SIZE ((size_t) (CONFIG_MEM_POOL_CHUNK_SIZE))
 
+/**
+ * Number of pool chunk size classes
+ */
+#define MEM_POOLS_CLASS_COUNT (CONFIG_MEM_POOLS_CLASS_COUNT)
+
+/**
+ * Size of the largest pool chunk
+ */
+#define MEM_POOLS_MAX_CHUNK_SIZE (MEM_POOL_CHUNK_SIZE << (MEM_POOLS_CLASS_COUNT - 1))
+
 /**
  * Logarithm of required alignment for allocated units/blocks
  */
@@ -28,6 +28,10 @@
 #define MEM_ALLOCATOR_INTERNAL
 #include "mem-allocator-internal.h"
 
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+#include <sys/mman.h>
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
 /** \addtogroup mem Memory allocation
  * @{
  *
@@ -154,6 +158,11 @@ JERRY_STATIC_ASSERT (sizeof (mem_heap) <= MEM_HEAP_SIZE,
  */
 size_t mem_heap_allocated_size;
 
+/**
+ * Peak of allocated size since initialization of the heap
+ */
+size_t mem_heap_peak_allocated_size;
+
 /**
  * Current limit of heap usage, that is upon being reached, causes call of "try give memory back" callbacks
  */
@@ -162,6 +171,56 @@ size_t mem_heap_limit;
 /* This is used to speed up deallocation. */
 mem_heap_free_t *mem_heap_list_skip_p;
 
+/**
+ * Last (highest) region of the free region list, or the list head, if the list is empty
+ *
+ * Large blocks are cut from the end of this region (see also: mem_heap_alloc_last_fit).
+ */
+mem_heap_free_t *mem_heap_list_last_p;
+
+/**
+ * Number of segregated free lists (quick lists) for small blocks
+ */
+#define MEM_HEAP_QUICK_LIST_COUNT (CONFIG_MEM_HEAP_QUICK_LIST_COUNT)
+
+/**
+ * Size of the largest block, that is served from the quick lists
+ */
+#define MEM_HEAP_QUICK_LIST_MAX_SIZE (MEM_HEAP_QUICK_LIST_COUNT * MEM_ALIGNMENT)
+
+/**
+ * Size of the smallest block, that is allocated from the top of the heap (see also: mem_heap_alloc_last_fit)
+ */
+#define MEM_HEAP_LARGE_BLOCK_SIZE (JERRY_ALIGNUP (CONFIG_MEM_HEAP_LARGE_BLOCK_SIZE, MEM_ALIGNMENT))
+
+/**
+ * Offsets of the first blocks of the segregated free lists of small blocks
+ *
+ * The i-th list holds free blocks of exactly (i + 1) * MEM_ALIGNMENT bytes, so allocation
+ * and freeing of such blocks doesn't require walking the address-ordered free region list.
+ *
+ * Blocks in the quick lists are not coalesced with their neighbours, until the lists
+ * are flushed back to the free region list (see also: mem_heap_flush_quick_lists).
+ */
+uint32_t mem_heap_quick_lists[MEM_HEAP_QUICK_LIST_COUNT];
+
+/**
+ * Total size of blocks in the quick lists
+ */
+size_t mem_heap_quick_lists_size;
+
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+/**
+ * Size of heap chunks, that are returned to the OS
+ */
+#define MEM_HEAP_RELEASE_CHUNK_SIZE ((uintptr_t) CONFIG_MEM_HEAP_RELEASE_CHUNK_SIZE)
+
+/**
+ * Peak of allocated size since free chunks were returned to the OS last time
+ */
+size_t mem_heap_peak_allocated_since_release;
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
 #ifdef MEM_STATS
 /**
  * Heap's memory usage statistics
@@ -175,6 +234,13 @@ static void mem_heap_stat_skip ();
 static void mem_heap_stat_nonskip ();
 static void mem_heap_stat_alloc_iter ();
 static void mem_heap_stat_free_iter ();
+static void mem_heap_stat_quick_alloc ();
+static void mem_heap_stat_quick_free ();
+static void mem_heap_stat_quick_flush ();
+static void mem_heap_stat_fragmentation_failure ();
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+static void mem_heap_stat_release (size_t num);
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
 
 #  define MEM_HEAP_STAT_INIT() mem_heap_stat_init ()
 #  define MEM_HEAP_STAT_ALLOC(v1) mem_heap_stat_alloc (v1)
@@ -183,6 +249,11 @@ static void mem_heap_stat_free_iter ();
 #  define MEM_HEAP_STAT_NONSKIP() mem_heap_stat_nonskip ()
 #  define MEM_HEAP_STAT_ALLOC_ITER() mem_heap_stat_alloc_iter ()
 #  define MEM_HEAP_STAT_FREE_ITER() mem_heap_stat_free_iter ()
+#  define MEM_HEAP_STAT_QUICK_ALLOC() mem_heap_stat_quick_alloc ()
+#  define MEM_HEAP_STAT_QUICK_FREE() mem_heap_stat_quick_free ()
+#  define MEM_HEAP_STAT_QUICK_FLUSH() mem_heap_stat_quick_flush ()
+#  define MEM_HEAP_STAT_FRAGMENTATION_FAILURE() mem_heap_stat_fragmentation_failure ()
+#  define MEM_HEAP_STAT_RELEASE(v1) mem_heap_stat_release (v1)
 #else /* !MEM_STATS */
 #  define MEM_HEAP_STAT_INIT()
 #  define MEM_HEAP_STAT_ALLOC(v1)
@@ -191,6 +262,11 @@ static void mem_heap_stat_free_iter ();
 #  define MEM_HEAP_STAT_NONSKIP()
 #  define MEM_HEAP_STAT_ALLOC_ITER()
 #  define MEM_HEAP_STAT_FREE_ITER()
+#  define MEM_HEAP_STAT_QUICK_ALLOC()
+#  define MEM_HEAP_STAT_QUICK_FREE()
+#  define MEM_HEAP_STAT_QUICK_FLUSH()
+#  define MEM_HEAP_STAT_FRAGMENTATION_FAILURE()
+#  define MEM_HEAP_STAT_RELEASE(v1)
 #endif /* MEM_STATS */
 
 /**
@@ -202,10 +278,11 @@ mem_heap_init (void)
   JERRY_STATIC_ASSERT ((uintptr_t) mem_heap.area % MEM_ALIGNMENT == 0,
                        mem_heap_area_must_be_multiple_of_MEM_ALIGNMENT);
 
-  JERRY_STATIC_ASSERT ((1u << MEM_HEAP_OFFSET_LOG) >= MEM_HEAP_SIZE,
+  JERRY_STATIC_ASSERT ((1ull << MEM_HEAP_OFFSET_LOG) >= MEM_HEAP_SIZE,
                        two_pow_mem_heap_offset_should_not_be_less_than_mem_heap_size);
 
   mem_heap_allocated_size = 0;
+  mem_heap_peak_allocated_size = 0;
   mem_heap_limit = CONFIG_MEM_HEAP_DESIRED_LIMIT;
   mem_heap.first.size = 0;
   mem_heap_free_t *const region_p = (mem_heap_free_t *) mem_heap.area;
@@ -214,6 +291,17 @@ mem_heap_init (void)
   region_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
 
   mem_heap_list_skip_p = &mem_heap.first;
+  mem_heap_list_last_p = region_p;
+
+  for (uint32_t i = 0; i < MEM_HEAP_QUICK_LIST_COUNT; i++)
+  {
+    mem_heap_quick_lists[i] = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
+  }
+  mem_heap_quick_lists_size = 0;
+
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+  mem_heap_peak_allocated_since_release = 0;
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
 
   VALGRIND_NOACCESS_SPACE (mem_heap.area, MEM_HEAP_AREA_SIZE);
 
@@ -229,9 +317,353 @@ void mem_heap_finalize (void)
   VALGRIND_NOACCESS_SPACE (&mem_heap, sizeof (mem_heap));
 } /* mem_heap_finalize */
 
+/**
+ * Allocate a block from the quick list of the specified size class.
+ *
+ * @return pointer to the allocated block - if the quick list is not empty,
+ *         NULL - otherwise.
+ */
+static inline mem_heap_free_t * __attr_always_inline___
+mem_heap_alloc_from_quick_list (const size_t required_size) /**< aligned size of the block */
+{
+  JERRY_ASSERT (required_size % MEM_ALIGNMENT == 0
+                && required_size <= MEM_HEAP_QUICK_LIST_MAX_SIZE);
+
+  const size_t list_index = required_size / MEM_ALIGNMENT - 1;
+
+  if (mem_heap_quick_lists[list_index] == MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST))
+  {
+    return NULL;
+  }
+
+  mem_heap_free_t *const data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap_quick_lists[list_index]);
+
+  VALGRIND_DEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
+  JERRY_ASSERT (data_space_p->size == required_size);
+  mem_heap_quick_lists[list_index] = data_space_p->next_offset;
+  VALGRIND_UNDEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
+
+  JERRY_ASSERT (mem_heap_quick_lists_size >= required_size);
+  mem_heap_quick_lists_size -= required_size;
+
+  MEM_HEAP_STAT_ALLOC_ITER ();
+  MEM_HEAP_STAT_QUICK_ALLOC ();
+
+  return data_space_p;
+} /* mem_heap_alloc_from_quick_list */
+
+/**
+ * Allocate a block from the first sufficiently big region of the free region list.
+ *
+ * @return pointer to the allocated block - if there is a sufficiently big region,
+ *         NULL - otherwise.
+ */
+static mem_heap_free_t *
+mem_heap_alloc_first_fit (const size_t required_size) /**< aligned size of the block */
+{
+  mem_heap_free_t *current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
+  mem_heap_free_t *prev_p = &mem_heap.first;
+
+  while (current_p != MEM_HEAP_END_OF_LIST)
+  {
+    VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
+    MEM_HEAP_STAT_ALLOC_ITER ();
+    const uint32_t next_offset = current_p->next_offset;
+
+    if (current_p->size >= required_size)
+    {
+      // Region was larger than necessary
+      if (current_p->size > required_size)
+      {
+        // Get address of remaining space
+        mem_heap_free_t *const remaining_p = (mem_heap_free_t *) ((uint8_t *) current_p + required_size);
+
+        // Update metadata
+        VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
+        remaining_p->size = current_p->size - (uint32_t) required_size;
+        remaining_p->next_offset = next_offset;
+        VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
+
+        // Update list
+        VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+        prev_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
+        VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+
+        if (current_p == mem_heap_list_last_p)
+        {
+          mem_heap_list_last_p = remaining_p;
+        }
+      }
+      // Block is an exact fit
+      else
+      {
+        // Remove the region from the list
+        VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+        prev_p->next_offset = next_offset;
+        VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+
+        if (current_p == mem_heap_list_last_p)
+        {
+          mem_heap_list_last_p = prev_p;
+        }
+      }
+
+      mem_heap_list_skip_p = prev_p;
+
+      // Found enough space
+      return current_p;
+    }
+
+    VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
+    // Next in list
+    prev_p = current_p;
+    current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+  }
+
+  return NULL;
+} /* mem_heap_alloc_first_fit */
+
+/**
+ * Allocate a block from the end of the last region of the free region list.
+ *
+ * Large blocks are placed at the top of the heap, so that short-living large blocks (e.g. string buffers)
+ * are not interleaved with long-living small blocks (e.g. objects and properties) at the bottom of the heap.
+ * Upon free, the large blocks are merged into contiguous free regions, instead of leaving holes
+ * between small live blocks, which are too small for subsequent large allocations.
+ *
+ * If the last region is not larger than the block, the block is allocated by first-fit search.
+ *
+ * @return pointer to the allocated block - if there is a sufficiently big region,
+ *         NULL - otherwise.
+ */
+static mem_heap_free_t *
+mem_heap_alloc_last_fit (const size_t required_size) /**< aligned size of the block */
+{
+  mem_heap_free_t *const last_p = mem_heap_list_last_p;
+
+  VALGRIND_DEFINED_SPACE (last_p, sizeof (mem_heap_free_t));
+  JERRY_ASSERT (last_p->next_offset == MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST));
+  MEM_HEAP_STAT_ALLOC_ITER ();
+
+  if (last_p->size <= required_size)
+  {
+    VALGRIND_NOACCESS_SPACE (last_p, sizeof (mem_heap_free_t));
+
+    // Removing the region from the list would require its predecessor
+    return mem_heap_alloc_first_fit (required_size);
+  }
+
+  // The block is cut from the end of the region
+  last_p->size -= (uint32_t) required_size;
+
+  mem_heap_free_t *const data_space_p = mem_heap_get_region_end (last_p);
+  VALGRIND_NOACCESS_SPACE (last_p, sizeof (mem_heap_free_t));
+
+  return data_space_p;
+} /* mem_heap_alloc_last_fit */
+
+/**
+ * Insert a free region into the address-ordered free region list,
+ * merging it with its neighbours, if they are adjacent.
+ */
+static void
+mem_heap_insert_free_region (mem_heap_free_t *block_p, /**< the region */
+                             const size_t aligned_size) /**< aligned size of the region */
+{
+  mem_heap_free_t *prev_p;
+  mem_heap_free_t *next_p;
+
+  if (block_p > mem_heap_list_skip_p)
+  {
+    prev_p = mem_heap_list_skip_p;
+    MEM_HEAP_STAT_SKIP ();
+  }
+  else
+  {
+    prev_p = &mem_heap.first;
+    MEM_HEAP_STAT_NONSKIP ();
+  }
+
+  const uint32_t block_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+  // Find position of region in the list
+  while (prev_p->next_offset < block_offset)
+  {
+    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
+    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+    prev_p = next_p;
+    MEM_HEAP_STAT_FREE_ITER ();
+  }
+  next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
+  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+
+  VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
+  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
+  // Update prev
+  if (mem_heap_get_region_end (prev_p) == block_p)
+  {
+    // Can be merged
+    prev_p->size += (uint32_t) aligned_size;
+    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
+    block_p = prev_p;
+  }
+  else
+  {
+    block_p->size = (uint32_t) aligned_size;
+    prev_p->next_offset = block_offset;
+  }
+
+  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+  // Update next
+  if (mem_heap_get_region_end (block_p) == next_p)
+  {
+    if (unlikely (next_p == mem_heap_list_skip_p))
+    {
+      mem_heap_list_skip_p = block_p;
+    }
+
+    // Can be merged
+    block_p->size += next_p->size;
+    block_p->next_offset = next_p->next_offset;
+
+  }
+  else
+  {
+    block_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
+  }
+
+  if (block_p->next_offset == MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST))
+  {
+    mem_heap_list_last_p = block_p;
+  }
+
+  mem_heap_list_skip_p = prev_p;
+
+  VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
+  VALGRIND_NOACCESS_SPACE (block_p, aligned_size);
+  VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
+} /* mem_heap_insert_free_region */
+
+/**
+ * Sort a list of free blocks by address (merge sort)
+ *
+ * Note:
+ *      headers of the blocks should be accessible
+ *
+ * @return offset of the first block of the sorted list
+ */
+static uint32_t
+mem_heap_sort_block_list (uint32_t list_offset) /**< offset of the first block of the list */
+{
+  const uint32_t end_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
+
+  if (list_offset == end_offset
+      || MEM_HEAP_GET_ADDR_FROM_OFFSET (list_offset)->next_offset == end_offset)
+  {
+    return list_offset;
+  }
+
+  /* Split the list into two halves */
+  mem_heap_free_t *middle_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (list_offset);
+  uint32_t fast_offset = middle_p->next_offset;
+
+  while (fast_offset != end_offset
+         && MEM_HEAP_GET_ADDR_FROM_OFFSET (fast_offset)->next_offset != end_offset)
+  {
+    middle_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (middle_p->next_offset);
+    fast_offset = MEM_HEAP_GET_ADDR_FROM_OFFSET (MEM_HEAP_GET_ADDR_FROM_OFFSET (fast_offset)->next_offset)->next_offset;
+  }
+
+  uint32_t second_offset = middle_p->next_offset;
+  middle_p->next_offset = end_offset;
+
+  uint32_t first_offset = mem_heap_sort_block_list (list_offset);
+  second_offset = mem_heap_sort_block_list (second_offset);
+
+  /* Merge the sorted halves */
+  mem_heap_free_t head;
+  mem_heap_free_t *tail_p = &head;
+
+  while (first_offset != end_offset && second_offset != end_offset)
+  {
+    if (first_offset < second_offset)
+    {
+      tail_p->next_offset = first_offset;
+      tail_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (first_offset);
+      first_offset = tail_p->next_offset;
+    }
+    else
+    {
+      tail_p->next_offset = second_offset;
+      tail_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (second_offset);
+      second_offset = tail_p->next_offset;
+    }
+  }
+
+  tail_p->next_offset = (first_offset != end_offset) ? first_offset : second_offset;
+
+  return head.next_offset;
+} /* mem_heap_sort_block_list */
+
+/**
+ * Move all blocks of the quick lists back to the free region list,
+ * so that they could be merged with adjacent free regions.
+ *
+ * The blocks are inserted in address order, so that each insertion continues
+ * from the previous one (see also: mem_heap_list_skip_p), instead of walking
+ * the free region list from its beginning.
+ */
+static void
+mem_heap_flush_quick_lists (void)
+{
+  MEM_HEAP_STAT_QUICK_FLUSH ();
+
+  const uint32_t end_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST);
+  uint32_t blocks_offset = end_offset;
+
+  /* Concatenate the quick lists */
+  for (uint32_t i = 0; i < MEM_HEAP_QUICK_LIST_COUNT; i++)
+  {
+    uint32_t block_offset = mem_heap_quick_lists[i];
+
+    while (block_offset != end_offset)
+    {
+      mem_heap_free_t *const block_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (block_offset);
+
+      VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
+      block_offset = block_p->next_offset;
+      block_p->next_offset = blocks_offset;
+      blocks_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+    }
+
+    mem_heap_quick_lists[i] = end_offset;
+  }
+
+  blocks_offset = mem_heap_sort_block_list (blocks_offset);
+
+  while (blocks_offset != end_offset)
+  {
+    mem_heap_free_t *const block_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (blocks_offset);
+
+    blocks_offset = block_p->next_offset;
+    const size_t block_size = block_p->size;
+    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
+
+    mem_heap_insert_free_region (block_p, block_size);
+  }
+
+  mem_heap_quick_lists_size = 0;
+} /* mem_heap_flush_quick_lists */
+
 /**
  * Allocation of memory region.
  *
+ * Blocks of small size classes are taken from the corresponding quick list, if it is not empty.
+ * Otherwise, the first sufficiently big region of the free region list is used, or, for large blocks,
+ * the end of the last region, if it is big enough (see also: mem_heap_alloc_last_fit). If there is no such
+ * region, the quick lists are flushed to the free region list and the search is repeated.
+ *
  * See also:
  *          mem_heap_alloc_block
  *
@@ -247,18 +679,31 @@ void *mem_heap_alloc_block_internal (const size_t size)
 
   VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
 
+  if (required_size <= MEM_HEAP_QUICK_LIST_MAX_SIZE)
+  {
+    data_space_p = mem_heap_alloc_from_quick_list (required_size);
+  }
+
+  if (data_space_p != NULL)
+  {
+    // Served from a quick list
+  }
   // Fast path for 8 byte chunks, first region is guaranteed to be sufficient
-  if (required_size == MEM_ALIGNMENT
-      && likely (mem_heap.first.next_offset != MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST)))
+  else if (required_size == MEM_ALIGNMENT
+           && likely (mem_heap.first.next_offset != MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST)))
   {
     data_space_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
     VALGRIND_DEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
-    mem_heap_allocated_size += MEM_ALIGNMENT;
     MEM_HEAP_STAT_ALLOC_ITER ();
 
     if (data_space_p->size == MEM_ALIGNMENT)
     {
       mem_heap.first.next_offset = data_space_p->next_offset;
+
+      if (data_space_p == mem_heap_list_last_p)
+      {
+        mem_heap_list_last_p = &mem_heap.first;
+      }
     }
     else
     {
@@ -271,6 +716,11 @@ void *mem_heap_alloc_block_internal (const size_t size)
       VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
 
       mem_heap.first.next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
+
+      if (data_space_p == mem_heap_list_last_p)
+      {
+        mem_heap_list_last_p = remaining_p;
+      }
     }
 
     VALGRIND_UNDEFINED_SPACE (data_space_p, sizeof (mem_heap_free_t));
@@ -283,57 +733,35 @@ void *mem_heap_alloc_block_internal (const size_t size)
   // Slow path for larger regions
   else
   {
-    mem_heap_free_t *current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (mem_heap.first.next_offset);
-    mem_heap_free_t *prev_p = &mem_heap.first;
-    while (current_p != MEM_HEAP_END_OF_LIST)
-    {
-      VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
-      MEM_HEAP_STAT_ALLOC_ITER ();
-      const uint32_t next_offset = current_p->next_offset;
+    const bool is_large_block = (required_size >= MEM_HEAP_LARGE_BLOCK_SIZE);
 
-      if (current_p->size >= required_size)
-      {
-        // Region is sufficiently big, store address
-        data_space_p = current_p;
-        mem_heap_allocated_size += required_size;
+    data_space_p = (is_large_block ? mem_heap_alloc_last_fit (required_size)
+                                   : mem_heap_alloc_first_fit (required_size));
 
-        // Region was larger than necessary
-        if (current_p->size > required_size)
-        {
-          // Get address of remaining space
-          mem_heap_free_t *const remaining_p = (mem_heap_free_t *) ((uint8_t *) current_p + required_size);
-
-          // Update metadata
-          VALGRIND_DEFINED_SPACE (remaining_p, sizeof (mem_heap_free_t));
-          remaining_p->size = current_p->size - (uint32_t) required_size;
-          remaining_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (remaining_p, sizeof (mem_heap_free_t));
-
-          // Update list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (remaining_p);
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-        }
-        // Block is an exact fit
-        else
-        {
-          // Remove the region from the list
-          VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-          prev_p->next_offset = next_offset;
-          VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-        }
+    if (unlikely (data_space_p == NULL)
+        && mem_heap_quick_lists_size != 0)
+    {
+      mem_heap_flush_quick_lists ();
+      data_space_p = (is_large_block ? mem_heap_alloc_last_fit (required_size)
+                                     : mem_heap_alloc_first_fit (required_size));
+    }
+  }
 
-        mem_heap_list_skip_p = prev_p;
+  if (likely (data_space_p != NULL))
+  {
+    mem_heap_allocated_size += required_size;
 
-        // Found enough space
-        break;
-      }
+    if (mem_heap_allocated_size > mem_heap_peak_allocated_size)
+    {
+      mem_heap_peak_allocated_size = mem_heap_allocated_size;
+    }
 
-      VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
-      // Next in list
-      prev_p = current_p;
-      current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (next_offset);
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+    if (mem_heap_allocated_size > mem_heap_peak_allocated_since_release)
+    {
+      mem_heap_peak_allocated_since_release = mem_heap_allocated_size;
     }
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
   }
 
   while (mem_heap_allocated_size >= mem_heap_limit)
@@ -345,6 +773,11 @@ void *mem_heap_alloc_block_internal (const size_t size)
 
   if (unlikely (!data_space_p))
   {
+    if (mem_heap_allocated_size + required_size <= MEM_HEAP_AREA_SIZE)
+    {
+      MEM_HEAP_STAT_FRAGMENTATION_FAILURE ();
+    }
+
     return NULL;
   }
 
@@ -353,7 +786,7 @@ void *mem_heap_alloc_block_internal (const size_t size)
   MEM_HEAP_STAT_ALLOC (size);
 
   return (void *) data_space_p;
-} /* mem_heap_finalize */
+} /* mem_heap_alloc_block_internal */
 
 /**
  * Allocation of memory block, running 'try to give memory back' callbacks, if there is not enough memory.
@@ -432,6 +865,9 @@ mem_heap_alloc_block_store_size (size_t size) /**< required size */
 
 /**
  * Free the memory block.
+ *
+ * Blocks of small size classes are put to the corresponding quick list,
+ * other blocks are inserted to the free region list.
  */
 void __attribute__((hot))
 mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the block */
@@ -448,81 +884,32 @@ mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the b
   VALGRIND_NOACCESS_SPACE (ptr, size);
   MEM_HEAP_STAT_FREE_ITER ();
 
-  mem_heap_free_t *block_p = (mem_heap_free_t *) ptr;
-  mem_heap_free_t *prev_p;
-  mem_heap_free_t *next_p;
-
-  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
-
-  if (block_p > mem_heap_list_skip_p)
-  {
-    prev_p = mem_heap_list_skip_p;
-    MEM_HEAP_STAT_SKIP ();
-  }
-  else
-  {
-    prev_p = &mem_heap.first;
-    MEM_HEAP_STAT_NONSKIP ();
-  }
-
-  const uint32_t block_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Find position of region in the list
-  while (prev_p->next_offset < block_offset)
-  {
-    mem_heap_free_t *const next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-    VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-    VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-    prev_p = next_p;
-    MEM_HEAP_STAT_FREE_ITER ();
-  }
-  next_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (prev_p->next_offset);
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
+  mem_heap_free_t *const block_p = (mem_heap_free_t *) ptr;
 
   /* Realign size */
   const size_t aligned_size = (size + MEM_ALIGNMENT - 1) / MEM_ALIGNMENT * MEM_ALIGNMENT;
 
-  VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
-  VALGRIND_DEFINED_SPACE (prev_p, sizeof (mem_heap_free_t));
-  // Update prev
-  if (mem_heap_get_region_end (prev_p) == block_p)
-  {
-    // Can be merged
-    prev_p->size += (uint32_t) aligned_size;
-    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
-    block_p = prev_p;
-  }
-  else
-  {
-    block_p->size = (uint32_t) aligned_size;
-    prev_p->next_offset = block_offset;
-  }
+  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
 
-  VALGRIND_DEFINED_SPACE (next_p, sizeof (mem_heap_free_t));
-  // Update next
-  if (mem_heap_get_region_end (block_p) == next_p)
+  if (aligned_size <= MEM_HEAP_QUICK_LIST_MAX_SIZE)
   {
-    if (unlikely (next_p == mem_heap_list_skip_p))
-    {
-      mem_heap_list_skip_p = block_p;
-    }
+    const size_t list_index = aligned_size / MEM_ALIGNMENT - 1;
 
-    // Can be merged
-    block_p->size += next_p->size;
-    block_p->next_offset = next_p->next_offset;
+    VALGRIND_DEFINED_SPACE (block_p, sizeof (mem_heap_free_t));
+    block_p->size = (uint32_t) aligned_size;
+    block_p->next_offset = mem_heap_quick_lists[list_index];
+    VALGRIND_NOACCESS_SPACE (block_p, sizeof (mem_heap_free_t));
+
+    mem_heap_quick_lists[list_index] = MEM_HEAP_GET_OFFSET_FROM_ADDR (block_p);
+    mem_heap_quick_lists_size += aligned_size;
 
+    MEM_HEAP_STAT_QUICK_FREE ();
   }
   else
   {
-    block_p->next_offset = MEM_HEAP_GET_OFFSET_FROM_ADDR (next_p);
+    mem_heap_insert_free_region (block_p, aligned_size);
   }
 
-  mem_heap_list_skip_p = prev_p;
-
-  VALGRIND_NOACCESS_SPACE (prev_p, sizeof (mem_heap_free_t));
-  VALGRIND_NOACCESS_SPACE (block_p, size);
-  VALGRIND_NOACCESS_SPACE (next_p, sizeof (mem_heap_free_t));
-
   JERRY_ASSERT (mem_heap_allocated_size > 0);
   mem_heap_allocated_size -= aligned_size;
 
@@ -536,6 +923,28 @@ mem_heap_free_block (void *ptr, /**< pointer to beginning of data space of the b
   MEM_HEAP_STAT_FREE (size);
 } /* mem_heap_free_block */
 
+/**
+ * Get size of allocated regions
+ *
+ * @return number of allocated bytes
+ */
+size_t
+mem_heap_get_allocated_size (void)
+{
+  return mem_heap_allocated_size;
+} /* mem_heap_get_allocated_size */
+
+/**
+ * Get peak of allocated regions' size since initialization of the heap
+ *
+ * @return number of bytes
+ */
+size_t
+mem_heap_get_peak_allocated_size (void)
+{
+  return mem_heap_peak_allocated_size;
+} /* mem_heap_get_peak_allocated_size */
+
 /**
  * Free block with stored size
  */
@@ -547,6 +956,59 @@ mem_heap_free_block_size_stored (void *ptr) /**< pointer to the memory block */
   mem_heap_free_block (original_p, original_p->size);
 } /* mem_heap_free_block_size_stored */
 
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+/**
+ * Return heap chunks, which are entirely free, to the OS.
+ *
+ * The heap area is only backed by physical pages after it was touched, so the heap's resident size grows
+ * in pages up to CONFIG_MEM_HEAP_AREA_SIZE as it is used. The routine lets the OS reclaim the pages of
+ * free chunks. The chunks remain part of the heap area (the OS provides fresh pages upon next access),
+ * so neither the free region list nor the compressed pointers are affected.
+ *
+ * Note:
+ *      nothing is done, if less than a chunk was freed since the previous call.
+ */
+void
+mem_heap_release_free_chunks (void)
+{
+  if (mem_heap_peak_allocated_since_release < mem_heap_allocated_size + MEM_HEAP_RELEASE_CHUNK_SIZE)
+  {
+    return;
+  }
+
+  mem_heap_peak_allocated_since_release = mem_heap_allocated_size;
+
+  if (mem_heap_quick_lists_size != 0)
+  {
+    mem_heap_flush_quick_lists ();
+  }
+
+  VALGRIND_DEFINED_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+  uint32_t current_offset = mem_heap.first.next_offset;
+  VALGRIND_NOACCESS_SPACE (&mem_heap.first, sizeof (mem_heap_free_t));
+
+  while (current_offset != MEM_HEAP_GET_OFFSET_FROM_ADDR (MEM_HEAP_END_OF_LIST))
+  {
+    mem_heap_free_t *const current_p = MEM_HEAP_GET_ADDR_FROM_OFFSET (current_offset);
+
+    VALGRIND_DEFINED_SPACE (current_p, sizeof (mem_heap_free_t));
+    current_offset = current_p->next_offset;
+
+    /* The region's header must be kept */
+    const uintptr_t chunk_start = JERRY_ALIGNUP ((uintptr_t) (current_p + 1), MEM_HEAP_RELEASE_CHUNK_SIZE);
+    const uintptr_t region_end = (uintptr_t) mem_heap_get_region_end (current_p);
+    const uintptr_t chunk_end = region_end & ~(MEM_HEAP_RELEASE_CHUNK_SIZE - 1);
+    VALGRIND_NOACCESS_SPACE (current_p, sizeof (mem_heap_free_t));
+
+    if (chunk_start < chunk_end
+        && madvise ((void *) chunk_start, chunk_end - chunk_start, MADV_DONTNEED) == 0)
+    {
+      MEM_HEAP_STAT_RELEASE (chunk_end - chunk_start);
+    }
+  }
+} /* mem_heap_release_free_chunks */
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
+
 /**
  * Compress pointer
  *
@@ -565,7 +1027,7 @@ mem_heap_compress_pointer (const void *pointer_p) /**< pointer to compress */
   int_ptr -= heap_start;
   int_ptr >>= MEM_ALIGNMENT_LOG;
 
-  JERRY_ASSERT ((int_ptr & ~((1u << MEM_HEAP_OFFSET_LOG) - 1)) == 0);
+  JERRY_ASSERT ((int_ptr & ~MEM_CP_MASK) == 0);
 
   JERRY_ASSERT (int_ptr != MEM_CP_NULL);
 
@@ -637,6 +1099,10 @@ mem_heap_stats_reset_peak (void)
 void
 mem_heap_stats_print (void)
 {
+  /* Frees served by the quick lists don't walk the free region list, so it is possible that no skip-ahead
+   * was attempted at all */
+  const size_t nonskip_count = JERRY_MAX (mem_heap_stats.nonskip_count, 1);
+
   printf ("Heap stats:\n"
           "  Heap size = %zu bytes\n"
           "  Allocated = %zu bytes\n"
@@ -646,18 +1112,28 @@ mem_heap_stats_print (void)
           "  Skip-ahead ratio = %zu.%04zu\n"
           "  Average alloc iteration = %zu.%04zu\n"
           "  Average free iteration = %zu.%04zu\n"
+          "  Quick list allocations = %zu\n"
+          "  Quick list frees = %zu\n"
+          "  Quick list flushes = %zu\n"
+          "  Allocations failed due to fragmentation = %zu\n"
+          "  Released to OS = %zu bytes\n"
           "\n",
           mem_heap_stats.size,
           mem_heap_stats.allocated_bytes,
           mem_heap_stats.waste_bytes,
           mem_heap_stats.peak_allocated_bytes,
           mem_heap_stats.peak_waste_bytes,
-          mem_heap_stats.skip_count / mem_heap_stats.nonskip_count,
-          mem_heap_stats.skip_count % mem_heap_stats.nonskip_count * 10000 / mem_heap_stats.nonskip_count,
+          mem_heap_stats.skip_count / nonskip_count,
+          mem_heap_stats.skip_count % nonskip_count * 10000 / nonskip_count,
           mem_heap_stats.alloc_iter_count / mem_heap_stats.alloc_count,
           mem_heap_stats.alloc_iter_count % mem_heap_stats.alloc_count * 10000 / mem_heap_stats.alloc_count,
           mem_heap_stats.free_iter_count / mem_heap_stats.free_count,
-          mem_heap_stats.free_iter_count % mem_heap_stats.free_count * 10000 / mem_heap_stats.free_count);
+          mem_heap_stats.free_iter_count % mem_heap_stats.free_count * 10000 / mem_heap_stats.free_count,
+          mem_heap_stats.quick_alloc_count,
+          mem_heap_stats.quick_free_count,
+          mem_heap_stats.quick_flush_count,
+          mem_heap_stats.fragmentation_failure_count,
+          mem_heap_stats.released_bytes);
 } /* mem_heap_stats_print */
 
 /**
@@ -753,6 +1229,53 @@ mem_heap_stat_free_iter ()
 {
   mem_heap_stats.free_iter_count++;
 } /* mem_heap_stat_free_iter */
+
+/**
+ * Counts number of allocations served from the quick lists
+ */
+static void
+mem_heap_stat_quick_alloc ()
+{
+  mem_heap_stats.quick_alloc_count++;
+} /* mem_heap_stat_quick_alloc */
+
+/**
+ * Counts number of blocks put to the quick lists
+ */
+static void
+mem_heap_stat_quick_free ()
+{
+  mem_heap_stats.quick_free_count++;
+} /* mem_heap_stat_quick_free */
+
+/**
+ * Counts number of quick list flushes
+ */
+static void
+mem_heap_stat_quick_flush ()
+{
+  mem_heap_stats.quick_flush_count++;
+} /* mem_heap_stat_quick_flush */
+
+/**
+ * Counts number of allocations, that failed while there were enough free bytes in the heap
+ */
+static void
+mem_heap_stat_fragmentation_failure ()
+{
+  mem_heap_stats.fragmentation_failure_count++;
+} /* mem_heap_stat_fragmentation_failure */
+
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+/**
+ * Account heap chunks returned to the OS
+ */
+static void
+mem_heap_stat_release (size_t size) /**< size of the returned chunks */
+{
+  mem_heap_stats.released_bytes += size;
+} /* mem_heap_stat_release */
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
 #endif /* MEM_STATS */
 
 /**
@@ -38,6 +38,12 @@ extern void mem_heap_free_block_size_stored (void *);
 extern uintptr_t mem_heap_compress_pointer (const void *);
 extern void *mem_heap_decompress_pointer (uintptr_t);
 extern bool mem_is_heap_pointer (const void *);
+extern size_t mem_heap_get_allocated_size (void);
+extern size_t mem_heap_get_peak_allocated_size (void);
+
+#ifdef JERRY_ENABLE_HEAP_RELEASE
+extern void mem_heap_release_free_chunks (void);
+#endif /* JERRY_ENABLE_HEAP_RELEASE */
 
 #ifdef MEM_STATS
 /**
@@ -64,6 +70,15 @@ typedef struct
 
   size_t free_count;
   size_t free_iter_count;
+
+  size_t quick_alloc_count; /**< number of allocations served from the quick lists */
+  size_t quick_free_count; /**< number of blocks put to the quick lists */
+  size_t quick_flush_count; /**< number of quick list flushes */
+
+  size_t fragmentation_failure_count; /**< number of allocations, that failed because of heap fragmentation,
+                                       *   i.e. while there were enough free bytes in total */
+
+  size_t released_bytes; /**< total size of free heap chunks returned to the OS */
 } mem_heap_stats_t;
 
 extern void mem_heap_get_stats (mem_heap_stats_t *);
@@ -43,9 +43,11 @@ typedef struct mem_pools_chunk
 } mem_pools_chunk_t;
 
 /**
- * List of free pool chunks
+ * Lists of free pool chunks
+ *
+ * The i-th list holds free chunks of (MEM_POOL_CHUNK_SIZE << i) bytes.
  */
-mem_pools_chunk_t *mem_free_chunk_p;
+mem_pools_chunk_t *mem_free_chunk_p[MEM_POOLS_CLASS_COUNT];
 
 #ifdef MEM_STATS
 
@@ -55,22 +57,22 @@ mem_pools_chunk_t *mem_free_chunk_p;
 mem_pools_stats_t mem_pools_stats;
 
 static void mem_pools_stat_init (void);
-static void mem_pools_stat_free_pool (void);
-static void mem_pools_stat_new_alloc (void);
-static void mem_pools_stat_reuse (void);
-static void mem_pools_stat_dealloc (void);
+static void mem_pools_stat_free_pool (size_t);
+static void mem_pools_stat_new_alloc (size_t);
+static void mem_pools_stat_reuse (size_t);
+static void mem_pools_stat_dealloc (size_t);
 
 #  define MEM_POOLS_STAT_INIT() mem_pools_stat_init ()
-#  define MEM_POOLS_STAT_FREE_POOL() mem_pools_stat_free_pool ()
-#  define MEM_POOLS_STAT_NEW_ALLOC() mem_pools_stat_new_alloc ()
-#  define MEM_POOLS_STAT_REUSE() mem_pools_stat_reuse ()
-#  define MEM_POOLS_STAT_DEALLOC() mem_pools_stat_dealloc ()
+#  define MEM_POOLS_STAT_FREE_POOL(v1) mem_pools_stat_free_pool (v1)
+#  define MEM_POOLS_STAT_NEW_ALLOC(v1) mem_pools_stat_new_alloc (v1)
+#  define MEM_POOLS_STAT_REUSE(v1) mem_pools_stat_reuse (v1)
+#  define MEM_POOLS_STAT_DEALLOC(v1) mem_pools_stat_dealloc (v1)
 #else /* !MEM_STATS */
 #  define MEM_POOLS_STAT_INIT()
-#  define MEM_POOLS_STAT_FREE_POOL()
-#  define MEM_POOLS_STAT_NEW_ALLOC()
-#  define MEM_POOLS_STAT_REUSE()
-#  define MEM_POOLS_STAT_DEALLOC()
+#  define MEM_POOLS_STAT_FREE_POOL(v1)
+#  define MEM_POOLS_STAT_NEW_ALLOC(v1)
+#  define MEM_POOLS_STAT_REUSE(v1)
+#  define MEM_POOLS_STAT_DEALLOC(v1)
 #endif /* MEM_STATS */
 
 /*
@@ -98,6 +100,36 @@ static void mem_pools_stat_dealloc (void);
 # define VALGRIND_FREYA_FREELIKE_SPACE(p)
 #endif /* JERRY_VALGRIND_FREYA */
 
+/**
+ * Get size of chunks of the specified pool class
+ *
+ * @return chunk size
+ */
+#define MEM_POOLS_GET_CHUNK_SIZE(class_index) (MEM_POOL_CHUNK_SIZE << (class_index))
+
+/**
+ * Get the class of the smallest pool chunks, which are large enough for the specified size
+ *
+ * @return class index
+ */
+static inline size_t __attr_always_inline___
+mem_pools_get_class_index (size_t size) /**< required size */
+{
+  JERRY_ASSERT (size > 0 && size <= MEM_POOLS_MAX_CHUNK_SIZE);
+  JERRY_STATIC_ASSERT (MEM_POOL_CHUNK_SIZE == (1u << MEM_ALIGNMENT_LOG),
+                       mem_pool_chunk_size_must_be_equal_to_mem_alignment);
+
+  if (size <= MEM_POOL_CHUNK_SIZE)
+  {
+    return 0;
+  }
+
+  /* Number of significant bits of (size - 1), minus the bits of the smallest chunk size */
+  const uint32_t significant_bits = (uint32_t) (JERRY_BITSINBYTE * sizeof (unsigned int))
+                                    - (uint32_t) __builtin_clz ((unsigned int) (size - 1));
+  return significant_bits - MEM_ALIGNMENT_LOG;
+} /* mem_pools_get_class_index */
+
 /**
  * Initialize pool manager
  */
@@ -106,8 +138,13 @@ mem_pools_init (void)
 {
   JERRY_STATIC_ASSERT (sizeof (mem_pools_chunk_t) <= MEM_POOL_CHUNK_SIZE,
                        size_of_mem_pools_chunk_t_must_be_less_than_or_equal_to_MEM_POOL_CHUNK_SIZE);
+  JERRY_STATIC_ASSERT (MEM_POOLS_CLASS_COUNT >= 1,
+                       at_least_one_pool_class_must_be_configured);
 
-  mem_free_chunk_p = NULL;
+  for (size_t i = 0; i < MEM_POOLS_CLASS_COUNT; i++)
+  {
+    mem_free_chunk_p[i] = NULL;
+  }
 
   MEM_POOLS_STAT_INIT ();
 } /* mem_pools_init */
@@ -120,40 +157,51 @@ mem_pools_finalize (void)
 {
   mem_pools_collect_empty ();
 
-  JERRY_ASSERT (mem_free_chunk_p == NULL);
+#ifndef JERRY_NDEBUG
+  for (size_t i = 0; i < MEM_POOLS_CLASS_COUNT; i++)
+  {
+    JERRY_ASSERT (mem_free_chunk_p[i] == NULL);
+  }
+#endif /* !JERRY_NDEBUG */
 } /* mem_pools_finalize */
 
 /**
  * Allocate a chunk of specified size
  *
+ * The chunk is taken from the free list of the smallest sufficient pool class,
+ * or allocated on the heap, if the list is empty.
+ *
  * @return pointer to allocated chunk, if allocation was successful,
  *         or NULL - if not enough memory.
  */
 inline void * __attribute__((hot)) __attr_always_inline___
-mem_pools_alloc (void)
+mem_pools_alloc (size_t size) /**< required size, not greater than MEM_POOLS_MAX_CHUNK_SIZE */
 {
 #ifdef MEM_GC_BEFORE_EACH_ALLOC
   mem_run_try_to_give_memory_back_callbacks (MEM_TRY_GIVE_MEMORY_BACK_SEVERITY_HIGH);
 #endif /* MEM_GC_BEFORE_EACH_ALLOC */
 
-  if (mem_free_chunk_p != NULL)
+  const size_t class_index = mem_pools_get_class_index (size);
+  const size_t chunk_size = MEM_POOLS_GET_CHUNK_SIZE (class_index);
+
+  if (mem_free_chunk_p[class_index] != NULL)
   {
-    const mem_pools_chunk_t *const chunk_p = mem_free_chunk_p;
+    const mem_pools_chunk_t *const chunk_p = mem_free_chunk_p[class_index];
 
-    MEM_POOLS_STAT_REUSE ();
+    MEM_POOLS_STAT_REUSE (class_index);
 
-    VALGRIND_DEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
+    VALGRIND_DEFINED_SPACE (chunk_p, chunk_size);
 
-    mem_free_chunk_p = chunk_p->next_p;
+    mem_free_chunk_p[class_index] = chunk_p->next_p;
 
-    VALGRIND_UNDEFINED_SPACE (chunk_p, MEM_POOL_CHUNK_SIZE);
+    VALGRIND_UNDEFINED_SPACE (chunk_p, chunk_size);
 
     return (void *) chunk_p;
   }
   else
   {
-    MEM_POOLS_STAT_NEW_ALLOC ();
-    return (void *) mem_heap_alloc_block (MEM_POOL_CHUNK_SIZE);
+    MEM_POOLS_STAT_NEW_ALLOC (class_index);
+    return (void *) mem_heap_alloc_block (chunk_size);
   }
 } /* mem_pools_alloc */
 
@@ -161,35 +209,42 @@ mem_pools_alloc (void)
  * Free the chunk
  */
 void __attribute__((hot))
-mem_pools_free (void *chunk_p) /**< pointer to the chunk */
+mem_pools_free (void *chunk_p, /**< pointer to the chunk */
+                size_t size) /**< size, which was passed to mem_pools_alloc */
 {
+  const size_t class_index = mem_pools_get_class_index (size);
   mem_pools_chunk_t *const chunk_to_free_p = (mem_pools_chunk_t *) chunk_p;
 
-  VALGRIND_DEFINED_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_DEFINED_SPACE (chunk_to_free_p, MEM_POOLS_GET_CHUNK_SIZE (class_index));
 
-  chunk_to_free_p->next_p = mem_free_chunk_p;
-  mem_free_chunk_p = chunk_to_free_p;
+  chunk_to_free_p->next_p = mem_free_chunk_p[class_index];
+  mem_free_chunk_p[class_index] = chunk_to_free_p;
 
-  VALGRIND_NOACCESS_SPACE (chunk_to_free_p, MEM_POOL_CHUNK_SIZE);
+  VALGRIND_NOACCESS_SPACE (chunk_to_free_p, MEM_POOLS_GET_CHUNK_SIZE (class_index));
 
-  MEM_POOLS_STAT_FREE_POOL ();
+  MEM_POOLS_STAT_FREE_POOL (class_index);
 } /* mem_pools_free */
 
 /**
- *  Collect empty pool chunks
+ *  Collect empty pool chunks of all classes
  */
 void
 mem_pools_collect_empty ()
 {
-  while (mem_free_chunk_p)
+  for (size_t i = 0; i < MEM_POOLS_CLASS_COUNT; i++)
   {
-    VALGRIND_DEFINED_SPACE (mem_free_chunk_p, sizeof (mem_pools_chunk_t));
-    mem_pools_chunk_t *const next_p = mem_free_chunk_p->next_p;
-    VALGRIND_NOACCESS_SPACE (mem_free_chunk_p, sizeof (mem_pools_chunk_t));
-
-    mem_heap_free_block (mem_free_chunk_p, MEM_POOL_CHUNK_SIZE);
-    MEM_POOLS_STAT_DEALLOC ();
-    mem_free_chunk_p = next_p;
+    while (mem_free_chunk_p[i])
+    {
+      mem_pools_chunk_t *const chunk_p = mem_free_chunk_p[i];
+
+      VALGRIND_DEFINED_SPACE (chunk_p, sizeof (mem_pools_chunk_t));
+      mem_pools_chunk_t *const next_p = chunk_p->next_p;
+      VALGRIND_NOACCESS_SPACE (chunk_p, sizeof (mem_pools_chunk_t));
+
+      mem_heap_free_block (chunk_p, MEM_POOLS_GET_CHUNK_SIZE (i));
+      MEM_POOLS_STAT_DEALLOC (i);
+      mem_free_chunk_p[i] = next_p;
+    }
   }
 } /* mem_pools_collect_empty */
 
@@ -211,7 +266,10 @@ mem_pools_get_stats (mem_pools_stats_t *out_pools_stats_p) /**< [out] pools' sta
 void
 mem_pools_stats_reset_peak (void)
 {
-  mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+  for (size_t i = 0; i < MEM_POOLS_CLASS_COUNT; i++)
+  {
+    mem_pools_stats.classes[i].peak_pools_count = mem_pools_stats.classes[i].pools_count;
+  }
 } /* mem_pools_stats_reset_peak */
 
 /**
@@ -220,18 +278,27 @@ mem_pools_stats_reset_peak (void)
 void
 mem_pools_stats_print (void)
 {
-  printf ("Pools stats:\n"
-          "  Chunk size: %zu\n"
-          "  Pool chunks: %zu\n"
-          "  Peak pool chunks: %zu\n"
-          "  Free chunks: %zu\n"
-          "  Pool reuse ratio: %zu.%04zu\n",
-          MEM_POOL_CHUNK_SIZE,
-          mem_pools_stats.pools_count,
-          mem_pools_stats.peak_pools_count,
-          mem_pools_stats.free_chunks,
-          mem_pools_stats.reused_count / mem_pools_stats.new_alloc_count,
-          mem_pools_stats.reused_count % mem_pools_stats.new_alloc_count * 10000 / mem_pools_stats.new_alloc_count);
+  printf ("Pools stats:\n");
+
+  for (size_t i = 0; i < MEM_POOLS_CLASS_COUNT; i++)
+  {
+    const mem_pools_class_stats_t *const class_stats_p = &mem_pools_stats.classes[i];
+
+    /* Chunks of unused classes are never allocated */
+    const size_t new_alloc_count = JERRY_MAX (class_stats_p->new_alloc_count, 1);
+
+    printf ("  Chunk size: %zu\n"
+            "    Pool chunks: %zu\n"
+            "    Peak pool chunks: %zu\n"
+            "    Free chunks: %zu\n"
+            "    Pool reuse ratio: %zu.%04zu\n",
+            MEM_POOLS_GET_CHUNK_SIZE (i),
+            class_stats_p->pools_count,
+            class_stats_p->peak_pools_count,
+            class_stats_p->free_chunks,
+            class_stats_p->reused_count / new_alloc_count,
+            class_stats_p->reused_count % new_alloc_count * 10000 / new_alloc_count);
+  }
 } /* mem_pools_stats_print */
 
 /**
@@ -247,18 +314,20 @@ mem_pools_stat_init (void)
  * Account for allocation of new pool chunk
  */
 static void
-mem_pools_stat_new_alloc (void)
+mem_pools_stat_new_alloc (size_t class_index) /**< pool class */
 {
-  mem_pools_stats.pools_count++;
-  mem_pools_stats.new_alloc_count++;
+  mem_pools_class_stats_t *const class_stats_p = &mem_pools_stats.classes[class_index];
+
+  class_stats_p->pools_count++;
+  class_stats_p->new_alloc_count++;
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (class_stats_p->pools_count > class_stats_p->peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    class_stats_p->peak_pools_count = class_stats_p->pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (class_stats_p->pools_count > class_stats_p->global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    class_stats_p->global_peak_pools_count = class_stats_p->pools_count;
   }
 } /* mem_pools_stat_new_alloc */
 
@@ -267,19 +336,21 @@ mem_pools_stat_new_alloc (void)
  * Account for reuse of pool chunk
  */
 static void
-mem_pools_stat_reuse (void)
+mem_pools_stat_reuse (size_t class_index) /**< pool class */
 {
-  mem_pools_stats.pools_count++;
-  mem_pools_stats.free_chunks--;
-  mem_pools_stats.reused_count++;
+  mem_pools_class_stats_t *const class_stats_p = &mem_pools_stats.classes[class_index];
+
+  class_stats_p->pools_count++;
+  class_stats_p->free_chunks--;
+  class_stats_p->reused_count++;
 
-  if (mem_pools_stats.pools_count > mem_pools_stats.peak_pools_count)
+  if (class_stats_p->pools_count > class_stats_p->peak_pools_count)
   {
-    mem_pools_stats.peak_pools_count = mem_pools_stats.pools_count;
+    class_stats_p->peak_pools_count = class_stats_p->pools_count;
   }
-  if (mem_pools_stats.pools_count > mem_pools_stats.global_peak_pools_count)
+  if (class_stats_p->pools_count > class_stats_p->global_peak_pools_count)
   {
-    mem_pools_stats.global_peak_pools_count = mem_pools_stats.pools_count;
+    class_stats_p->global_peak_pools_count = class_stats_p->pools_count;
   }
 } /* mem_pools_stat_reuse */
 
@@ -288,21 +359,21 @@ mem_pools_stat_reuse (void)
  * Account for freeing a chunk
  */
 static void
-mem_pools_stat_free_pool (void)
+mem_pools_stat_free_pool (size_t class_index) /**< pool class */
 {
-  JERRY_ASSERT (mem_pools_stats.pools_count > 0);
+  JERRY_ASSERT (mem_pools_stats.classes[class_index].pools_count > 0);
 
-  mem_pools_stats.pools_count--;
-  mem_pools_stats.free_chunks++;
+  mem_pools_stats.classes[class_index].pools_count--;
+  mem_pools_stats.classes[class_index].free_chunks++;
 } /* mem_pools_stat_free_pool */
 
 /**
  * Account for freeing a chunk
  */
 static void
-mem_pools_stat_dealloc (void)
+mem_pools_stat_dealloc (size_t class_index) /**< pool class */
 {
-  mem_pools_stats.free_chunks--;
+  mem_pools_stats.classes[class_index].free_chunks--;
 } /* mem_pools_stat_dealloc */
 #endif /* MEM_STATS */
 
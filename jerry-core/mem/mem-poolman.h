@@ -29,15 +29,26 @@
  * @{
  */
 
+#include "mem-config.h"
+
+/**
+ * Check whether blocks of the specified size are served by one of the pools
+ * without wasting memory, i.e. whether the size, aligned to MEM_POOL_CHUNK_SIZE,
+ * is equal to the chunk size of a pool class.
+ */
+#define MEM_POOLS_IS_CHUNK_SIZE(size) \
+  ((size) <= MEM_POOLS_MAX_CHUNK_SIZE \
+   && (JERRY_ALIGNUP ((size), MEM_POOL_CHUNK_SIZE) & (JERRY_ALIGNUP ((size), MEM_POOL_CHUNK_SIZE) - 1)) == 0)
+
 extern void mem_pools_init (void);
 extern void mem_pools_finalize (void);
-extern void *mem_pools_alloc (void);
-extern void mem_pools_free (void *);
+extern void *mem_pools_alloc (size_t);
+extern void mem_pools_free (void *, size_t);
 extern void mem_pools_collect_empty (void);
 
 #ifdef MEM_STATS
 /**
- * Pools' memory usage statistics
+ * Memory usage statistics of a pool class
  */
 typedef struct
 {
@@ -58,6 +69,15 @@ typedef struct
 
   /* Number of reused pool chunks */
   size_t reused_count;
+} mem_pools_class_stats_t;
+
+/**
+ * Pools' memory usage statistics
+ */
+typedef struct
+{
+  /** statistics of the pool classes, the i-th class serves chunks of (MEM_POOL_CHUNK_SIZE << i) bytes */
+  mem_pools_class_stats_t classes[MEM_POOLS_CLASS_COUNT];
 } mem_pools_stats_t;
 
 extern void mem_pools_get_stats (mem_pools_stats_t *);
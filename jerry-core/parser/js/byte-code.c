@@ -26,6 +26,9 @@
  * @{
  */
 
+JERRY_STATIC_ASSERT (CBC_END <= CBC_MAXIMUM_BYTE_VALUE && CBC_EXT_END <= CBC_MAXIMUM_BYTE_VALUE,
+                     opcodes_must_be_encoded_in_a_single_byte);
+
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) \
   ((arg2) | (((arg3) + CBC_STACK_ADJUST_BASE) << CBC_STACK_ADJUST_SHIFT)),
 
@@ -274,6 +274,10 @@
               VM_OC_PUSH_NUMBER | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_NUMBER_1, CBC_HAS_BYTE_ARG, 1, \
               VM_OC_PUSH_NUMBER | VM_OC_PUT_STACK) \
+  CBC_OPCODE (CBC_SET_NEW_PROPERTY, CBC_HAS_LITERAL_ARG, -1, \
+              VM_OC_SET_NEW_PROPERTY | VM_OC_GET_STACK_LITERAL) \
+  CBC_OPCODE (CBC_SET_FIRST_PROPERTY, CBC_HAS_LITERAL_ARG | CBC_HAS_BYTE_ARG, -1, \
+              VM_OC_SET_NEW_PROPERTY | VM_OC_GET_STACK_LITERAL) \
   CBC_OPCODE (CBC_PUSH_PROP, CBC_NO_FLAG, -1, \
               VM_OC_PROP_GET | VM_OC_GET_STACK_STACK | VM_OC_PUT_STACK) \
   CBC_OPCODE (CBC_PUSH_PROP_LITERAL, CBC_HAS_LITERAL_ARG, 0, \
@@ -375,6 +379,19 @@
   CBC_BINARY_OPERATION (CBC_MODULO, \
                         MOD) \
   \
+  /* Binary opcodes specialized for the operand types. These are never \
+   * emitted by the parser: the vm rewrites the generic opcodes to them. */ \
+  CBC_BINARY_OPERATION (CBC_ADD_NUMBER, \
+                        ADD_NUMBER) \
+  CBC_BINARY_OPERATION (CBC_ADD_STRING, \
+                        ADD_STRING) \
+  CBC_BINARY_OPERATION (CBC_SUBTRACT_NUMBER, \
+                        SUB_NUMBER) \
+  CBC_BINARY_OPERATION (CBC_LESS_NUMBER, \
+                        LESS_NUMBER) \
+  CBC_BINARY_OPERATION (CBC_GREATER_NUMBER, \
+                        GREATER_NUMBER) \
+  \
   /* Unary lvalue opcodes. */ \
   CBC_OPCODE (CBC_DELETE, CBC_NO_FLAG, -2, \
               VM_OC_PROP_DELETE | VM_OC_GET_STACK_STACK) \
@@ -638,6 +655,9 @@ typedef struct
   uint16_t ident_end;               /**< end position of the identifier group */
   uint16_t const_literal_end;       /**< end position of the const literal group */
   uint16_t literal_end;             /**< end position of the literal group */
+#ifdef CONFIG_MEM_LARGE_HEAP
+  uint16_t padding;                 /**< keeps the 32-bit literal table aligned */
+#endif /* CONFIG_MEM_LARGE_HEAP */
 } cbc_uint16_arguments_t;
 
 /* When CBC_CODE_FLAGS_FULL_LITERAL_ENCODING
@@ -648,6 +668,30 @@ typedef struct
 #define CBC_CODE_FLAGS_STRICT_MODE 0x08
 #define CBC_CODE_FLAGS_ARGUMENTS_NEEDED 0x10
 #define CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED 0x20
+/* The instructions are not copied from the snapshot buffer,
+ * so the vm must not rewrite (quicken) them. */
+#define CBC_CODE_FLAGS_READ_ONLY_BYTE_CODE 0x40
+/* The scope chain has the same layout for each call of the function (it has
+ * no with, catch or direct eval, and it is not a named function expression),
+ * and the lexical environment depth of each identifier is stored at the end
+ * of the byte code. */
+#define CBC_CODE_FLAGS_STATIC_SCOPE 0x80
+
+/**
+ * Identifier depth of an identifier which is resolved by searching the scope chain.
+ */
+#define CBC_UNRESOLVED_IDENTIFIER_DEPTH 0xff
+
+/**
+ * Get the identifier depth table of a function with CBC_CODE_FLAGS_STATIC_SCOPE flag.
+ *
+ * Note:
+ *      the table has an entry for each identifier in the [register_end, ident_end) range
+ */
+#define CBC_GET_IDENTIFIER_DEPTHS(compiled_code_p, register_end, ident_end) \
+  (((uint8_t *) (compiled_code_p)) \
+   + (((size_t) (compiled_code_p)->size) << MEM_ALIGNMENT_LOG) \
+   - ((size_t) (ident_end) - (size_t) (register_end)))
 
 #define CBC_OPCODE(arg1, arg2, arg3, arg4) arg1,
 
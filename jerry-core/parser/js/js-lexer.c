@@ -1609,13 +1609,20 @@ lexer_construct_number_object (parser_context_t *context_p, /**< context */
 
 /**
  * Construct a function literal object.
+ *
+ * Note:
+ *      the literal is not necessarily the last one, since identifiers
+ *      captured by the function are appended to the literal pool
+ *
+ * @return index of the function literal
  */
-void
+uint16_t
 lexer_construct_function_object (parser_context_t *context_p, /**< context */
                                  uint32_t extra_status_flags) /**< extra status flags */
 {
   ecma_compiled_code_t *compiled_code_p;
   lexer_literal_t *literal_p;
+  uint16_t literal_index;
 
   if (context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
   {
@@ -1627,12 +1634,11 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
     extra_status_flags |= PARSER_RESOLVE_THIS_FOR_CALLS;
   }
 
-  context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
-
   literal_p = (lexer_literal_t *) parser_list_append (context_p, &context_p->literal_pool);
   literal_p->type = LEXER_UNUSED_LITERAL;
   literal_p->status_flags = 0;
 
+  literal_index = context_p->literal_count;
   context_p->literal_count++;
 
   compiled_code_p = parser_parse_function (context_p, extra_status_flags);
@@ -1640,7 +1646,7 @@ lexer_construct_function_object (parser_context_t *context_p, /**< context */
   literal_p->u.bytecode_p = compiled_code_p;
 
   literal_p->type = LEXER_FUNCTION_LITERAL;
-  context_p->status_flags |= PARSER_NO_REG_STORE;
+  return literal_index;
 } /* lexer_construct_function_object */
 
 /**
@@ -244,9 +244,12 @@ typedef enum
 } parser_object_literal_item_types_t;
 
 /**
- * Parse object literal.
+ * Append an item to the list of object literal items and check the redefinition rules.
+ *
+ * @return PARSER_TRUE if the item has a name which is not defined by the previous items,
+ *         PARSER_FALSE otherwise
  */
-static void
+static int
 parser_append_object_literal_item (parser_context_t *context_p, /**< context */
                                    uint16_t item_index, /**< index of the item name */
                                    parser_object_literal_item_types_t item_type) /**< type of the item */
@@ -265,7 +268,7 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
     {
       parser_stack_push_uint16 (context_p, item_index);
       parser_stack_push_uint8 (context_p, (uint8_t) item_type);
-      return;
+      return PARSER_TRUE;
     }
 
     iterator.current_position--;
@@ -299,7 +302,7 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
           && *current_item_type_p == PARSER_OBJECT_PROPERTY_VALUE
           && !(context_p->status_flags & PARSER_IS_STRICT))
       {
-        return;
+        return PARSER_FALSE;
       }
 
       if (item_type == PARSER_OBJECT_PROPERTY_GETTER
@@ -326,6 +329,7 @@ parser_append_object_literal_item (parser_context_t *context_p, /**< context */
   {
     context_p->stack_top_uint8 = PARSER_OBJECT_PROPERTY_BOTH_ACCESSORS;
   }
+  return PARSER_FALSE;
 } /* parser_append_object_literal_item */
 
 /**
@@ -336,6 +340,12 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
 {
   JERRY_ASSERT (context_p->token.type == LEXER_LEFT_BRACE);
 
+  uint32_t property_count = 0;
+  uint8_t *property_count_p = NULL;
+  /* Number literals are converted to strings at runtime, so their names
+   * may be equal to the names of other number or string literals. */
+  int has_number_name = PARSER_FALSE;
+
   parser_emit_cbc (context_p, CBC_CREATE_OBJECT);
 
   parser_stack_push_uint8 (context_p, PARSER_OBJECT_PROPERTY_START);
@@ -355,6 +365,7 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
       uint32_t status_flags;
       cbc_ext_opcode_t opcode;
       uint16_t literal_index;
+      uint16_t function_literal_index;
       parser_object_literal_item_types_t item_type;
 
       if (context_p->token.type == LEXER_PROPERTY_GETTER)
@@ -378,10 +389,18 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
       lexer_expect_object_literal_id (context_p, PARSER_TRUE);
       literal_index = context_p->lit_object.index;
 
-      parser_append_object_literal_item (context_p, literal_index, item_type);
+      if (context_p->lit_object.literal_p->type == LEXER_NUMBER_LITERAL)
+      {
+        has_number_name = PARSER_TRUE;
+      }
+
+      if (parser_append_object_literal_item (context_p, literal_index, item_type))
+      {
+        property_count++;
+      }
 
       parser_flush_cbc (context_p);
-      lexer_construct_function_object (context_p, status_flags);
+      function_literal_index = lexer_construct_function_object (context_p, status_flags);
 
       parser_emit_cbc_literal (context_p,
                                CBC_PUSH_LITERAL,
@@ -389,17 +408,29 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
 
       JERRY_ASSERT (context_p->last_cbc_opcode == CBC_PUSH_LITERAL);
       context_p->last_cbc_opcode = PARSER_TO_EXT_OPCODE (opcode);
-      context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+      context_p->last_cbc.value = function_literal_index;
 
       lexer_next_token (context_p);
     }
     else
     {
       uint16_t literal_index = context_p->lit_object.index;
+      uint16_t opcode = CBC_SET_PROPERTY;
 
-      parser_append_object_literal_item (context_p,
-                                         literal_index,
-                                         PARSER_OBJECT_PROPERTY_VALUE);
+      if (parser_append_object_literal_item (context_p,
+                                             literal_index,
+                                             PARSER_OBJECT_PROPERTY_VALUE))
+      {
+        if (context_p->lit_object.literal_p->type == LEXER_NUMBER_LITERAL)
+        {
+          has_number_name = PARSER_TRUE;
+        }
+        else if (!has_number_name)
+        {
+          opcode = (property_count == 0) ? CBC_SET_FIRST_PROPERTY : CBC_SET_NEW_PROPERTY;
+        }
+        property_count++;
+      }
 
       lexer_next_token (context_p);
       if (context_p->token.type != LEXER_COLON)
@@ -410,7 +441,20 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
       lexer_next_token (context_p);
       parser_parse_expression (context_p, PARSE_EXPR_NO_COMMA);
 
-      parser_emit_cbc_literal (context_p, CBC_SET_PROPERTY, literal_index);
+      if (opcode == CBC_SET_FIRST_PROPERTY)
+      {
+        /* The number of properties is known after the whole literal is parsed. */
+        parser_emit_cbc_literal (context_p, CBC_SET_NEW_PROPERTY, literal_index);
+        context_p->last_cbc_opcode = CBC_SET_FIRST_PROPERTY;
+        context_p->last_cbc.value = 0;
+
+        parser_flush_cbc (context_p);
+        property_count_p = context_p->byte_code.last_p->bytes + context_p->byte_code.last_position - 1;
+      }
+      else
+      {
+        parser_emit_cbc_literal (context_p, opcode, literal_index);
+      }
     }
 
     if (context_p->token.type == LEXER_RIGHT_BRACE)
@@ -429,6 +473,11 @@ parser_parse_object_literal (parser_context_t *context_p) /**< context */
   }
 
   parser_stack_pop_uint8 (context_p);
+
+  if (property_count_p != NULL)
+  {
+    *property_count_p = (uint8_t) JERRY_MIN (property_count, CBC_MAXIMUM_BYTE_VALUE);
+  }
 } /* parser_parse_object_literal */
 
 /**
@@ -579,7 +628,7 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
         status_flags |= PARSER_RESOLVE_THIS_FOR_CALLS;
       }
 
-      lexer_construct_function_object (context_p, status_flags);
+      uint16_t function_literal_index = lexer_construct_function_object (context_p, status_flags);
 
       JERRY_ASSERT (context_p->last_cbc_opcode == PARSER_CBC_UNAVAILABLE);
 
@@ -587,20 +636,20 @@ parser_parse_unary_expression (parser_context_t *context_p, /**< context */
       {
         context_p->last_cbc_opcode = CBC_PUSH_TWO_LITERALS;
         context_p->last_cbc.literal_index = literal1;
-        context_p->last_cbc.value = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.value = function_literal_index;
       }
       else if (literals == 2)
       {
         context_p->last_cbc_opcode = CBC_PUSH_THREE_LITERALS;
         context_p->last_cbc.literal_index = literal1;
         context_p->last_cbc.value = literal2;
-        context_p->last_cbc.third_literal_index = (uint16_t) (context_p->literal_count - 1);
+        context_p->last_cbc.third_literal_index = function_literal_index;
       }
       else
       {
         parser_emit_cbc_literal (context_p,
                                  CBC_PUSH_LITERAL,
-                                 (uint16_t) (context_p->literal_count - 1));
+                                 function_literal_index);
       }
 
       context_p->last_cbc.literal_type = LEXER_FUNCTION_LITERAL;
@@ -765,7 +814,10 @@ parser_process_unary_expression (parser_context_t *context_p) /**< context */
               && context_p->last_cbc.literal_object_type == LEXER_LITERAL_OBJECT_EVAL)
           {
             JERRY_ASSERT (context_p->last_cbc.literal_type == LEXER_IDENT_LITERAL);
-            context_p->status_flags |= PARSER_ARGUMENTS_NEEDED | PARSER_LEXICAL_ENV_NEEDED | PARSER_NO_REG_STORE;
+            context_p->status_flags |= (PARSER_ARGUMENTS_NEEDED
+                                        | PARSER_LEXICAL_ENV_NEEDED
+                                        | PARSER_NO_REG_STORE
+                                        | PARSER_HAS_DYNAMIC_SCOPE);
             is_eval = PARSER_TRUE;
           }
 
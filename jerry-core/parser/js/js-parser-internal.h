@@ -51,6 +51,7 @@
 #define PARSER_ARGUMENTS_NOT_NEEDED           0x04000u
 #define PARSER_LEXICAL_ENV_NEEDED             0x08000u
 #define PARSER_HAS_LATE_LIT_INIT              0x10000u
+#define PARSER_HAS_DYNAMIC_SCOPE              0x20000u
 
 /* Expression parsing flags. */
 #define PARSE_EXPR                            0x00
@@ -355,7 +356,7 @@ ecma_char_t lexer_hex_to_character (parser_context_t *context_p, const uint8_t *
 void lexer_expect_object_literal_id (parser_context_t *, int);
 void lexer_construct_literal_object (parser_context_t *, lexer_lit_location_t *, uint8_t);
 int lexer_construct_number_object (parser_context_t *, int, int);
-void lexer_construct_function_object (parser_context_t *, uint32_t);
+uint16_t lexer_construct_function_object (parser_context_t *, uint32_t);
 void lexer_construct_regexp_object (parser_context_t *, int);
 int lexer_compare_identifier_to_current (parser_context_t *, const lexer_lit_location_t *);
 
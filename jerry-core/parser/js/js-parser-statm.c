@@ -358,7 +358,6 @@ parser_parse_function_statement (parser_context_t *context_p) /**< context */
   }
 
   name_p = context_p->lit_object.literal_p;
-  context_p->status_flags |= PARSER_NO_REG_STORE;
 
   status_flags = PARSER_IS_FUNCTION | PARSER_IS_CLOSURE;
   if (context_p->lit_object.type != LEXER_LITERAL_OBJECT_ANY)
@@ -498,7 +497,7 @@ parser_parse_with_statement_start (parser_context_t *context_p) /**< context */
   PARSER_PLUS_EQUAL_U16 (context_p->context_stack_depth, PARSER_WITH_CONTEXT_STACK_ALLOCATION);
 #endif /* PARSER_DEBUG */
 
-  context_p->status_flags |= PARSER_INSIDE_WITH | PARSER_LEXICAL_ENV_NEEDED;
+  context_p->status_flags |= PARSER_INSIDE_WITH | PARSER_LEXICAL_ENV_NEEDED | PARSER_HAS_DYNAMIC_SCOPE;
   parser_emit_cbc_ext_forward_branch (context_p,
                                       CBC_EXT_WITH_CREATE_CONTEXT,
                                       &with_statement.branch);
@@ -1179,7 +1178,7 @@ parser_parse_try_statement_end (parser_context_t *context_p) /**< context */
                    && context_p->token.lit_location.type == LEXER_IDENT_LITERAL);
 
     context_p->lit_object.literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
-    context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+    context_p->status_flags |= PARSER_LEXICAL_ENV_NEEDED | PARSER_HAS_DYNAMIC_SCOPE;
 
     literal_index = context_p->lit_object.index;
 
@@ -128,7 +128,12 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
             {
               JERRY_ASSERT (literal_p == PARSER_GET_LITERAL (0));
 
-              status_flags |= PARSER_NAMED_FUNCTION_EXP | PARSER_NO_REG_STORE | PARSER_LEXICAL_ENV_NEEDED;
+              /* Each invocation creates the function object stored in the name in its
+               * own lexical environment, so recursive calls have deeper scope chains. */
+              status_flags |= (PARSER_NAMED_FUNCTION_EXP
+                               | PARSER_NO_REG_STORE
+                               | PARSER_LEXICAL_ENV_NEEDED
+                               | PARSER_HAS_DYNAMIC_SCOPE);
               context_p->status_flags = status_flags;
 
               literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
@@ -220,6 +225,13 @@ parser_compute_indicies (parser_context_t *context_p, /**< context */
     }
   }
 
+  if (uninitialized_var_count > 0 || initialized_var_count > 0)
+  {
+    /* Variables which are not stored in registers are bound in the lexical environment. */
+    status_flags |= PARSER_LEXICAL_ENV_NEEDED;
+    context_p->status_flags = status_flags;
+  }
+
   register_index = context_p->register_count;
   uninitialized_var_index = register_count;
   initialized_var_index = (uint16_t) (uninitialized_var_index + uninitialized_var_count);
@@ -594,6 +606,92 @@ parser_generate_initializers (parser_context_t *context_p, /**< context */
   return dst_p;
 } /* parser_generate_initializers */
 
+/**
+ * Set the identifier depths of a nested function (and its nested functions), whose
+ * identifiers refer to the variables stored in the lexical environment of an enclosing function.
+ */
+static void
+parser_resolve_identifier_depths (ecma_compiled_code_t *compiled_code_p, /**< nested function */
+                                  uint32_t scope_depth, /**< number of lexical environments between
+                                                         *   the scope of the nested function and
+                                                         *   the lexical environment of the variables */
+                                  const lit_cpointer_t *var_start_p, /**< names of the variables */
+                                  uint16_t var_count) /**< number of variables */
+{
+  lit_cpointer_t *literal_start_p;
+  uint8_t *depth_p;
+  uint16_t register_end;
+  uint16_t ident_end;
+  uint16_t const_literal_end;
+  uint16_t literal_end;
+
+  if ((compiled_code_p->status_flags & (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_STATIC_SCOPE))
+      != (CBC_CODE_FLAGS_FUNCTION | CBC_CODE_FLAGS_STATIC_SCOPE))
+  {
+    /* Regular expressions and functions whose lexical environments are unknown. */
+    return;
+  }
+
+  if (!(compiled_code_p->status_flags & CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED))
+  {
+    scope_depth++;
+  }
+
+  if (scope_depth >= CBC_UNRESOLVED_IDENTIFIER_DEPTH)
+  {
+    return;
+  }
+
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_UINT16_ARGUMENTS)
+  {
+    cbc_uint16_arguments_t *args_p = (cbc_uint16_arguments_t *) compiled_code_p;
+
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    literal_start_p = (lit_cpointer_t *) (args_p + 1);
+  }
+  else
+  {
+    cbc_uint8_arguments_t *args_p = (cbc_uint8_arguments_t *) compiled_code_p;
+
+    register_end = args_p->register_end;
+    ident_end = args_p->ident_end;
+    const_literal_end = args_p->const_literal_end;
+    literal_end = args_p->literal_end;
+    literal_start_p = (lit_cpointer_t *) (args_p + 1);
+  }
+
+  depth_p = CBC_GET_IDENTIFIER_DEPTHS (compiled_code_p, register_end, ident_end);
+
+  for (uint16_t literal_index = register_end; literal_index < ident_end; literal_index++)
+  {
+    /* Identifiers resolved by a function which is closer to the nested function are not changed. */
+    if (*depth_p == CBC_UNRESOLVED_IDENTIFIER_DEPTH)
+    {
+      for (uint16_t var_index = 0; var_index < var_count; var_index++)
+      {
+        if (literal_start_p[literal_index] == var_start_p[var_index])
+        {
+          *depth_p = (uint8_t) scope_depth;
+          break;
+        }
+      }
+    }
+    depth_p++;
+  }
+
+  for (uint16_t literal_index = const_literal_end; literal_index < literal_end; literal_index++)
+  {
+    ecma_compiled_code_t *sub_code_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                                  literal_start_p[literal_index]);
+
+    /* Named function expressions, which refer to themselves, have no static scope. */
+    parser_resolve_identifier_depths (sub_code_p, scope_depth, var_start_p, var_count);
+  }
+} /* parser_resolve_identifier_depths */
+
 /*
  * During byte code post processing certain bytes are not
  * copied into the final byte code buffer. For example, if
@@ -1076,6 +1174,11 @@ parse_print_final_cbc (ecma_compiled_code_t *compiled_code_p, /**< compiled code
     printf (",no_lexical_env");
   }
 
+  if (compiled_code_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+  {
+    printf (",static_scope");
+  }
+
   printf ("]\n");
 
   printf ("  Argument range end: %d\n", (int) argument_end);
@@ -1460,6 +1563,14 @@ parser_post_processing (parser_context_t *context_p) /**< context */
   }
 
   total_size += length + context_p->literal_count * sizeof (lit_cpointer_t);
+
+  if ((context_p->status_flags & (PARSER_IS_FUNCTION | PARSER_HAS_DYNAMIC_SCOPE | PARSER_ARGUMENTS_NEEDED))
+      == PARSER_IS_FUNCTION)
+  {
+    /* Space for the identifier depth table. */
+    total_size += (size_t) (ident_end - context_p->register_count);
+  }
+
   total_size = JERRY_ALIGNUP (total_size, MEM_ALIGNMENT);
 
   compiled_code_p = (ecma_compiled_code_t *) parser_malloc (context_p, total_size);
@@ -1479,6 +1590,9 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     args_p->ident_end = ident_end;
     args_p->const_literal_end = const_literal_end;
     args_p->literal_end = context_p->literal_count;
+#ifdef CONFIG_MEM_LARGE_HEAP
+    args_p->padding = 0;
+#endif /* CONFIG_MEM_LARGE_HEAP */
 
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_UINT16_ARGUMENTS;
     byte_code_p += sizeof (cbc_uint16_arguments_t);
@@ -1519,6 +1633,21 @@ parser_post_processing (parser_context_t *context_p) /**< context */
     compiled_code_p->status_flags |= CBC_CODE_FLAGS_LEXICAL_ENV_NOT_NEEDED;
   }
 
+  if ((context_p->status_flags & (PARSER_IS_FUNCTION | PARSER_HAS_DYNAMIC_SCOPE | PARSER_ARGUMENTS_NEEDED))
+      == PARSER_IS_FUNCTION)
+  {
+    uint8_t *depth_p = CBC_GET_IDENTIFIER_DEPTHS (compiled_code_p, context_p->register_count, ident_end);
+
+    compiled_code_p->status_flags |= CBC_CODE_FLAGS_STATIC_SCOPE;
+
+    /* The variables of the function are stored in its own lexical environment,
+     * the other identifiers are resolved later by the enclosing functions. */
+    memset (depth_p, 0, (size_t) (initialized_var_end - context_p->register_count));
+    memset (depth_p + (initialized_var_end - context_p->register_count),
+            CBC_UNRESOLVED_IDENTIFIER_DEPTH,
+            (size_t) (ident_end - initialized_var_end));
+  }
+
   literal_pool_p = (lit_cpointer_t *) byte_code_p;
   byte_code_p += context_p->literal_count * sizeof (lit_cpointer_t);
 
@@ -1770,6 +1899,23 @@ parser_post_processing (parser_context_t *context_p) /**< context */
                                compiled_code_p);
   }
 
+  if ((compiled_code_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+      && initialized_var_end > context_p->register_count)
+  {
+    /* Nested functions can access the variables of the lexical
+     * environment without searching the scope chain. */
+    for (uint16_t literal_index = const_literal_end; literal_index < context_p->literal_count; literal_index++)
+    {
+      ecma_compiled_code_t *sub_code_p = ECMA_GET_NON_NULL_POINTER (ecma_compiled_code_t,
+                                                                    literal_pool_p[literal_index]);
+
+      parser_resolve_identifier_depths (sub_code_p,
+                                        0,
+                                        literal_pool_p + context_p->register_count,
+                                        (uint16_t) (initialized_var_end - context_p->register_count));
+    }
+  }
+
   return compiled_code_p;
 } /* parser_post_processing */
 
@@ -1934,6 +2080,77 @@ parser_parse_source (const uint8_t *source_p, /**< valid UTF-8 source code */
   return compiled_code;
 } /* parser_parse_source */
 
+/**
+ * Mark the identifiers of the enclosing function, which are referenced by the
+ * currently parsed function, as non-register variables.
+ *
+ * Identifiers which are not found in the enclosing function are appended to its
+ * literal pool, since they might be declared later or by an outer function.
+ */
+static void
+parser_mark_captured_identifiers (parser_context_t *context_p, /**< context */
+                                  parser_saved_context_t *saved_context_p) /**< context of
+                                                                            *   the enclosing function */
+{
+  parser_list_t parent_literal_pool = context_p->literal_pool;
+  parser_list_iterator_t literal_iterator;
+  lexer_literal_t *literal_p;
+
+  parent_literal_pool.data = saved_context_p->literal_pool_data;
+
+  parser_list_iterator_init (&context_p->literal_pool, &literal_iterator);
+  while ((literal_p = (lexer_literal_t *) parser_list_iterator_next (&literal_iterator)))
+  {
+    parser_list_iterator_t parent_literal_iterator;
+    lexer_literal_t *parent_literal_p;
+
+    if (literal_p->type != LEXER_IDENT_LITERAL
+        || (literal_p->status_flags & LEXER_FLAG_VAR))
+    {
+      continue;
+    }
+
+    parser_list_iterator_init (&parent_literal_pool, &parent_literal_iterator);
+    while ((parent_literal_p = (lexer_literal_t *) parser_list_iterator_next (&parent_literal_iterator)))
+    {
+      if (parent_literal_p->type == LEXER_IDENT_LITERAL
+          && parent_literal_p->prop.length == literal_p->prop.length
+          && memcmp (parent_literal_p->u.char_p, literal_p->u.char_p, literal_p->prop.length) == 0)
+      {
+        break;
+      }
+    }
+
+    if (parent_literal_p == NULL)
+    {
+      if (saved_context_p->literal_count >= PARSER_MAXIMUM_NUMBER_OF_LITERALS)
+      {
+        parser_raise_error (context_p, PARSER_ERR_LITERAL_LIMIT_REACHED);
+      }
+
+      parent_literal_p = (lexer_literal_t *) parser_list_append (context_p, &parent_literal_pool);
+      saved_context_p->literal_pool_data = parent_literal_pool.data;
+      saved_context_p->literal_count++;
+
+      parent_literal_p->prop.length = literal_p->prop.length;
+      parent_literal_p->type = LEXER_IDENT_LITERAL;
+      parent_literal_p->status_flags = (uint8_t) (literal_p->status_flags & LEXER_FLAG_SOURCE_PTR);
+
+      if (literal_p->status_flags & LEXER_FLAG_SOURCE_PTR)
+      {
+        parent_literal_p->u.char_p = literal_p->u.char_p;
+      }
+      else
+      {
+        parent_literal_p->u.char_p = (uint8_t *) mem_heap_alloc_block_store_size (literal_p->prop.length);
+        memcpy ((uint8_t *) parent_literal_p->u.char_p, literal_p->u.char_p, literal_p->prop.length);
+      }
+    }
+
+    parent_literal_p->status_flags |= LEXER_FLAG_NO_REG_STORE;
+  }
+} /* parser_mark_captured_identifiers */
+
 /**
  * Parse function code
  *
@@ -2152,6 +2369,17 @@ parser_parse_function (parser_context_t *context_p, /**< context */
 
   lexer_next_token (context_p);
   parser_parse_statements (context_p);
+
+  if (context_p->status_flags & PARSER_NO_REG_STORE)
+  {
+    /* A direct eval call can access any variable of the enclosing functions. */
+    saved_context.status_flags |= PARSER_NO_REG_STORE;
+  }
+  else if (!(saved_context.status_flags & PARSER_NO_REG_STORE))
+  {
+    parser_mark_captured_identifiers (context_p, &saved_context);
+  }
+
   compiled_code_p = parser_post_processing (context_p);
 
 #ifdef PARSER_DUMP_BYTE_CODE
@@ -488,10 +488,15 @@ re_find_bytecode_in_cache (ecma_string_t *pattern_str_p, /**< pattern string */
 
 /**
  * Run gerbage collection in RegExp cache
+ *
+ * @return number of freed cache entries
  */
-void
+uint32_t
 re_cache_gc_run ()
 {
+  uint32_t freed_entries = 0;
+
+
   for (uint32_t i = 0u; i < RE_CACHE_SIZE; i++)
   {
     const re_compiled_code_t *cached_bytecode_p = re_cache[i];
@@ -502,8 +507,11 @@ re_cache_gc_run ()
       /* Only the cache has reference for the bytecode */
       ecma_bytecode_deref ((ecma_compiled_code_t *) cached_bytecode_p);
       re_cache[i] = NULL;
+      freed_entries++;
     }
   }
+
+  return freed_entries;
 } /* re_cache_gc_run */
 
 /**
@@ -50,7 +50,7 @@ typedef struct
 ecma_value_t
 re_compile_bytecode (const re_compiled_code_t **, ecma_string_t *, uint16_t);
 
-void re_cache_gc_run ();
+uint32_t re_cache_gc_run ();
 
 /**
  * @}
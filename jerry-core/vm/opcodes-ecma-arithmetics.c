@@ -45,43 +45,86 @@ do_number_arithmetic (number_arithmetic_op op, /**< number arithmetic operation
                       ecma_value_t left_value, /**< left value */
                       ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+    ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+    /* The sum and the difference of two small integers always fit into an int32_t. */
+    switch (op)
+    {
+      case NUMBER_ARITHMETIC_ADDITION:
+      {
+        return ecma_make_int32_value (left_integer + right_integer);
+      }
+      case NUMBER_ARITHMETIC_SUBSTRACTION:
+      {
+        return ecma_make_int32_value (left_integer - right_integer);
+      }
+      case NUMBER_ARITHMETIC_MULTIPLICATION:
+      {
+        int64_t product = (int64_t) left_integer * right_integer;
+
+        /* A zero product of a negative factor is negative zero, which is not an integer. */
+        if (ECMA_IS_INTEGER_NUMBER (product)
+            && (product != 0 || (left_integer >= 0 && right_integer >= 0)))
+        {
+          return ecma_make_integer_value ((ecma_integer_value_t) product);
+        }
+        break;
+      }
+      case NUMBER_ARITHMETIC_DIVISION:
+      {
+        break;
+      }
+      case NUMBER_ARITHMETIC_REMAINDER:
+      {
+        if (left_integer >= 0 && right_integer > 0)
+        {
+          return ecma_make_integer_value (left_integer % right_integer);
+        }
+        break;
+      }
+    }
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_left, left_value, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_right, right_value, ret_value);
 
-  ecma_number_t *res_p = ecma_alloc_number ();
+  ecma_number_t result = ecma_number_make_nan ();
 
   switch (op)
   {
     case NUMBER_ARITHMETIC_ADDITION:
     {
-      *res_p = ecma_number_add (num_left, num_right);
+      result = ecma_number_add (num_left, num_right);
       break;
     }
     case NUMBER_ARITHMETIC_SUBSTRACTION:
     {
-      *res_p = ecma_number_substract (num_left, num_right);
+      result = ecma_number_substract (num_left, num_right);
       break;
     }
     case NUMBER_ARITHMETIC_MULTIPLICATION:
     {
-      *res_p = ecma_number_multiply (num_left, num_right);
+      result = ecma_number_multiply (num_left, num_right);
       break;
     }
     case NUMBER_ARITHMETIC_DIVISION:
     {
-      *res_p = ecma_number_divide (num_left, num_right);
+      result = ecma_number_divide (num_left, num_right);
       break;
     }
     case NUMBER_ARITHMETIC_REMAINDER:
     {
-      *res_p = ecma_op_number_remainder (num_left, num_right);
+      result = ecma_op_number_remainder (num_left, num_right);
       break;
     }
   }
 
-  ret_value = ecma_make_number_value (res_p);
+  ret_value = ecma_make_normalized_number_value (result);
 
   ECMA_OP_TO_NUMBER_FINALIZE (num_right);
   ECMA_OP_TO_NUMBER_FINALIZE (num_left);
@@ -101,6 +144,11 @@ ecma_value_t
 opfunc_addition (ecma_value_t left_value, /**< left value */
                  ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    return do_number_arithmetic (NUMBER_ARITHMETIC_ADDITION, left_value, right_value);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (prim_left_value,
@@ -158,10 +206,7 @@ opfunc_unary_plus (ecma_value_t left_value) /**< left value */
                                left_value,
                                ret_value);
 
-  ecma_number_t *tmp_p = ecma_alloc_number ();
-
-  *tmp_p = num_var_value;
-  ret_value = ecma_make_number_value (tmp_p);
+  ret_value = ecma_make_normalized_number_value (num_var_value);
 
   ECMA_OP_TO_NUMBER_FINALIZE (num_var_value);
 
@@ -185,10 +230,7 @@ opfunc_unary_minus (ecma_value_t left_value) /**< left value */
                                left_value,
                                ret_value);
 
-  ecma_number_t *tmp_p = ecma_alloc_number ();
-
-  *tmp_p = ecma_number_negate (num_var_value);
-  ret_value = ecma_make_number_value (tmp_p);
+  ret_value = ecma_make_normalized_number_value (ecma_number_negate (num_var_value));
 
   ECMA_OP_TO_NUMBER_FINALIZE (num_var_value);
 
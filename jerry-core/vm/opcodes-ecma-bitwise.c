@@ -43,12 +43,49 @@ do_number_bitwise_logic (number_bitwise_logic_op op, /**< number bitwise logic o
                          ecma_value_t left_value, /**< left value */
                          ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    ecma_integer_value_t left_integer = ecma_get_integer_from_value (left_value);
+    ecma_integer_value_t right_integer = ecma_get_integer_from_value (right_value);
+
+    switch (op)
+    {
+      case NUMBER_BITWISE_LOGIC_AND:
+      {
+        return ecma_make_integer_value (left_integer & right_integer);
+      }
+      case NUMBER_BITWISE_LOGIC_OR:
+      {
+        return ecma_make_integer_value (left_integer | right_integer);
+      }
+      case NUMBER_BITWISE_LOGIC_XOR:
+      {
+        return ecma_make_integer_value (left_integer ^ right_integer);
+      }
+      case NUMBER_BITWISE_SHIFT_LEFT:
+      {
+        return ecma_make_int32_value ((int32_t) ((uint32_t) left_integer << (right_integer & 0x1F)));
+      }
+      case NUMBER_BITWISE_SHIFT_RIGHT:
+      {
+        return ecma_make_integer_value (left_integer >> (right_integer & 0x1F));
+      }
+      case NUMBER_BITWISE_SHIFT_URIGHT:
+      {
+        return ecma_make_uint32_value ((uint32_t) left_integer >> (right_integer & 0x1F));
+      }
+      case NUMBER_BITWISE_NOT:
+      {
+        return ecma_make_integer_value (~right_integer);
+      }
+    }
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_left, left_value, ret_value);
   ECMA_OP_TO_NUMBER_TRY_CATCH (num_right, right_value, ret_value);
 
-  ecma_number_t *res_p = ecma_alloc_number ();
   uint32_t right_uint32 = ecma_number_to_uint32 (num_right);
 
   switch (op)
@@ -56,46 +93,44 @@ do_number_bitwise_logic (number_bitwise_logic_op op, /**< number bitwise logic o
     case NUMBER_BITWISE_LOGIC_AND:
     {
       uint32_t left_uint32 = ecma_number_to_uint32 (num_left);
-      *res_p = (ecma_number_t) ((int32_t) (left_uint32 & right_uint32));
+      ret_value = ecma_make_int32_value ((int32_t) (left_uint32 & right_uint32));
       break;
     }
     case NUMBER_BITWISE_LOGIC_OR:
     {
       uint32_t left_uint32 = ecma_number_to_uint32 (num_left);
-      *res_p = (ecma_number_t) ((int32_t) (left_uint32 | right_uint32));
+      ret_value = ecma_make_int32_value ((int32_t) (left_uint32 | right_uint32));
       break;
     }
     case NUMBER_BITWISE_LOGIC_XOR:
     {
       uint32_t left_uint32 = ecma_number_to_uint32 (num_left);
-      *res_p = (ecma_number_t) ((int32_t) (left_uint32 ^ right_uint32));
+      ret_value = ecma_make_int32_value ((int32_t) (left_uint32 ^ right_uint32));
       break;
     }
     case NUMBER_BITWISE_SHIFT_LEFT:
     {
-      *res_p = (ecma_number_t) (ecma_number_to_int32 (num_left) << (right_uint32 & 0x1F));
+      ret_value = ecma_make_int32_value ((int32_t) (ecma_number_to_uint32 (num_left) << (right_uint32 & 0x1F)));
       break;
     }
     case NUMBER_BITWISE_SHIFT_RIGHT:
     {
-      *res_p = (ecma_number_t) (ecma_number_to_int32 (num_left) >> (right_uint32 & 0x1F));
+      ret_value = ecma_make_int32_value (ecma_number_to_int32 (num_left) >> (right_uint32 & 0x1F));
       break;
     }
     case NUMBER_BITWISE_SHIFT_URIGHT:
     {
       uint32_t left_uint32 = ecma_number_to_uint32 (num_left);
-      *res_p = (ecma_number_t) (left_uint32 >> (right_uint32 & 0x1F));
+      ret_value = ecma_make_uint32_value (left_uint32 >> (right_uint32 & 0x1F));
       break;
     }
     case NUMBER_BITWISE_NOT:
     {
-      *res_p = (ecma_number_t) ((int32_t) ~right_uint32);
+      ret_value = ecma_make_int32_value ((int32_t) ~right_uint32);
       break;
     }
   }
 
-  ret_value = ecma_make_number_value (res_p);
-
   ECMA_OP_TO_NUMBER_FINALIZE (num_right);
   ECMA_OP_TO_NUMBER_FINALIZE (num_left);
 
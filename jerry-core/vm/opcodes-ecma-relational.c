@@ -41,6 +41,13 @@ ecma_value_t
 opfunc_less_than (ecma_value_t left_value, /**< left value */
                   ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    bool is_true = ecma_get_integer_from_value (left_value) < ecma_get_integer_from_value (right_value);
+
+    return ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (compare_result,
@@ -75,6 +82,13 @@ ecma_value_t
 opfunc_greater_than (ecma_value_t left_value, /**< left value */
                      ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    bool is_true = ecma_get_integer_from_value (left_value) > ecma_get_integer_from_value (right_value);
+
+    return ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (compare_result,
@@ -109,6 +123,13 @@ ecma_value_t
 opfunc_less_or_equal_than (ecma_value_t left_value, /**< left value */
                            ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    bool is_true = ecma_get_integer_from_value (left_value) <= ecma_get_integer_from_value (right_value);
+
+    return ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (compare_result,
@@ -150,6 +171,13 @@ ecma_value_t
 opfunc_greater_or_equal_than (ecma_value_t left_value, /**< left value */
                               ecma_value_t right_value) /**< right value */
 {
+  if (ecma_are_values_integer_numbers (left_value, right_value))
+  {
+    bool is_true = ecma_get_integer_from_value (left_value) >= ecma_get_integer_from_value (right_value);
+
+    return ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+  }
+
   ecma_value_t ret_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (compare_result,
@@ -24,6 +24,7 @@
 #include "ecma-function-object.h"
 #include "ecma-gc.h"
 #include "ecma-helpers.h"
+#include "ecma-inline-cache.h"
 #include "ecma-lex-env.h"
 #include "ecma-objects.h"
 #include "ecma-objects-general.h"
@@ -58,6 +59,40 @@ static bool is_direct_eval_form_call = false;
  */
 static ecma_compiled_code_t *__program = NULL;
 
+/**
+ * Get the index represented by a property name, if the name does not need to be
+ * converted to string for accessing the property
+ *
+ * @return true - if the property name is a number with an uint32 integer value,
+ *                or a string, which stores such a number,
+ *         false - otherwise
+ */
+static inline bool __attr_always_inline___
+vm_get_property_index (ecma_value_t property, /**< property name */
+                       uint32_t *index_p) /**< [out] index */
+{
+  if (ecma_is_value_number (property))
+  {
+    ecma_number_t index_num = ecma_get_number_from_value (property);
+    *index_p = ecma_number_to_uint32 (index_num);
+
+    return (ecma_number_t) *index_p == index_num;
+  }
+
+  if (ecma_is_value_string (property))
+  {
+    ecma_string_t *property_name_p = ecma_get_string_from_value (property);
+
+    if (ECMA_STRING_GET_CONTAINER (property_name_p) == ECMA_STRING_CONTAINER_UINT32_IN_DESC)
+    {
+      *index_p = property_name_p->u.uint32_number;
+      return true;
+    }
+  }
+
+  return false;
+} /* vm_get_property_index */
+
 /**
  * Get the value of object[property].
  *
@@ -66,14 +101,50 @@ static ecma_compiled_code_t *__program = NULL;
 static ecma_value_t
 vm_op_get_value (ecma_value_t object, /**< base object */
                  ecma_value_t property, /**< property name */
-                 bool is_strict) /**< strict mode */
+                 bool is_strict, /**< strict mode */
+                 const uint8_t *byte_code_p) /**< instruction, which reads the value */
 {
   if (unlikely (ecma_is_value_undefined (object) || ecma_is_value_null (object)))
   {
     return ecma_raise_type_error (ECMA_ERR_MSG (""));
   }
 
-  ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
+  uint32_t index;
+
+  /* Elements are read without converting the index to string. */
+  if (vm_get_property_index (property, &index))
+  {
+    if (ecma_is_value_object (object))
+    {
+      return ecma_op_object_get_by_index (ecma_get_object_from_value (object), index);
+    }
+
+    if (ecma_is_value_string (object))
+    {
+      ecma_string_t *string_p = ecma_get_string_from_value (object);
+
+      if (index < ecma_string_get_length (string_p))
+      {
+        ecma_char_t c = ecma_string_get_char_at_pos (string_p, index);
+
+        return ecma_make_string_value (ecma_new_ecma_string_from_code_unit (c));
+      }
+    }
+  }
+
+  ecma_value_t completion_value;
+
+  if (ecma_is_value_object (object)
+      && ecma_is_value_string (property)
+      && ecma_inline_cache_get (byte_code_p,
+                                ecma_get_object_from_value (object),
+                                ecma_get_string_from_value (property),
+                                &completion_value))
+  {
+    return completion_value;
+  }
+
+  completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (property_val,
                   ecma_op_to_string (property),
@@ -101,8 +172,29 @@ static ecma_value_t
 vm_op_set_value (ecma_value_t object, /**< base object */
                  ecma_value_t property, /**< property name */
                  ecma_value_t value, /**< ecma value */
-                 bool is_strict) /**< strict mode */
+                 bool is_strict, /**< strict mode */
+                 const uint8_t *byte_code_p) /**< instruction, which sets the value */
 {
+  uint32_t index;
+
+  /* Elements are written without converting the index to string. */
+  if (ecma_is_value_object (object)
+      && !ecma_is_lexical_environment (ecma_get_object_from_value (object))
+      && vm_get_property_index (property, &index))
+  {
+    return ecma_op_object_put_by_index (ecma_get_object_from_value (object), index, value, is_strict);
+  }
+
+  if (ecma_is_value_object (object)
+      && ecma_is_value_string (property)
+      && ecma_inline_cache_put (byte_code_p,
+                                ecma_get_object_from_value (object),
+                                ecma_get_string_from_value (property),
+                                value))
+  {
+    return ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
+  }
+
   ecma_value_t completion_value = ecma_make_simple_value (ECMA_SIMPLE_VALUE_EMPTY);
 
   ECMA_TRY_CATCH (obj_val,
@@ -137,6 +229,54 @@ vm_op_set_value (ecma_value_t object, /**< base object */
   return completion_value;
 } /* vm_op_set_value */
 
+/**
+ * Rewrite a generic binary opcode to its form which is specialized
+ * for the operand types, if both operands are numbers or strings.
+ *
+ * Note:
+ *      string_opcode is CBC_END, if the operation has no string specialization
+ */
+static void
+vm_quicken_binary_opcode (const ecma_compiled_code_t *bytecode_header_p, /**< byte code header */
+                          uint8_t *byte_code_p, /**< instruction */
+                          uint8_t generic_opcode, /**< first form of the generic opcode */
+                          uint8_t number_opcode, /**< first form of the number specialization */
+                          uint8_t string_opcode, /**< first form of the string specialization */
+                          ecma_value_t left_value, /**< left operand */
+                          ecma_value_t right_value) /**< right operand */
+{
+  uint8_t form = (uint8_t) (*byte_code_p - generic_opcode);
+
+  /* Compound assignments are executed by the same vm groups, but they are never rewritten. */
+  if (form > CBC_BINARY_WITH_TWO_LITERALS
+      || (bytecode_header_p->status_flags & CBC_CODE_FLAGS_READ_ONLY_BYTE_CODE))
+  {
+    return;
+  }
+
+  if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+  {
+    *byte_code_p = (uint8_t) (number_opcode + form);
+  }
+  else if (string_opcode != CBC_END
+           && ecma_is_value_string (left_value)
+           && ecma_is_value_string (right_value))
+  {
+    *byte_code_p = (uint8_t) (string_opcode + form);
+  }
+} /* vm_quicken_binary_opcode */
+
+/**
+ * Restore the generic form of a specialized binary opcode, whose operand types do not match.
+ */
+static inline void __attr_always_inline___
+vm_deoptimize_binary_opcode (uint8_t *byte_code_p, /**< instruction */
+                             uint8_t specialized_opcode, /**< first form of the specialized opcode */
+                             uint8_t generic_opcode) /**< first form of the generic opcode */
+{
+  *byte_code_p = (uint8_t) (generic_opcode + (*byte_code_p - specialized_opcode));
+} /* vm_deoptimize_binary_opcode */
+
 /**
  * Initialize interpreter.
  */
@@ -329,6 +469,38 @@ vm_get_implicit_this_value (ecma_value_t *this_value_p) /**< [in,out] this value
   return false;
 } /* vm_get_implicit_this_value */
 
+/**
+ * Find the lexical environment which contains the binding of an identifier.
+ *
+ * Note:
+ *      the depth of the lexical environment is taken from the
+ *      identifier depth table of the byte code, if it is available
+ *
+ * @return lexical environment - if the identifier is found,
+ *         NULL - otherwise
+ */
+static inline ecma_object_t * __attr_always_inline___
+vm_resolve_identifier_base (ecma_object_t *lex_env_p, /**< starting lexical environment */
+                            const uint8_t *ident_depths_p, /**< identifier depth table or NULL */
+                            uint32_t depth_index, /**< index of the identifier in the depth table */
+                            ecma_string_t *name_p) /**< identifier's name */
+{
+  if (ident_depths_p != NULL
+      && ident_depths_p[depth_index] != CBC_UNRESOLVED_IDENTIFIER_DEPTH)
+  {
+    for (uint32_t depth = ident_depths_p[depth_index]; depth > 0; depth--)
+    {
+      lex_env_p = ecma_get_lex_env_outer_reference (lex_env_p);
+    }
+
+    JERRY_ASSERT (ecma_get_lex_env_type (lex_env_p) == ECMA_LEXICAL_ENVIRONMENT_DECLARATIVE);
+    JERRY_ASSERT (ecma_op_has_binding (lex_env_p, name_p));
+    return lex_env_p;
+  }
+
+  return ecma_op_resolve_reference_base (lex_env_p, name_p);
+} /* vm_resolve_identifier_base */
+
 /**
  * 'Function call' opcode handler.
  *
@@ -460,6 +632,38 @@ enum
   VM_FREE_RIGHT_VALUE = 0x2,
 };
 
+#if defined (__GNUC__) && !defined (CONFIG_VM_COMPUTED_GOTO_DISABLE)
+
+/**
+ * Instruction groups are dispatched by jumping to the address of their handlers,
+ * which is faster than the range check and table lookup of a switch statement.
+ */
+#define VM_COMPUTED_GOTO
+
+/**
+ * Case label of an instruction group handler, which is also the target of computed goto
+ */
+#define VM_CASE(group) case group: vm_handler_ ## group
+
+/**
+ * Entry of the handler address table of instruction groups
+ */
+#define VM_HANDLER(group) [group] = __extension__ &&vm_handler_ ## group
+
+/**
+ * Jump to the handler of an instruction group
+ */
+#define VM_DISPATCH(handlers, group) __extension__ ({ goto *(handlers)[group]; })
+
+#else /* !__GNUC__ || CONFIG_VM_COMPUTED_GOTO_DISABLE */
+
+/**
+ * Case label of an instruction group handler
+ */
+#define VM_CASE(group) case group
+
+#endif /* __GNUC__ && !CONFIG_VM_COMPUTED_GOTO_DISABLE */
+
 #define READ_LITERAL_INDEX(destination) \
   do \
   { \
@@ -488,8 +692,10 @@ enum
       else \
       { \
         ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]); \
-        ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p, \
-                                                                            name_p); \
+        ecma_object_t *ref_base_lex_env_p = vm_resolve_identifier_base (frame_ctx_p->lex_env_p, \
+                                                                        ident_depths_p, \
+                                                                        (uint32_t) ((literal_index) - register_end), \
+                                                                        name_p); \
         if (ref_base_lex_env_p != NULL) \
         { \
           last_completion_value = ecma_op_get_value_lex_env_base (ref_base_lex_env_p, \
@@ -517,9 +723,7 @@ enum
       lit_literal_t lit = lit_cpointer_decompress (lit_cpointer); \
       if (unlikely (LIT_RECORD_IS_NUMBER (lit))) \
       { \
-        ecma_number_t *number_p = ecma_alloc_number (); \
-        *number_p = lit_number_literal_get_number (lit); \
-        (target_value) = ecma_make_number_value (number_p); \
+        (target_value) = ecma_make_normalized_number_value (lit_number_literal_get_number (lit)); \
       } \
       else \
       { \
@@ -636,6 +840,22 @@ vm_init_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         {
           uint32_t value_index;
           ecma_value_t lit_value;
+
+          if (literal_index < register_end)
+          {
+            /* Function declaration stored in a register. */
+            JERRY_ASSERT (type == CBC_INITIALIZE_VAR);
+
+            READ_LITERAL_INDEX (value_index);
+            JERRY_ASSERT (value_index >= register_end);
+
+            ecma_free_value (frame_ctx_p->registers_p[literal_index]);
+            frame_ctx_p->registers_p[literal_index] = vm_construct_literal_object (frame_ctx_p,
+                                                                                   literal_start_p[value_index]);
+            literal_index++;
+            continue;
+          }
+
           ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
 
           vm_var_decl (frame_ctx_p, name_p);
@@ -710,6 +930,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint16_t register_end;
   uint16_t ident_end;
   uint16_t const_literal_end;
+  const uint8_t *ident_depths_p = NULL;
   int32_t branch_offset = 0;
   ecma_value_t left_value = 0;
   ecma_value_t right_value = 0;
@@ -718,6 +939,106 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
   uint8_t free_flags = 0;
   bool is_strict = ((frame_ctx_p->bytecode_header_p->status_flags & CBC_CODE_FLAGS_STRICT_MODE) != 0);
 
+#ifdef VM_COMPUTED_GOTO
+  static const void * const vm_handlers[] =
+  {
+    VM_HANDLER (VM_OC_NONE),
+    VM_HANDLER (VM_OC_POP),
+    VM_HANDLER (VM_OC_POP_BLOCK),
+    VM_HANDLER (VM_OC_PUSH),
+    VM_HANDLER (VM_OC_PUSH_TWO),
+    VM_HANDLER (VM_OC_PUSH_THREE),
+    VM_HANDLER (VM_OC_PUSH_UNDEFINED),
+    VM_HANDLER (VM_OC_PUSH_TRUE),
+    VM_HANDLER (VM_OC_PUSH_FALSE),
+    VM_HANDLER (VM_OC_PUSH_NULL),
+    VM_HANDLER (VM_OC_PUSH_THIS),
+    VM_HANDLER (VM_OC_PUSH_NUMBER),
+    VM_HANDLER (VM_OC_PUSH_OBJECT),
+    VM_HANDLER (VM_OC_SET_PROPERTY),
+    VM_HANDLER (VM_OC_SET_NEW_PROPERTY),
+    VM_HANDLER (VM_OC_SET_GETTER),
+    VM_HANDLER (VM_OC_SET_SETTER),
+    VM_HANDLER (VM_OC_PUSH_UNDEFINED_BASE),
+    VM_HANDLER (VM_OC_PUSH_ARRAY),
+    VM_HANDLER (VM_OC_PUSH_ELISON),
+    VM_HANDLER (VM_OC_APPEND_ARRAY),
+    VM_HANDLER (VM_OC_IDENT_REFERENCE),
+    VM_HANDLER (VM_OC_PROP_REFERENCE),
+    VM_HANDLER (VM_OC_PROP_GET),
+    VM_HANDLER (VM_OC_PROP_PRE_INCR),
+    VM_HANDLER (VM_OC_PRE_INCR),
+    VM_HANDLER (VM_OC_PROP_PRE_DECR),
+    VM_HANDLER (VM_OC_PRE_DECR),
+    VM_HANDLER (VM_OC_PROP_POST_INCR),
+    VM_HANDLER (VM_OC_POST_INCR),
+    VM_HANDLER (VM_OC_PROP_POST_DECR),
+    VM_HANDLER (VM_OC_POST_DECR),
+    VM_HANDLER (VM_OC_PROP_DELETE),
+    VM_HANDLER (VM_OC_DELETE),
+    VM_HANDLER (VM_OC_ASSIGN),
+    VM_HANDLER (VM_OC_ASSIGN_PROP),
+    VM_HANDLER (VM_OC_ASSIGN_PROP_THIS),
+    VM_HANDLER (VM_OC_RET),
+    VM_HANDLER (VM_OC_THROW),
+    VM_HANDLER (VM_OC_THROW_REFERENCE_ERROR),
+    VM_HANDLER (VM_OC_EVAL),
+    VM_HANDLER (VM_OC_CALL),
+    VM_HANDLER (VM_OC_NEW),
+    VM_HANDLER (VM_OC_JUMP),
+    VM_HANDLER (VM_OC_BRANCH_IF_STRICT_EQUAL),
+    VM_HANDLER (VM_OC_BRANCH_IF_TRUE),
+    VM_HANDLER (VM_OC_BRANCH_IF_FALSE),
+    VM_HANDLER (VM_OC_BRANCH_IF_LOGICAL_TRUE),
+    VM_HANDLER (VM_OC_BRANCH_IF_LOGICAL_FALSE),
+    VM_HANDLER (VM_OC_PLUS),
+    VM_HANDLER (VM_OC_MINUS),
+    VM_HANDLER (VM_OC_NOT),
+    VM_HANDLER (VM_OC_BIT_NOT),
+    VM_HANDLER (VM_OC_VOID),
+    VM_HANDLER (VM_OC_TYPEOF_IDENT),
+    VM_HANDLER (VM_OC_TYPEOF),
+    VM_HANDLER (VM_OC_ADD),
+    VM_HANDLER (VM_OC_SUB),
+    VM_HANDLER (VM_OC_MUL),
+    VM_HANDLER (VM_OC_DIV),
+    VM_HANDLER (VM_OC_MOD),
+    VM_HANDLER (VM_OC_EQUAL),
+    VM_HANDLER (VM_OC_NOT_EQUAL),
+    VM_HANDLER (VM_OC_STRICT_EQUAL),
+    VM_HANDLER (VM_OC_STRICT_NOT_EQUAL),
+    VM_HANDLER (VM_OC_LESS),
+    VM_HANDLER (VM_OC_GREATER),
+    VM_HANDLER (VM_OC_LESS_EQUAL),
+    VM_HANDLER (VM_OC_GREATER_EQUAL),
+    VM_HANDLER (VM_OC_IN),
+    VM_HANDLER (VM_OC_INSTANCEOF),
+    VM_HANDLER (VM_OC_BIT_OR),
+    VM_HANDLER (VM_OC_BIT_XOR),
+    VM_HANDLER (VM_OC_BIT_AND),
+    VM_HANDLER (VM_OC_LEFT_SHIFT),
+    VM_HANDLER (VM_OC_RIGHT_SHIFT),
+    VM_HANDLER (VM_OC_UNS_RIGHT_SHIFT),
+    VM_HANDLER (VM_OC_ADD_NUMBER),
+    VM_HANDLER (VM_OC_ADD_STRING),
+    VM_HANDLER (VM_OC_SUB_NUMBER),
+    VM_HANDLER (VM_OC_LESS_NUMBER),
+    VM_HANDLER (VM_OC_GREATER_NUMBER),
+    VM_HANDLER (VM_OC_WITH),
+    VM_HANDLER (VM_OC_FOR_IN_CREATE_CONTEXT),
+    VM_HANDLER (VM_OC_FOR_IN_GET_NEXT),
+    VM_HANDLER (VM_OC_FOR_IN_HAS_NEXT),
+    VM_HANDLER (VM_OC_TRY),
+    VM_HANDLER (VM_OC_CATCH),
+    VM_HANDLER (VM_OC_FINALLY),
+    VM_HANDLER (VM_OC_CONTEXT_END),
+    VM_HANDLER (VM_OC_JUMP_AND_EXIT_CONTEXT),
+  };
+
+  JERRY_STATIC_ASSERT (sizeof (vm_handlers) / sizeof (vm_handlers[0]) == VM_OC_JUMP_AND_EXIT_CONTEXT + 1,
+                       each_instruction_group_must_have_a_handler_address);
+#endif /* VM_COMPUTED_GOTO */
+
   /* Prepare for byte code execution. */
   if (!(bytecode_header_p->status_flags & CBC_CODE_FLAGS_FULL_LITERAL_ENCODING))
   {
@@ -745,6 +1066,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
     const_literal_end = args_p->const_literal_end;
   }
 
+  if (bytecode_header_p->status_flags & CBC_CODE_FLAGS_STATIC_SCOPE)
+  {
+    ident_depths_p = CBC_GET_IDENTIFIER_DEPTHS (bytecode_header_p, register_end, ident_end);
+  }
+
   stack_top_p = frame_ctx_p->stack_top_p;
 
   /* Outer loop for exception handling. */
@@ -885,36 +1211,43 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
         }
       }
 
+#ifdef VM_COMPUTED_GOTO
+      JERRY_ASSERT (VM_OC_GROUP_GET_INDEX (opcode_data) <= VM_OC_JUMP_AND_EXIT_CONTEXT
+                    && vm_handlers[VM_OC_GROUP_GET_INDEX (opcode_data)] != NULL);
+
+      VM_DISPATCH (vm_handlers, VM_OC_GROUP_GET_INDEX (opcode_data));
+#endif /* VM_COMPUTED_GOTO */
+
       switch (VM_OC_GROUP_GET_INDEX (opcode_data))
       {
-        case VM_OC_NONE:
+        VM_CASE (VM_OC_NONE):
         {
           JERRY_ASSERT (opcode == CBC_EXT_DEBUGGER);
           break;
         }
-        case VM_OC_POP:
+        VM_CASE (VM_OC_POP):
         {
           JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
           ecma_free_value (*(--stack_top_p));
           break;
         }
-        case VM_OC_POP_BLOCK:
+        VM_CASE (VM_OC_POP_BLOCK):
         {
           result = *(--stack_top_p);
           break;
         }
-        case VM_OC_PUSH:
+        VM_CASE (VM_OC_PUSH):
         {
           *(stack_top_p++) = left_value;
           continue;
         }
-        case VM_OC_PUSH_TWO:
+        VM_CASE (VM_OC_PUSH_TWO):
         {
           *(stack_top_p++) = left_value;
           *(stack_top_p++) = right_value;
           continue;
         }
-        case VM_OC_PUSH_THREE:
+        VM_CASE (VM_OC_PUSH_THREE):
         {
           uint16_t literal_index;
 
@@ -929,43 +1262,39 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           *(stack_top_p++) = left_value;
           continue;
         }
-        case VM_OC_PUSH_UNDEFINED:
-        case VM_OC_VOID:
+        VM_CASE (VM_OC_PUSH_UNDEFINED):
+        VM_CASE (VM_OC_VOID):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
           break;
         }
-        case VM_OC_PUSH_TRUE:
+        VM_CASE (VM_OC_PUSH_TRUE):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_TRUE);
           break;
         }
-        case VM_OC_PUSH_FALSE:
+        VM_CASE (VM_OC_PUSH_FALSE):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_FALSE);
           break;
         }
-        case VM_OC_PUSH_NULL:
+        VM_CASE (VM_OC_PUSH_NULL):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_NULL);
           break;
         }
-        case VM_OC_PUSH_THIS:
+        VM_CASE (VM_OC_PUSH_THIS):
         {
           result = ecma_copy_value (frame_ctx_p->this_binding);
           break;
         }
-        case VM_OC_PUSH_NUMBER:
+        VM_CASE (VM_OC_PUSH_NUMBER):
         {
-          ecma_number_t *number_p = ecma_alloc_number ();
+          ecma_integer_value_t value = 0;
 
-          if (opcode == CBC_PUSH_NUMBER_0)
+          if (opcode != CBC_PUSH_NUMBER_0)
           {
-            *number_p = 0;
-          }
-          else
-          {
-            int value = *byte_code_p++;
+            value = *byte_code_p++;
 
             JERRY_ASSERT (opcode == CBC_PUSH_NUMBER_1);
 
@@ -973,13 +1302,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             {
               value = -(value - CBC_PUSH_NUMBER_1_RANGE_END);
             }
-            *number_p = (ecma_number_t) value;
           }
 
-          result = ecma_make_number_value (number_p);
+          result = ecma_make_integer_value (value);
           break;
         }
-        case VM_OC_PUSH_OBJECT:
+        VM_CASE (VM_OC_PUSH_OBJECT):
         {
           ecma_object_t *prototype_p = ecma_builtin_get (ECMA_BUILTIN_ID_OBJECT_PROTOTYPE);
           ecma_object_t *obj_p = ecma_create_object (prototype_p,
@@ -989,7 +1317,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_deref_object (prototype_p);
           break;
         }
-        case VM_OC_SET_PROPERTY:
+        VM_CASE (VM_OC_SET_PROPERTY):
         {
           ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-1]);
           ecma_string_t *prop_name_p;
@@ -1036,8 +1364,27 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_SET_GETTER:
-        case VM_OC_SET_SETTER:
+        VM_CASE (VM_OC_SET_NEW_PROPERTY):
+        {
+          ecma_object_t *object_p = ecma_get_object_from_value (stack_top_p[-1]);
+          uint32_t property_count = 0;
+
+          if (opcode == CBC_SET_FIRST_PROPERTY)
+          {
+            property_count = *byte_code_p++;
+          }
+
+          JERRY_ASSERT (ecma_is_value_string (right_value));
+
+          ecma_property_t *property_p = ecma_create_object_literal_property (object_p,
+                                                                             ecma_get_string_from_value (right_value),
+                                                                             property_count);
+
+          ecma_named_data_property_assign_value (object_p, property_p, left_value);
+          break;
+        }
+        VM_CASE (VM_OC_SET_GETTER):
+        VM_CASE (VM_OC_SET_SETTER):
         {
           opfunc_set_accessor (VM_OC_GROUP_GET_INDEX (opcode_data) == VM_OC_SET_GETTER ? true : false,
                                stack_top_p[-1],
@@ -1045,7 +1392,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
                                right_value);
           break;
         }
-        case VM_OC_PUSH_ARRAY:
+        VM_CASE (VM_OC_PUSH_ARRAY):
         {
           last_completion_value = ecma_op_create_array_object (NULL, 0, false);
 
@@ -1056,17 +1403,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_PUSH_ELISON:
+        VM_CASE (VM_OC_PUSH_ELISON):
         {
           result = ecma_make_simple_value (ECMA_SIMPLE_VALUE_ARRAY_HOLE);
           break;
         }
-        case VM_OC_APPEND_ARRAY:
+        VM_CASE (VM_OC_APPEND_ARRAY):
         {
           ecma_object_t *array_obj_p;
           ecma_string_t *length_str_p;
           ecma_property_t *length_prop_p;
-          ecma_number_t *length_num_p;
           ecma_property_descriptor_t prop_desc;
 
           prop_desc = ecma_make_empty_property_descriptor ();
@@ -1090,40 +1436,44 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (length_prop_p != NULL);
 
           left_value = ecma_get_named_data_property_value (length_prop_p);
-          length_num_p = ecma_get_number_from_value (left_value);
-
-          ecma_deref_ecma_string (length_str_p);
+          uint32_t old_length = (uint32_t) ecma_get_number_from_value (left_value);
 
           for (uint32_t i = 0; i < right_value; i++)
           {
             if (!ecma_is_value_array_hole (stack_top_p[i]))
             {
-              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 ((uint32_t) *length_num_p);
+              ecma_string_t *index_str_p = ecma_new_ecma_string_from_uint32 (old_length + i);
 
               prop_desc.value = stack_top_p[i];
 
-              ecma_op_general_object_define_own_property (array_obj_p,
-                                                          index_str_p,
-                                                          &prop_desc,
-                                                          false);
+              /* The elements are stored in the fast element storage of the array (if it has one). */
+              ecma_op_object_define_own_property (array_obj_p,
+                                                  index_str_p,
+                                                  &prop_desc,
+                                                  false);
 
               ecma_deref_ecma_string (index_str_p);
 
               ecma_free_value (stack_top_p[i]);
             }
-
-            (*length_num_p)++;
           }
 
+          /* The trailing holes of the literal are counted in the length as well. */
+          length_prop_p = ecma_get_named_property (array_obj_p, length_str_p);
+          left_value = ecma_make_normalized_number_value ((ecma_number_t) (old_length + right_value));
+          ecma_named_data_property_assign_value (array_obj_p, length_prop_p, left_value);
+          ecma_free_value (left_value);
+
+          ecma_deref_ecma_string (length_str_p);
           break;
         }
-        case VM_OC_PUSH_UNDEFINED_BASE:
+        VM_CASE (VM_OC_PUSH_UNDEFINED_BASE):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_make_simple_value (ECMA_SIMPLE_VALUE_UNDEFINED);
           break;
         }
-        case VM_OC_IDENT_REFERENCE:
+        VM_CASE (VM_OC_IDENT_REFERENCE):
         {
           uint16_t literal_index;
 
@@ -1142,8 +1492,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
             ecma_object_t *ref_base_lex_env_p;
 
-            ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
-                                                                 name_p);
+            ref_base_lex_env_p = vm_resolve_identifier_base (frame_ctx_p->lex_env_p,
+                                                             ident_depths_p,
+                                                             (uint32_t) (literal_index - register_end),
+                                                             name_p);
 
             if (ref_base_lex_env_p != NULL)
             {
@@ -1170,7 +1522,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_PROP_REFERENCE:
+        VM_CASE (VM_OC_PROP_REFERENCE):
         {
           /* Forms with reference requires preserving the base and offset. */
 
@@ -1195,15 +1547,16 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_PROP_GET:
-        case VM_OC_PROP_PRE_INCR:
-        case VM_OC_PROP_PRE_DECR:
-        case VM_OC_PROP_POST_INCR:
-        case VM_OC_PROP_POST_DECR:
+        VM_CASE (VM_OC_PROP_GET):
+        VM_CASE (VM_OC_PROP_PRE_INCR):
+        VM_CASE (VM_OC_PROP_PRE_DECR):
+        VM_CASE (VM_OC_PROP_POST_INCR):
+        VM_CASE (VM_OC_PROP_POST_DECR):
         {
           last_completion_value = vm_op_get_value (left_value,
                                                    right_value,
-                                                   is_strict);
+                                                   is_strict,
+                                                   byte_code_start_p);
 
           if (ecma_is_value_error (last_completion_value))
           {
@@ -1222,30 +1575,37 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = VM_FREE_LEFT_VALUE;
           /* FALLTHRU */
         }
-        case VM_OC_PRE_INCR:
-        case VM_OC_PRE_DECR:
-        case VM_OC_POST_INCR:
-        case VM_OC_POST_DECR:
+        VM_CASE (VM_OC_PRE_INCR):
+        VM_CASE (VM_OC_PRE_DECR):
+        VM_CASE (VM_OC_POST_INCR):
+        VM_CASE (VM_OC_POST_DECR):
         {
           uint32_t base = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_PROP_PRE_INCR;
-          ecma_number_t increase = ECMA_NUMBER_ONE;
-          ecma_number_t *result_p;
+          ecma_integer_value_t increase = 1;
 
-          last_completion_value = ecma_op_to_number (left_value);
-
-          if (ecma_is_value_error (last_completion_value))
+          if (ecma_is_value_integer_number (left_value))
           {
-            goto error;
+            /* Small integers are numbers already, and they need no copy. */
+            result = left_value;
+          }
+          else
+          {
+            last_completion_value = ecma_op_to_number (left_value);
+
+            if (ecma_is_value_error (last_completion_value))
+            {
+              goto error;
+            }
+
+            result = last_completion_value;
           }
 
           byte_code_p = byte_code_start_p + 1;
-          result = last_completion_value;
-          result_p = ecma_get_number_from_value (result);
 
           if (base & 0x2)
           {
             /* For decrement operators */
-            increase = ECMA_NUMBER_MINUS_ONE;
+            increase = -1;
           }
 
           /* Post operators require the unmodifed number value. */
@@ -1283,23 +1643,40 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             }
           }
 
-          *result_p = ecma_number_add (*result_p, increase);
+          if (ecma_is_value_integer_number (result))
+          {
+            ecma_integer_value_t int_value = ecma_get_integer_from_value (result) + increase;
+
+            if (likely (ECMA_IS_INTEGER_NUMBER (int_value)))
+            {
+              result = ecma_make_integer_value (int_value);
+            }
+            else
+            {
+              result = ecma_make_normalized_number_value ((ecma_number_t) int_value);
+            }
+          }
+          else
+          {
+            ecma_number_t *result_p = ecma_get_float_from_value (result);
+            *result_p = ecma_number_add (*result_p, (ecma_number_t) increase);
+          }
           break;
         }
-        case VM_OC_ASSIGN:
+        VM_CASE (VM_OC_ASSIGN):
         {
           result = left_value;
           free_flags = 0;
           break;
         }
-        case VM_OC_ASSIGN_PROP:
+        VM_CASE (VM_OC_ASSIGN_PROP):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = left_value;
           free_flags = 0;
           break;
         }
-        case VM_OC_ASSIGN_PROP_THIS:
+        VM_CASE (VM_OC_ASSIGN_PROP_THIS):
         {
           result = stack_top_p[-1];
           stack_top_p[-1] = ecma_copy_value (frame_ctx_p->this_binding);
@@ -1307,7 +1684,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = 0;
           break;
         }
-        case VM_OC_RET:
+        VM_CASE (VM_OC_RET):
         {
           JERRY_ASSERT (opcode == CBC_RETURN
                         || opcode == CBC_RETURN_WITH_BLOCK
@@ -1323,24 +1700,24 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           free_flags = 0;
           goto error;
         }
-        case VM_OC_THROW:
+        VM_CASE (VM_OC_THROW):
         {
           last_completion_value = ecma_make_error_value (left_value);
           free_flags = 0;
           goto error;
         }
-        case VM_OC_THROW_REFERENCE_ERROR:
+        VM_CASE (VM_OC_THROW_REFERENCE_ERROR):
         {
           last_completion_value = ecma_raise_reference_error (ECMA_ERR_MSG (""));
           goto error;
         }
-        case VM_OC_EVAL:
+        VM_CASE (VM_OC_EVAL):
         {
           is_direct_eval_form_call = true;
           JERRY_ASSERT (*byte_code_p >= CBC_CALL && *byte_code_p <= CBC_CALL2_PROP_BLOCK);
           continue;
         }
-        case VM_OC_CALL:
+        VM_CASE (VM_OC_CALL):
         {
           JERRY_ASSERT (free_flags == 0);
 
@@ -1372,7 +1749,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_NEW:
+        VM_CASE (VM_OC_NEW):
         {
           JERRY_ASSERT (free_flags == 0);
 
@@ -1398,7 +1775,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_PROP_DELETE:
+        VM_CASE (VM_OC_PROP_DELETE):
         {
           last_completion_value = vm_op_delete_prop (left_value, right_value, is_strict);
 
@@ -1410,7 +1787,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_DELETE:
+        VM_CASE (VM_OC_DELETE):
         {
           uint16_t literal_index;
 
@@ -1434,12 +1811,12 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_JUMP:
+        VM_CASE (VM_OC_JUMP):
         {
           byte_code_p = byte_code_start_p + branch_offset;
           break;
         }
-        case VM_OC_BRANCH_IF_STRICT_EQUAL:
+        VM_CASE (VM_OC_BRANCH_IF_STRICT_EQUAL):
         {
           JERRY_ASSERT (stack_top_p > frame_ctx_p->registers_p + register_end);
 
@@ -1460,10 +1837,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_BRANCH_IF_TRUE:
-        case VM_OC_BRANCH_IF_FALSE:
-        case VM_OC_BRANCH_IF_LOGICAL_TRUE:
-        case VM_OC_BRANCH_IF_LOGICAL_FALSE:
+        VM_CASE (VM_OC_BRANCH_IF_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_FALSE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_TRUE):
+        VM_CASE (VM_OC_BRANCH_IF_LOGICAL_FALSE):
         {
           uint32_t base = VM_OC_GROUP_GET_INDEX (opcode_data) - VM_OC_BRANCH_IF_TRUE;
 
@@ -1487,7 +1864,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           break;
         }
-        case VM_OC_PLUS:
+        VM_CASE (VM_OC_PLUS):
         {
           last_completion_value = opfunc_unary_plus (left_value);
 
@@ -1499,7 +1876,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MINUS:
+        VM_CASE (VM_OC_MINUS):
         {
           last_completion_value = opfunc_unary_minus (left_value);
 
@@ -1511,7 +1888,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_NOT:
+        VM_CASE (VM_OC_NOT):
         {
           last_completion_value = opfunc_logical_not (left_value);
 
@@ -1523,7 +1900,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_NOT:
+        VM_CASE (VM_OC_BIT_NOT):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_NOT,
                                                            left_value,
@@ -1537,7 +1914,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_TYPEOF_IDENT:
+        VM_CASE (VM_OC_TYPEOF_IDENT):
         {
           uint16_t literal_index;
 
@@ -1553,8 +1930,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           else
           {
             ecma_string_t *name_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
-            ecma_object_t *ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
-                                                                                name_p);
+            ecma_object_t *ref_base_lex_env_p = vm_resolve_identifier_base (frame_ctx_p->lex_env_p,
+                                                                            ident_depths_p,
+                                                                            (uint32_t) (literal_index - register_end),
+                                                                            name_p);
 
             if (ref_base_lex_env_p == NULL)
             {
@@ -1581,7 +1960,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           }
           /* FALLTHRU */
         }
-        case VM_OC_TYPEOF:
+        VM_CASE (VM_OC_TYPEOF):
         {
           last_completion_value = opfunc_typeof (left_value);
 
@@ -1593,8 +1972,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_ADD:
+        VM_CASE (VM_OC_ADD):
         {
+          vm_quicken_binary_opcode (bytecode_header_p, byte_code_start_p, CBC_ADD, CBC_ADD_NUMBER, CBC_ADD_STRING,
+                                    left_value, right_value);
+
           last_completion_value = opfunc_addition (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1605,8 +1987,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_SUB:
+        VM_CASE (VM_OC_SUB):
         {
+          vm_quicken_binary_opcode (bytecode_header_p, byte_code_start_p, CBC_SUBTRACT, CBC_SUBTRACT_NUMBER, CBC_END,
+                                    left_value, right_value);
+
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION,
                                                         left_value,
                                                         right_value);
@@ -1619,7 +2004,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MUL:
+        VM_CASE (VM_OC_MUL):
         {
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_MULTIPLICATION,
                                                         left_value,
@@ -1633,7 +2018,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_DIV:
+        VM_CASE (VM_OC_DIV):
         {
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_DIVISION,
                                                         left_value,
@@ -1647,7 +2032,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_MOD:
+        VM_CASE (VM_OC_MOD):
         {
           last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_REMAINDER,
                                                         left_value,
@@ -1661,7 +2046,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_EQUAL:
+        VM_CASE (VM_OC_EQUAL):
         {
           last_completion_value = opfunc_equal_value (left_value, right_value);
 
@@ -1673,7 +2058,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_NOT_EQUAL:
+        VM_CASE (VM_OC_NOT_EQUAL):
         {
           last_completion_value = opfunc_not_equal_value (left_value, right_value);
 
@@ -1685,7 +2070,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_STRICT_EQUAL:
+        VM_CASE (VM_OC_STRICT_EQUAL):
         {
           last_completion_value = opfunc_equal_value_type (left_value, right_value);
 
@@ -1697,7 +2082,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_STRICT_NOT_EQUAL:
+        VM_CASE (VM_OC_STRICT_NOT_EQUAL):
         {
           last_completion_value = opfunc_not_equal_value_type (left_value, right_value);
 
@@ -1709,7 +2094,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_OR:
+        VM_CASE (VM_OC_BIT_OR):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_OR,
                                                            left_value,
@@ -1723,7 +2108,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_XOR:
+        VM_CASE (VM_OC_BIT_XOR):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_XOR,
                                                            left_value,
@@ -1737,7 +2122,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_BIT_AND:
+        VM_CASE (VM_OC_BIT_AND):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_LOGIC_AND,
                                                            left_value,
@@ -1751,7 +2136,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LEFT_SHIFT:
+        VM_CASE (VM_OC_LEFT_SHIFT):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_LEFT,
                                                            left_value,
@@ -1765,7 +2150,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_RIGHT_SHIFT:
+        VM_CASE (VM_OC_RIGHT_SHIFT):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_RIGHT,
                                                            left_value,
@@ -1779,7 +2164,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_UNS_RIGHT_SHIFT:
+        VM_CASE (VM_OC_UNS_RIGHT_SHIFT):
         {
           last_completion_value = do_number_bitwise_logic (NUMBER_BITWISE_SHIFT_URIGHT,
                                                            left_value,
@@ -1793,8 +2178,152 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LESS:
+        VM_CASE (VM_OC_ADD_NUMBER):
+        {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = ecma_make_int32_value (ecma_get_integer_from_value (left_value)
+                                            + ecma_get_integer_from_value (right_value));
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            result = ecma_make_normalized_number_value (ecma_number_add (left_number, right_number));
+            break;
+          }
+
+          vm_deoptimize_binary_opcode (byte_code_start_p, CBC_ADD_NUMBER, CBC_ADD);
+          last_completion_value = opfunc_addition (left_value, right_value);
+
+          if (ecma_is_value_error (last_completion_value))
+          {
+            goto error;
+          }
+
+          result = last_completion_value;
+          break;
+        }
+        VM_CASE (VM_OC_ADD_STRING):
+        {
+          if (ecma_is_value_string (left_value) && ecma_is_value_string (right_value))
+          {
+            ecma_string_t *concat_str_p = ecma_concat_ecma_strings (ecma_get_string_from_value (left_value),
+                                                                    ecma_get_string_from_value (right_value));
+            result = ecma_make_string_value (concat_str_p);
+            break;
+          }
+
+          vm_deoptimize_binary_opcode (byte_code_start_p, CBC_ADD_STRING, CBC_ADD);
+          last_completion_value = opfunc_addition (left_value, right_value);
+
+          if (ecma_is_value_error (last_completion_value))
+          {
+            goto error;
+          }
+
+          result = last_completion_value;
+          break;
+        }
+        VM_CASE (VM_OC_SUB_NUMBER):
+        {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            result = ecma_make_int32_value (ecma_get_integer_from_value (left_value)
+                                            - ecma_get_integer_from_value (right_value));
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            ecma_number_t left_number = ecma_get_number_from_value (left_value);
+            ecma_number_t right_number = ecma_get_number_from_value (right_value);
+
+            result = ecma_make_normalized_number_value (ecma_number_substract (left_number, right_number));
+            break;
+          }
+
+          vm_deoptimize_binary_opcode (byte_code_start_p, CBC_SUBTRACT_NUMBER, CBC_SUBTRACT);
+          last_completion_value = do_number_arithmetic (NUMBER_ARITHMETIC_SUBSTRACTION,
+                                                        left_value,
+                                                        right_value);
+
+          if (ecma_is_value_error (last_completion_value))
+          {
+            goto error;
+          }
+
+          result = last_completion_value;
+          break;
+        }
+        VM_CASE (VM_OC_LESS_NUMBER):
+        {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) < ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            /* Comparisons with NaN are always false. */
+            bool is_true = ecma_get_number_from_value (left_value) < ecma_get_number_from_value (right_value);
+
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          vm_deoptimize_binary_opcode (byte_code_start_p, CBC_LESS_NUMBER, CBC_LESS);
+          last_completion_value = opfunc_less_than (left_value, right_value);
+
+          if (ecma_is_value_error (last_completion_value))
+          {
+            goto error;
+          }
+
+          result = last_completion_value;
+          break;
+        }
+        VM_CASE (VM_OC_GREATER_NUMBER):
+        {
+          if (ecma_are_values_integer_numbers (left_value, right_value))
+          {
+            bool is_true = ecma_get_integer_from_value (left_value) > ecma_get_integer_from_value (right_value);
+
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          if (ecma_is_value_number (left_value) && ecma_is_value_number (right_value))
+          {
+            /* Comparisons with NaN are always false. */
+            bool is_true = ecma_get_number_from_value (left_value) > ecma_get_number_from_value (right_value);
+
+            result = ecma_make_simple_value (is_true ? ECMA_SIMPLE_VALUE_TRUE : ECMA_SIMPLE_VALUE_FALSE);
+            break;
+          }
+
+          vm_deoptimize_binary_opcode (byte_code_start_p, CBC_GREATER_NUMBER, CBC_GREATER);
+          last_completion_value = opfunc_greater_than (left_value, right_value);
+
+          if (ecma_is_value_error (last_completion_value))
+          {
+            goto error;
+          }
+
+          result = last_completion_value;
+          break;
+        }
+        VM_CASE (VM_OC_LESS):
         {
+          vm_quicken_binary_opcode (bytecode_header_p, byte_code_start_p, CBC_LESS, CBC_LESS_NUMBER, CBC_END,
+                                    left_value, right_value);
+
           last_completion_value = opfunc_less_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1805,8 +2334,11 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_GREATER:
+        VM_CASE (VM_OC_GREATER):
         {
+          vm_quicken_binary_opcode (bytecode_header_p, byte_code_start_p, CBC_GREATER, CBC_GREATER_NUMBER, CBC_END,
+                                    left_value, right_value);
+
           last_completion_value = opfunc_greater_than (left_value, right_value);
 
           if (ecma_is_value_error (last_completion_value))
@@ -1817,7 +2349,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_LESS_EQUAL:
+        VM_CASE (VM_OC_LESS_EQUAL):
         {
           last_completion_value = opfunc_less_or_equal_than (left_value, right_value);
 
@@ -1829,7 +2361,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_GREATER_EQUAL:
+        VM_CASE (VM_OC_GREATER_EQUAL):
         {
           last_completion_value = opfunc_greater_or_equal_than (left_value, right_value);
 
@@ -1841,7 +2373,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_IN:
+        VM_CASE (VM_OC_IN):
         {
           last_completion_value = opfunc_in (left_value, right_value);
 
@@ -1853,7 +2385,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_INSTANCEOF:
+        VM_CASE (VM_OC_INSTANCEOF):
         {
           last_completion_value = opfunc_instanceof (left_value, right_value);
 
@@ -1865,7 +2397,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           result = last_completion_value;
           break;
         }
-        case VM_OC_WITH:
+        VM_CASE (VM_OC_WITH):
         {
           ecma_object_t *object_p;
           ecma_object_t *with_env_p;
@@ -1898,7 +2430,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           frame_ctx_p->lex_env_p = with_env_p;
           break;
         }
-        case VM_OC_FOR_IN_CREATE_CONTEXT:
+        VM_CASE (VM_OC_FOR_IN_CREATE_CONTEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -1922,7 +2454,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_dealloc_collection_header (header_p);
           break;
         }
-        case VM_OC_FOR_IN_GET_NEXT:
+        VM_CASE (VM_OC_FOR_IN_GET_NEXT):
         {
           ecma_value_t *context_top_p = frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth;
           ecma_collection_chunk_t *chunk_p = MEM_CP_GET_NON_NULL_POINTER (ecma_collection_chunk_t, context_top_p[-2]);
@@ -1936,7 +2468,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           ecma_dealloc_collection_chunk (chunk_p);
           break;
         }
-        case VM_OC_FOR_IN_HAS_NEXT:
+        VM_CASE (VM_OC_FOR_IN_HAS_NEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -1972,7 +2504,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
 
           break;
         }
-        case VM_OC_TRY:
+        VM_CASE (VM_OC_TRY):
         {
           /* Try opcode simply creates the try context. */
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
@@ -1985,7 +2517,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-1] = (ecma_value_t) VM_CREATE_CONTEXT (VM_CONTEXT_TRY, branch_offset);
           break;
         }
-        case VM_OC_CATCH:
+        VM_CASE (VM_OC_CATCH):
         {
           /* Catches are ignored and turned to jumps. */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
@@ -1994,7 +2526,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           byte_code_p = byte_code_start_p + branch_offset;
           break;
         }
-        case VM_OC_FINALLY:
+        VM_CASE (VM_OC_FINALLY):
         {
           branch_offset += (int32_t) (byte_code_start_p - frame_ctx_p->byte_code_start_p);
 
@@ -2013,7 +2545,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           stack_top_p[-2] = (ecma_value_t) branch_offset;
           break;
         }
-        case VM_OC_CONTEXT_END:
+        VM_CASE (VM_OC_CONTEXT_END):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2069,7 +2601,7 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
           break;
         }
-        case VM_OC_JUMP_AND_EXIT_CONTEXT:
+        VM_CASE (VM_OC_JUMP_AND_EXIT_CONTEXT):
         {
           JERRY_ASSERT (frame_ctx_p->registers_p + register_end + frame_ctx_p->context_depth == stack_top_p);
 
@@ -2124,8 +2656,10 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             ecma_object_t *ref_base_lex_env_p;
 
             var_name_str_p = ecma_new_ecma_string_from_lit_cp (literal_start_p[literal_index]);
-            ref_base_lex_env_p = ecma_op_resolve_reference_base (frame_ctx_p->lex_env_p,
-                                                                 var_name_str_p);
+            ref_base_lex_env_p = vm_resolve_identifier_base (frame_ctx_p->lex_env_p,
+                                                             ident_depths_p,
+                                                             (uint32_t) (literal_index - register_end),
+                                                             var_name_str_p);
 
             last_completion_value = ecma_op_put_value_lex_env_base (ref_base_lex_env_p,
                                                                     var_name_str_p,
@@ -2167,7 +2701,8 @@ vm_loop (vm_frame_ctx_t *frame_ctx_p) /**< frame context */
             last_completion_value = vm_op_set_value (object,
                                                      property,
                                                      result,
-                                                     is_strict);
+                                                     is_strict,
+                                                     byte_code_start_p);
 
             ecma_free_value (object);
             ecma_free_value (property);
@@ -59,6 +59,9 @@ typedef enum
 
 /**
  * Opcodes.
+ *
+ * Note:
+ *      the handler address table of vm_loop lists the groups in the same order
  */
 typedef enum
 {
@@ -76,6 +79,7 @@ typedef enum
   VM_OC_PUSH_NUMBER,             /**< push number */
   VM_OC_PUSH_OBJECT,             /**< push object */
   VM_OC_SET_PROPERTY,            /**< set property */
+  VM_OC_SET_NEW_PROPERTY,        /**< set property, which is not defined yet */
   VM_OC_SET_GETTER,              /**< set getter */
   VM_OC_SET_SETTER,              /**< set setter */
   VM_OC_PUSH_UNDEFINED_BASE,     /**< push undefined base */
@@ -152,6 +156,12 @@ typedef enum
   VM_OC_RIGHT_SHIFT,             /**< right shift */
   VM_OC_UNS_RIGHT_SHIFT,         /**< unsigned right shift */
 
+  VM_OC_ADD_NUMBER,              /**< binary add of numbers */
+  VM_OC_ADD_STRING,              /**< binary add of strings */
+  VM_OC_SUB_NUMBER,              /**< binary sub of numbers */
+  VM_OC_LESS_NUMBER,             /**< less of numbers */
+  VM_OC_GREATER_NUMBER,          /**< greater of numbers */
+
   VM_OC_WITH,                    /**< with */
   VM_OC_FOR_IN_CREATE_CONTEXT,   /**< for in create context */
   VM_OC_FOR_IN_GET_NEXT,         /**< get next */
@@ -25,6 +25,7 @@
 #include <stdio.h>
 #include <stdlib.h>
 #include <string.h>
+#include <sys/mman.h>
 #include <sys/syscall.h>
 #include <sys/types.h>
 #include <sys/stat.h>
@@ -332,6 +333,19 @@ gettimeofday (void *tp,  /**< struct timeval */
   return (int) syscall_2 (SYSCALL_NO (gettimeofday), (long int) tp, (long int) tzp);
 } /* gettimeofday */
 
+/**
+ * Give advice about use of memory.
+ *
+ * @return 0 if success, -1 otherwise
+ */
+int
+madvise (void *addr, /**< start of the memory range */
+         size_t length, /**< length of the memory range */
+         int advice) /**< advice */
+{
+  return (syscall_3 (SYSCALL_NO (madvise), (long int) addr, (long int) length, advice) == 0) ? 0 : -1;
+} /* madvise */
+
 // FIXME
 #if 0
 /**
@@ -0,0 +1,42 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+/*
+ * Loops over local variables of functions which also create closures.
+ *
+ * Only the variables referenced by the closures are bound in the lexical environment.
+ */
+
+function accumulate (n)
+{
+  var sum = 0;
+  var get = function () { return sum; };
+
+  for (var i = 0; i < n; i++)
+  {
+    var doubled = i * 2;
+    sum = sum + doubled - i;
+  }
+
+  return get ();
+}
+
+var result = 0;
+
+for (var round = 0; round < 30; round++)
+{
+  result += accumulate (100000);
+}
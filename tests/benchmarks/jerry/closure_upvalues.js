@@ -0,0 +1,58 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/*
+ * Nested closures which read and write the variables of their enclosing functions.
+ *
+ * The lexical environment depth of each variable is known when the functions are parsed.
+ */
+
+function counter (step)
+{
+  var count = 0;
+  var total = 0;
+
+  function level1 ()
+  {
+    var scale = 2;
+
+    function level2 ()
+    {
+      count = count + step;
+      total = total + count * scale;
+    }
+
+    return level2;
+  }
+
+  var increment = level1 ();
+
+  return function (n)
+  {
+    for (var i = 0; i < n; i++)
+    {
+      increment ();
+    }
+
+    return total;
+  };
+}
+
+var result = 0;
+
+for (var round = 0; round < 20; round++)
+{
+  result += counter (round) (20000);
+}
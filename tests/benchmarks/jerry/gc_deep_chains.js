@@ -0,0 +1,47 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/* Long-living linked list, each node referencing a newer one */
+var list = {};
+var tail = list;
+
+for (var i = 0; i < 3000; i++)
+{
+  tail.next = {};
+  tail = tail.next;
+}
+
+/* Long-living chain of closures, each referencing the scope of an older one */
+function make_closure (prev)
+{
+  return function () { return prev; };
+}
+
+var closure = null;
+
+for (var i = 0; i < 1000; i++)
+{
+  closure = make_closure (closure);
+}
+
+/* Garbage, which triggers garbage collection while the chains are alive */
+for (var i = 0; i < 200; i++)
+{
+  var obj = {};
+
+  for (var k = 0; k < 200; k++)
+  {
+    obj = { prop: obj };
+  }
+}
@@ -0,0 +1,78 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+/*
+ * Latency of short requests, which produce garbage, while many objects are alive.
+ *
+ * Pauses of the garbage collector show up in the high percentiles of the request latency,
+ * which are printed by engines built with DATE_SYS_CALLS=ON (e.g. to compare INCREMENTAL_GC=ON and OFF builds).
+ */
+
+var live = [];
+
+for (var i = 0; i < 1000; i++)
+{
+  live.push ({ a: {}, b: {}, c: {}, d: [] });
+}
+
+function request ()
+{
+  var obj = {};
+
+  for (var k = 0; k < 100; k++)
+  {
+    obj = { prop: obj, index: k };
+  }
+
+  return obj;
+}
+
+/* Histogram of the request latencies in milliseconds */
+var histogram = [];
+var requests = 2000;
+
+for (var i = 0; i < requests; i++)
+{
+  var start = Date.now ();
+
+  request ();
+
+  var latency = Date.now () - start;
+  histogram[latency] = (histogram[latency] || 0) + 1;
+}
+
+function percentile (p)
+{
+  var count = 0;
+
+  for (var latency = 0; latency < histogram.length; latency++)
+  {
+    count += histogram[latency] || 0;
+
+    if (count * 100 >= requests * p)
+    {
+      return latency;
+    }
+  }
+}
+
+if (typeof print === "function")
+{
+  print ("request latency (ms):",
+         "p50 = " + percentile (50),
+         "p90 = " + percentile (90),
+         "p99 = " + percentile (99),
+         "p99.9 = " + percentile (99.9),
+         "max = " + (histogram.length - 1));
+}
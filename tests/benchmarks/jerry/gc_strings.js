@@ -0,0 +1,39 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/*
+ * Few objects, which keep large strings alive, become garbage.
+ *
+ * Garbage collection should be started according to the size of the garbage, not the number of objects.
+ */
+
+var live = [];
+
+for (var i = 0; i < 2000; i++)
+{
+  live.push ({ index: i });
+}
+
+var text = "";
+
+for (var i = 0; i < 64; i++)
+{
+  text += "0123456789abcdef";
+}
+
+for (var i = 0; i < 20000; i++)
+{
+  var holder = { text: text + i };
+}
@@ -0,0 +1,38 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/*
+ * Reads of many global variables and built-in functions.
+ *
+ * The names are looked up on the global object and the built-in objects, so the lookups
+ * should be served by the property lookup cache, without evicting each other.
+ */
+
+var g0 = 0, g1 = 1, g2 = 2, g3 = 3, g4 = 4, g5 = 5, g6 = 6, g7 = 7, g8 = 8, g9 = 9;
+var h0 = 0, h1 = 1, h2 = 2, h3 = 3, h4 = 4, h5 = 5, h6 = 6, h7 = 7, h8 = 8, h9 = 9;
+
+function sum ()
+{
+  return (Math.max (g0, g1, g2, g3, g4) + Math.min (g5, g6, g7, g8, g9)
+          + h0 + h1 + h2 + h3 + h4 + h5 + h6 + h7 + h8 + h9);
+}
+
+var result = 0;
+
+for (var i = 0; i < 30000; i++)
+{
+  result += sum ();
+  result += String.fromCharCode (65).length + parseInt ("1") + isNaN (i);
+}
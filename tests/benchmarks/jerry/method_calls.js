@@ -0,0 +1,65 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+/*
+ * Method calls on instances: the methods are inherited from user defined
+ * and built-in prototypes, and some lookups miss on the whole chain.
+ */
+
+function Shape (x, y)
+{
+  this.x = x;
+  this.y = y;
+}
+
+Shape.prototype.area = function () { return 0; };
+Shape.prototype.move = function (dx, dy) { this.x += dx; this.y += dy; };
+
+function Rect (x, y, w, h)
+{
+  Shape.call (this, x, y);
+  this.w = w;
+  this.h = h;
+}
+
+Rect.prototype = Object.create (Shape.prototype);
+Rect.prototype.area = function () { return this.w * this.h; };
+
+var shapes = [];
+
+for (var i = 0; i < 20; i++)
+{
+  shapes.push (i % 2 ? new Rect (i, i, i, 2) : new Shape (i, i));
+}
+
+var total = 0;
+var tagged = 0;
+
+for (var round = 0; round < 5000; round++)
+{
+  for (var i = 0; i < shapes.length; i++)
+  {
+    var shape = shapes[i];
+
+    shape.move (1, 1);
+    total += shape.area ();
+
+    if (shape.tag !== undefined || shape.hasOwnProperty ("tag"))
+    {
+      tagged++;
+    }
+  }
+}
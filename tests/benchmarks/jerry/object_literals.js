@@ -0,0 +1,40 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/*
+ * Construction of JSON-like configuration objects with object literals.
+ */
+
+function createConfig (i)
+{
+  return {
+    name: "server",
+    host: "localhost",
+    port: 8000 + i,
+    secure: (i & 1) === 0,
+    timeout: 30,
+    retries: 3,
+    logging: { level: "info", file: "server.log", rotate: true },
+    limits: { connections: 100, requests: 1000, payload: 65536 }
+  };
+}
+
+var sum = 0;
+
+for (var i = 0; i < 100000; i++)
+{
+  var config = createConfig (i);
+  sum += config.port + config.limits.connections;
+}
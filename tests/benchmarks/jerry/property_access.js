@@ -0,0 +1,49 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/*
+ * Reads and writes of own and inherited properties of objects, which are built the same way.
+ *
+ * The property access instructions see the same shapes again and again, so they should be
+ * served by their inline caches.
+ */
+
+function Vector (x, y, z)
+{
+  this.x = x;
+  this.y = y;
+  this.z = z;
+}
+
+Vector.prototype.scale = 2;
+
+var vectors = [];
+
+for (var i = 0; i < 16; i++)
+{
+  vectors.push (new Vector (i, i + 1, i + 2));
+}
+
+var sum = 0;
+
+for (var i = 0; i < 100000; i++)
+{
+  var v = vectors[i & 15];
+
+  sum += (v.x + v.y + v.z) * v.scale;
+  v.x = v.y;
+  v.y = v.z;
+  v.z = v.x + 1;
+}
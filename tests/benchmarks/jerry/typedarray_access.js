@@ -0,0 +1,57 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+
+/*
+ * Numeric workload on typed arrays: filling, reading and updating elements by index.
+ *
+ * The elements are stored in the data blocks of ArrayBuffers.
+ */
+
+var size = 2000;
+var primes = new Int32Array (size);
+var prime_count = 0;
+var sieve = new Uint8Array (size);
+
+for (var i = 2; i < size; i++)
+{
+  if (sieve[i] === 0)
+  {
+    primes[prime_count++] = i;
+
+    for (var j = i * i; j < size; j += i)
+    {
+      sieve[j] = 1;
+    }
+  }
+}
+
+var values = new Float64Array (500);
+
+for (var i = 0; i < 500; i++)
+{
+  values[i] = i % 7;
+}
+
+var sum = 0;
+
+for (var round = 0; round < 200; round++)
+{
+  for (var i = 0; i < 500; i++)
+  {
+    sum += values[i];
+    values[i] = (values[i] + primes[i % prime_count]) % 11;
+  }
+}
@@ -0,0 +1,203 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (obj)
+{
+  var result = [];
+  for (var name in obj)
+  {
+    result.push (name);
+  }
+  return result.join ();
+}
+
+// Growing dense arrays
+var a = [];
+for (var i = 0; i < 100; i++)
+{
+  a[i] = i * 2;
+}
+assert (a.length === 100);
+assert (a[0] === 0 && a[50] === 100 && a[99] === 198);
+assert (a[100] === undefined);
+
+a.push ("x", { y: 1 });
+assert (a.length === 102);
+assert (a[100] === "x" && a[101].y === 1);
+
+// Holes
+var b = [1, , 3, , ];
+assert (b.length === 4);
+assert (b.hasOwnProperty (0) && !b.hasOwnProperty (1) && b.hasOwnProperty (2) && !b.hasOwnProperty (3));
+assert (keys (b) === "0,2");
+assert (Object.keys (b).join () === "0,2");
+
+var c = new Array (10);
+assert (c.length === 10 && !c.hasOwnProperty (5));
+c[3] = "three";
+assert (c[3] === "three" && c.length === 10);
+assert (keys (c) === "3");
+
+// Deleting elements
+var d = [1, 2, 3, 4];
+assert (delete d[1]);
+assert (d[1] === undefined && d.length === 4 && !(1 in d));
+assert (keys (d) === "0,2,3");
+d[1] = 5;
+assert (d[1] === 5 && keys (d) === "0,1,2,3");
+
+// Element names and other names are enumerated in the expected order
+var e = [10, 20];
+e.name = "e";
+e[2] = 30;
+assert (keys (e) === "0,1,2,name");
+
+// Truncating and extending the length
+var f = [];
+for (var i = 0; i < 64; i++)
+{
+  f.push (i);
+}
+f.length = 3;
+assert (f.length === 3 && f[2] === 2 && f[3] === undefined && !f.hasOwnProperty (10));
+assert (keys (f) === "0,1,2");
+f.length = 10;
+assert (f.length === 10 && f[9] === undefined && keys (f) === "0,1,2");
+f[5] = 5;
+assert (keys (f) === "0,1,2,5");
+f.length = 0;
+assert (keys (f) === "" && f[0] === undefined);
+
+// Elements far above the other elements (sparse arrays)
+var g = [1, 2, 3];
+g[100000] = 4;
+assert (g.length === 100001);
+assert (g[0] === 1 && g[2] === 3 && g[100000] === 4 && g[50000] === undefined);
+assert (keys (g) === "0,1,2,100000");
+g.length = 2;
+assert (keys (g) === "0,1" && g.length === 2);
+
+var h = [];
+h[4294967294] = "last";
+assert (h.length === 4294967295 && h[4294967294] === "last");
+
+// Elements with non-default attributes
+var j = [1, 2, 3];
+Object.defineProperty (j, 1, { writable: false });
+j[1] = 20;
+assert (j[1] === 2);
+j[0] = 10;
+assert (j[0] === 10);
+assert (keys (j) === "0,1,2");
+
+var k = [1, 2, 3];
+Object.defineProperty (k, 3, { value: 4 });
+assert (k.length === 4 && k[3] === 4);
+assert (keys (k) === "0,1,2");
+assert (!Object.getOwnPropertyDescriptor (k, 3).writable);
+
+var l = [1, 2, 3];
+Object.defineProperty (l, 1, { get: function () { return "getter"; }, configurable: true });
+assert (l[1] === "getter" && l[0] === 1 && l[2] === 3);
+delete l[1];
+assert (l[1] === undefined);
+
+var m = [1, 2, 3];
+Object.defineProperty (m, 0, { value: "zero", writable: true, enumerable: true, configurable: true });
+assert (m[0] === "zero");
+var desc = Object.getOwnPropertyDescriptor (m, 2);
+assert (desc.value === 3 && desc.writable && desc.enumerable && desc.configurable);
+
+// Non-configurable elements stop the truncation
+var n = [1, 2, 3, 4];
+Object.defineProperty (n, 1, { configurable: false });
+n.length = 0;
+assert (n.length === 2 && n[0] === 1 && n[1] === 2);
+
+// Frozen and non-extensible arrays
+var o = [1, 2, 3];
+Object.freeze (o);
+o[0] = 5;
+o[3] = 6;
+assert (o[0] === 1 && o[3] === undefined && o.length === 3);
+assert (Object.isFrozen (o));
+
+var p = [1, 2];
+Object.preventExtensions (p);
+p[0] = 3;
+p[2] = 4;
+assert (p[0] === 3 && p[2] === undefined && p.length === 2);
+
+try
+{
+  "use strict";
+  (function () { "use strict"; p[5] = 1; }) ();
+  assert (false);
+}
+catch (ex)
+{
+  assert (ex instanceof TypeError);
+}
+
+// Elements inherited from an array prototype
+var proto = [ "a", "b" ];
+var child = Object.create (proto);
+child[2] = "c";
+assert (child[0] === "a" && child[1] === "b" && child[2] === "c");
+assert (keys (child) === "2,0,1");
+
+// Array methods
+var q = [5, 1, 4, 2, 3];
+q.sort ();
+assert (q.join () === "1,2,3,4,5");
+q.reverse ();
+assert (q.join () === "5,4,3,2,1");
+assert (q.splice (1, 2).join () === "4,3");
+assert (q.join () === "5,2,1");
+q.unshift (7, 8);
+assert (q.join () === "7,8,5,2,1");
+assert (q.shift () === 7 && q.pop () === 1);
+assert (q.join () === "8,5,2");
+assert (q.concat ([1, , 3]).length === 6);
+assert (q.indexOf (2) === 2 && q.slice (1).join () === "5,2");
+
+while (q.length > 0)
+{
+  q.pop ();
+}
+assert (q.length === 0 && keys (q) === "");
+
+// Values of elements are kept alive and updated
+var r = [];
+for (var i = 0; i < 200; i++)
+{
+  r.push ({ value: i }, "str" + i, i + 0.5);
+}
+for (var i = 0; i < 200; i++)
+{
+  assert (r[i * 3].value === i && r[i * 3 + 1] === "str" + i && r[i * 3 + 2] === i + 0.5);
+}
+
+// Index names, which are not numbers in the string
+var s = [1, 2, 3];
+assert (s["1"] === 2);
+s["2"] = "two";
+assert (s[2] === "two");
+s["01"] = "not an index";
+assert (s[1] === 2 && s.length === 3 && s["01"] === "not an index");
+assert (keys (s) === "0,1,2,01");
+
+// JSON reviver deletes elements
+var t = JSON.parse ("[1, 2, 3]", function (key, value) { return (value === 2) ? undefined : value; });
+assert (t.length === 3 && t[0] === 1 && !(1 in t) && t[2] === 3);
@@ -0,0 +1,109 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function check_descriptor (obj, name, value, writable, enumerable, configurable)
+{
+  var desc = Object.getOwnPropertyDescriptor (obj, name);
+
+  assert (desc !== undefined);
+  assert (desc.writable === writable);
+  assert (desc.enumerable === enumerable);
+  assert (desc.configurable === configurable);
+
+  if (value !== value)
+  {
+    assert (desc.value !== desc.value);
+  }
+  else
+  {
+    assert (desc.value === value);
+  }
+}
+
+/* Number values */
+check_descriptor (Math, "PI", 3.141592653589793, false, false, false);
+check_descriptor (Math, "SQRT1_2", Math.sqrt (0.5), false, false, false);
+check_descriptor (Number, "MAX_VALUE", 1.7976931348623157e+308, false, false, false);
+check_descriptor (Number, "MIN_VALUE", 5e-324, false, false, false);
+check_descriptor (Number, "POSITIVE_INFINITY", Infinity, false, false, false);
+check_descriptor (Number, "NEGATIVE_INFINITY", -Infinity, false, false, false);
+check_descriptor (Number, "NaN", NaN, false, false, false);
+check_descriptor (this, "NaN", NaN, false, false, false);
+check_descriptor (this, "Infinity", Infinity, false, false, false);
+check_descriptor (Array, "length", 1, false, false, false);
+
+/* Simple, string and object values */
+check_descriptor (this, "undefined", undefined, false, false, false);
+check_descriptor (Error.prototype, "message", "", true, false, true);
+check_descriptor (TypeError.prototype, "name", "TypeError", true, false, true);
+check_descriptor (Object, "prototype", Object.prototype, false, false, false);
+check_descriptor (Object.prototype, "constructor", Object, true, false, true);
+check_descriptor (this, "Math", Math, true, false, true);
+
+/* Routines */
+var desc = Object.getOwnPropertyDescriptor (Array.prototype, "push");
+assert (typeof desc.value === "function");
+assert (desc.value.length === 1);
+assert (desc.writable && !desc.enumerable && desc.configurable);
+assert (Array.prototype.push === desc.value);
+
+/* Properties, which are not accessed yet, are listed */
+var names = Object.getOwnPropertyNames (Math);
+assert (names.indexOf ("LOG10E") !== -1);
+assert (names.indexOf ("atan2") !== -1);
+assert (names.length === 26);
+
+/* Deleted properties are not instantiated again */
+assert (delete Math.atan2);
+assert (Math.atan2 === undefined);
+assert (Object.getOwnPropertyNames (Math).indexOf ("atan2") === -1);
+
+/* Modified properties keep their new values */
+Math.max = 5;
+assert (Math.max === 5);
+String.prototype.trim = undefined;
+assert (" a ".trim === undefined);
+
+/* Constant properties are read from the descriptor lists until they are redefined */
+var math_object = Object.create (Math);
+assert (math_object.PI === 3.141592653589793);
+assert (math_object.E === 2.718281828459045);
+assert (math_object.PI === 3.141592653589793);
+assert (Number.MAX_VALUE + Math.LN2 === 1.7976931348623157e+308);
+assert (Math.min.length === 2 && Math.abs.length === 1);
+assert (Object.getPrototypeOf (Array.prototype) === Object.prototype);
+
+assert (!delete Math.SQRT2);
+assert (Math.SQRT2 === Math.sqrt (2));
+
+Object.defineProperty (Math, "LN10", { value: Math.LN10 });
+check_descriptor (Math, "LN10", 2.302585092994046, false, false, false);
+
+try
+{
+  Object.defineProperty (Math.round, "length", { value: 2 });
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof TypeError);
+}
+
+assert (Math.round.length === 1);
+
+Object.freeze (Number);
+assert (Object.isFrozen (Number));
+assert (Number.MIN_VALUE === 5e-324);
+assert (Object.getOwnPropertyNames (Math).indexOf ("LN10") !== -1);
@@ -0,0 +1,117 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* The same instruction is executed with changing operand types. */
+
+function add (a, b)
+{
+  return a + b;
+}
+
+function sub (a, b)
+{
+  return a - b;
+}
+
+function less (a, b)
+{
+  return a < b;
+}
+
+function greater (a, b)
+{
+  return a > b;
+}
+
+for (var i = 0; i < 3; i++)
+{
+  assert (add (1, 2) === 3);
+  assert (add (0.5, 0.25) === 0.75);
+  assert (add (134217727, 1) === 134217728);
+  assert (add ("a", "b") === "ab");
+  assert (add ("a", 1) === "a1");
+  assert (add (1, "a") === "1a");
+  assert (add (true, 1) === 2);
+  assert (add ({ valueOf: function () { return 5; } }, 1) === 6);
+  assert (add (-134217728, -1) === -134217729);
+  assert (isNaN (add (NaN, 1)));
+
+  assert (sub (5, 7) === -2);
+  assert (sub (0.5, 0.25) === 0.25);
+  assert (1 / sub (-0, 0) === -Infinity);
+  assert (sub (-134217728, 1) === -134217729);
+  assert (sub ("5", 2) === 3);
+  assert (isNaN (sub ("a", 2)));
+  assert (sub (3, 1) === 2);
+
+  assert (less (1, 2) === true);
+  assert (less (2, 1) === false);
+  assert (less (0.5, 1) === true);
+  assert (less (NaN, 1) === false);
+  assert (less (1, NaN) === false);
+  assert (less ("a", "b") === true);
+  assert (less ("10", "9") === true);
+  assert (less ("10", 9) === false);
+  assert (less (-0, 0) === false);
+
+  assert (greater (2, 1) === true);
+  assert (greater (1, 2) === false);
+  assert (greater (1.5, 1) === true);
+  assert (greater (NaN, NaN) === false);
+  assert (greater ("b", "a") === true);
+  assert (greater ("9", "10") === true);
+  assert (greater (9, "10") === false);
+}
+
+/* Literal operand forms. */
+var x = 5;
+var s = "";
+for (var i = 0; i < 4; i++)
+{
+  assert (x + 1 === ((typeof x === "string") ? "51" : 6));
+  assert (x - 1 === 4);
+  assert (x < 6);
+  assert (10 > x);
+  s = s + "x";
+  x = (i === 1) ? "5" : 5;
+}
+assert (s === "xxxx");
+
+/* Compound assignments share the generic implementation. */
+var c = 1;
+for (var i = 0; i < 3; i++)
+{
+  c += 1;
+  c -= 0.5;
+}
+assert (c === 2.5);
+c += "a";
+assert (c === "2.5a");
+
+/* Exceptions thrown by the generic path of a specialized instruction. */
+var thrower = { valueOf: function () { throw "valueOf"; } };
+for (var i = 0; i < 2; i++)
+{
+  add (1, 2);
+  try
+  {
+    add (thrower, 1);
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e === "valueOf");
+  }
+}
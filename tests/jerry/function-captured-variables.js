@@ -0,0 +1,226 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Variables captured by nested functions. */
+
+function counter ()
+{
+  var count = 0;
+  var step = 1;
+  var unused = 5;
+
+  unused++;
+  return function () { count += step; return count; };
+}
+
+var next = counter ();
+assert (next () === 1);
+assert (next () === 2);
+
+/* Captured variable declared after the nested function. */
+function declared_later ()
+{
+  var get = function () { return value; };
+  var value = 42;
+  return get ();
+}
+
+assert (declared_later () === 42);
+
+/* Captured arguments. */
+function capture_argument (a, b)
+{
+  var f = function () { return a * 10 + b; };
+  a = 3;
+  return f ();
+}
+
+assert (capture_argument (1, 2) === 32);
+
+/* Captured through an intermediate function which does not use the variable. */
+function outer ()
+{
+  var deep = "outer";
+
+  function middle ()
+  {
+    return function () { return deep; };
+  }
+
+  deep = "changed";
+  return middle () ();
+}
+
+assert (outer () === "changed");
+
+/* Identifiers with escape sequences. */
+function escaped ()
+{
+  var abc = 1;
+  var f = function () { return ab\u0063 + \u0064ef; };
+  var def = 1;
+  return f () + abc;
+}
+
+assert (escaped () === 3);
+
+/* Function declarations which are not captured. */
+function local_functions (n)
+{
+  function square (x)
+  {
+    return x * x;
+  }
+
+  var sum = 0;
+  for (var i = 0; i < n; i++)
+  {
+    sum += square (i);
+  }
+
+  assert (typeof helper === "function");
+  return sum + helper ();
+
+  function helper ()
+  {
+    return 100;
+  }
+}
+
+assert (local_functions (4) === 114);
+assert (local_functions (4) === 114);
+
+/* Recursive function declaration. */
+function recursive_local (n)
+{
+  function fact (k)
+  {
+    return k <= 1 ? 1 : k * fact (k - 1);
+  }
+
+  return fact (n);
+}
+
+assert (recursive_local (5) === 120);
+
+/* Redeclared function and a var with the same name. */
+function redeclared ()
+{
+  var r1 = f ();
+  function f () { return 1; }
+  var f = 5;
+  function f () { return 2; }
+  return r1 + f;
+}
+
+assert (redeclared () === 7);
+
+/* Direct eval in a nested function can access every variable. */
+function nested_eval ()
+{
+  var x = 1;
+  var y = 2;
+
+  function inner ()
+  {
+    return eval ("x + y");
+  }
+
+  return inner ();
+}
+
+assert (nested_eval () === 3);
+
+function deeply_nested_eval ()
+{
+  var x = 5;
+
+  return (function () { return (function () { return eval ("x"); }) (); }) ();
+}
+
+assert (deeply_nested_eval () === 5);
+
+/* The arguments object of the enclosing function is not shared. */
+function arguments_object (a)
+{
+  var f = function () { return arguments.length; };
+  return f (1, 2, 3) + a;
+}
+
+assert (arguments_object (10) === 13);
+
+/* Catch parameter captured by a nested function. */
+function capture_catch ()
+{
+  try
+  {
+    throw 7;
+  }
+  catch (e)
+  {
+    return function () { return e; };
+  }
+}
+
+assert (capture_catch () () === 7);
+
+/* Nested function inside a with statement. */
+function capture_with ()
+{
+  var v = "local";
+  var o = { w: "with" };
+  with (o)
+  {
+    return function () { return v + w; };
+  }
+}
+
+assert (capture_with () () === "localwith");
+
+/* Accessors capturing variables. */
+function accessors ()
+{
+  var stored = 1;
+  var o = {
+    get value () { return stored; },
+    set value (v) { stored = v; }
+  };
+  o.value = 9;
+  return stored;
+}
+
+assert (accessors () === 9);
+
+/* Every call creates a new binding for the captured variables. */
+function make_adder (n)
+{
+  return function (x) { return x + n; };
+}
+
+var add2 = make_adder (2);
+var add3 = make_adder (3);
+assert (add2 (1) === 3);
+assert (add3 (1) === 4);
+
+/* Syntax errors after captured identifiers are propagated. */
+try
+{
+  eval ("function f () { var a; function g () { return a + \\u0062 + c; } ) }");
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof SyntaxError);
+}
@@ -0,0 +1,154 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+/* Identifiers of enclosing functions. */
+function outer ()
+{
+  var a = 1;
+
+  function mid (c)
+  {
+    var b = 2;
+
+    function inner ()
+    {
+      a += 10;
+      b += 20;
+      return a + b + c;
+    }
+
+    return inner;
+  }
+
+  var f = mid (3);
+  assert (f () === 36);
+  assert (f () === 66);
+  assert (a === 21);
+  return typeof a;
+}
+
+assert (outer () === "number");
+
+/* Shadowing by an intermediate function. */
+function shadow ()
+{
+  var x = "outer";
+
+  function mid ()
+  {
+    var x = "mid";
+    return function () { return x; };
+  }
+
+  function named ()
+  {
+    return (function x () { return typeof x; }) ();
+  }
+
+  return mid () () + ":" + named () + ":" + (function () { return x; }) ();
+}
+
+assert (shadow () === "mid:function:outer");
+
+/* Closures created in a loop share the variable. */
+function loop ()
+{
+  var funcs = [];
+  var sum = 0;
+
+  for (var i = 0; i < 5; i++)
+  {
+    funcs.push (function () { sum += i; });
+  }
+
+  for (var j = 0; j < funcs.length; j++)
+  {
+    funcs[j] ();
+  }
+
+  return sum;
+}
+
+assert (loop () === 25);
+
+/* Scopes which are changed at run time are searched. */
+function dynamic ()
+{
+  var v = "local";
+  var results = [];
+
+  try
+  {
+    throw "caught";
+  }
+  catch (v)
+  {
+    results.push ((function () { return v; }) ());
+  }
+
+  with ({ v: "with" })
+  {
+    results.push ((function () { return v; }) ());
+  }
+
+  results.push ((function () { return v; }) ());
+
+  (function () { eval ("var v = 'eval'"); results.push ((function () { return v; }) ()); }) ();
+
+  (function () { results.push (arguments.length + v); }) ();
+
+  return results.join (",");
+}
+
+assert (dynamic () === "caught,with,local,eval,0local");
+
+/* Global variables and unresolvable references. */
+var global_value = 5;
+
+function globals ()
+{
+  var local = 1;
+
+  return function ()
+  {
+    try
+    {
+      undefined_variable;
+      assert (false);
+    }
+    catch (e)
+    {
+      assert (e instanceof ReferenceError);
+    }
+
+    assert (typeof undefined_variable === "undefined");
+    return global_value + local;
+  };
+}
+
+assert (globals () () === 6);
+
+/* Recursive calls of named function expressions have deeper scope chains. */
+function named ()
+{
+  var v = "named";
+
+  return (function recurse (n)
+  {
+    return n ? recurse (n - 1) : v + (function () { return v; }) ();
+  }) (3);
+}
+
+assert (named () === "namednamed");
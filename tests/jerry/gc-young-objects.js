@@ -0,0 +1,47 @@
+// Copyright 2016 Samsung Electronics Co., Ltd.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Old objects, which reference young objects, only through properties, accessors, closures and bound functions
+var holder = { items: [] };
+var accessors = {};
+
+function make_getter (value)
+{
+  return function () { return value; };
+}
+
+for (var i = 0; i < 20000; i++)
+{
+  var garbage = { index: i, next: { index: i } };
+
+  if (i % 1000 === 0)
+  {
+    holder.items.push ({ index: i });
+    holder.last = { index: i };
+
+    Object.defineProperty (accessors, "p" + i, { get: make_getter ({ index: i }) });
+    holder.bound = function (obj) { return obj.index; }.bind (null, { index: i });
+  }
+}
+
+assert (holder.items.length === 20);
+
+for (var i = 0; i < 20; i++)
+{
+  assert (holder.items[i].index === i * 1000);
+  assert (accessors["p" + i * 1000].index === i * 1000);
+}
+
+assert (holder.last.index === 19000);
+assert (holder.bound () === 19000);
@@ -0,0 +1,131 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function getX (obj)
+{
+  return obj.x;
+}
+
+function setX (obj, value)
+{
+  obj.x = value;
+}
+
+// Objects with different shapes at the same instruction
+var objects = [ { x: 1 }, { y: 2, x: 3 }, { z: 4 }, { x: 5, y: 6, z: 7 } ];
+var expected = [ 1, 3, undefined, 5 ];
+
+for (var i = 0; i < 20; i++)
+{
+  for (var j = 0; j < objects.length; j++)
+  {
+    assert (getX (objects[j]) === expected[j]);
+  }
+}
+
+// Attributes are not part of the shape
+var a = { x: 1 };
+var b = { x: 2 };
+assert (getX (a) === 1);
+assert (getX (b) === 2);
+
+Object.defineProperty (b, "x", { get: function () { return 20; } });
+assert (getX (a) === 1);
+assert (getX (b) === 20);
+
+var c = { x: 1 };
+setX (c, 2);
+assert (c.x === 2);
+Object.defineProperty (c, "x", { writable: false });
+setX (c, 3);
+assert (c.x === 2);
+
+var d = { x: 1 };
+setX (d, 4);
+Object.freeze (d);
+setX (d, 5);
+assert (d.x === 4);
+
+// Inherited properties
+function Point (x)
+{
+  this.y = x;
+}
+Point.prototype.x = "proto";
+
+var p1 = new Point (1);
+var p2 = new Point (2);
+assert (getX (p1) === "proto");
+assert (getX (p2) === "proto");
+
+Point.prototype.x = "changed";
+assert (getX (p1) === "changed");
+
+Point.prototype.other = 1;
+assert (getX (p2) === "changed");
+
+Object.defineProperty (Point.prototype, "x", { get: function () { return "getter"; } });
+assert (getX (p1) === "getter");
+
+// Writing an inherited property creates an own property
+var proto = { x: 1 };
+var child = Object.create (proto);
+assert (getX (child) === 1);
+setX (child, 2);
+assert (getX (child) === 2);
+assert (proto.x === 1);
+
+// Setters of the prototype must be called
+var setterValue;
+var protoWithSetter = {};
+Object.defineProperty (protoWithSetter, "x", { set: function (v) { setterValue = v; }, get: function () { return 7; } });
+var child2 = Object.create (protoWithSetter);
+setX (child2, 6);
+assert (setterValue === 6);
+assert (getX (child2) === 7);
+assert (!child2.hasOwnProperty ("x"));
+
+// Changing the prototype
+var protoA = { x: "a" };
+var protoB = { x: "b" };
+var fromA = Object.create (protoA);
+var fromB = Object.create (protoB);
+assert (getX (fromA) === "a");
+assert (getX (fromB) === "b");
+assert (getX (fromA) === "a");
+
+// Own property shadows the cached inherited property
+var shadow = Object.create (protoA);
+assert (getX (shadow) === "a");
+shadow.x = "own";
+assert (getX (shadow) === "own");
+
+// Deleted properties
+var e = { x: 1, y: 2 };
+assert (getX (e) === 1);
+delete e.x;
+assert (getX (e) === undefined);
+setX (e, 3);
+assert (getX (e) === 3);
+
+// Computed property names
+var names = [ "x", "y", "x", "z" ];
+var f = { x: 1, y: 2, z: 3 };
+var sum = 0;
+for (var i = 0; i < names.length; i++)
+{
+  sum += f[names[i]];
+  f[names[i]] = 0;
+}
+assert (sum === 1 + 2 + 0 + 3);
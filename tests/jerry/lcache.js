@@ -0,0 +1,70 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Many global variables, which share the rows of the cache
+for (var i = 0; i < 300; i++)
+{
+  this["global_" + i] = i;
+}
+
+for (var k = 0; k < 3; k++)
+{
+  for (var i = 0; i < 300; i++)
+  {
+    assert (this["global_" + i] === i);
+  }
+}
+
+// Names, which are created at run-time
+var obj = {};
+for (var i = 0; i < 64; i++)
+{
+  obj["name" + i] = i;
+}
+delete obj.name0;
+
+for (var i = 0; i < 64; i++)
+{
+  var name = "name" + i;
+  assert (obj[name] === (i === 0 ? undefined : i));
+  assert (obj[name] === (i === 0 ? undefined : i));
+}
+
+obj.name0 = "new";
+assert (obj["name" + 0] === "new");
+
+// Missing properties become present
+var missing = {};
+for (var i = 0; i < 3; i++)
+{
+  assert (missing.prop === undefined);
+  assert (missing["pr" + "op"] === undefined);
+}
+missing.prop = 1;
+assert (missing.prop === 1);
+assert (missing["pr" + "op"] === 1);
+
+// Objects, whose memory may be reused after they are freed
+for (var k = 0; k < 200; k++)
+{
+  var temp = [];
+  temp["key" + k] = k;
+  assert (temp["key" + k] === k);
+  assert (temp.other === undefined);
+  temp = null;
+
+  var next = [];
+  assert (next["key" + k] === undefined);
+  assert (next.other === undefined);
+}
@@ -0,0 +1,112 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+// Small integers (the limits of the direct encoding are -2^27 and 2^27 - 1)
+var max = 134217727;
+var min = -134217728;
+
+assert (max + 1 === 134217728);
+assert (min - 1 === -134217729);
+assert (max + max === 268435454);
+assert (min + min === -268435456);
+assert (max - min === 268435455);
+assert (max * 2 === 268435454);
+assert (max * 4 === 536870908);
+assert ((max + 1) * (max + 1) === 18014398509481984);
+assert (min * -1 === 134217728);
+
+var i = max;
+i++;
+assert (i === 134217728);
+i--;
+assert (i === max);
+--i;
+assert (i === 134217726);
+
+var j = min;
+j--;
+assert (j === -134217729);
+++j;
+assert (j === min);
+
+var k = 0.5;
+k++;
+assert (k === 1.5);
+
+// Negative zero is not a small integer
+assert (1 / (0 * -1) === -Infinity);
+assert (1 / (-5 * 0) === -Infinity);
+assert (1 / (0 * 5) === Infinity);
+assert (1 / -(0) === -Infinity);
+assert (1 / (-1 % 1) === -Infinity);
+assert (1 / (1 % 1) === Infinity);
+var z = -1;
+z++;
+assert (1 / z === Infinity);
+
+// Division and remainder
+assert (7 / 2 === 3.5);
+assert (6 / 3 === 2);
+assert (isNaN (0 / 0));
+assert (7 % 3 === 1);
+assert (-7 % 3 === -1);
+assert (7 % -3 === 1);
+assert (isNaN (7 % 0));
+
+// Bitwise operators
+assert ((max | 0) === max);
+assert ((min & -1) === min);
+assert ((5 ^ 3) === 6);
+assert (~min === max);
+assert ((1 << 30) === 1073741824);
+assert ((1 << 31) === -2147483648);
+assert ((max << 4) === 2147483632);
+assert ((min >> 3) === -16777216);
+assert ((-1 >>> 0) === 4294967295);
+assert ((min >>> 28) === 15);
+
+// Relational operators
+assert (min < max);
+assert (!(max < min));
+assert (max > max - 1);
+assert (max >= max);
+assert (min <= min);
+assert (max < max + 1);
+assert (min - 1 < min);
+
+// Equality of small integers and heap numbers
+assert (max + 1 - 1 === max);
+assert (0.5 * 2 === 1);
+assert (Math.sqrt (16) === 4);
+assert (parseInt ("12") == 12);
+
+// Conversions
+assert (+"42" === 42);
+assert (+true === 1);
+assert (+null === 0);
+assert (isNaN (+undefined));
+assert (-"7" === -7);
+assert (typeof 5 === "number");
+assert (String (min) === "-134217728");
+assert ((max + 1).toString () === "134217728");
+assert (JSON.stringify ([1, -2, max, min - 1]) === "[1,-2,134217727,-134217729]");
+
+// Array lengths and indices
+var arr = [1, 2, 3, , ];
+assert (arr.length === 4);
+arr[max] = 1;
+assert (arr.length === 134217728);
+assert ("abcabc".indexOf ("c", 3) === 5);
+assert (/b/.exec ("aab").index === 2);
@@ -0,0 +1,118 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+var count = 2000;
+var map = {};
+
+for (var i = 0; i < count; i++)
+{
+  assert (map["key" + i] === undefined);
+  map["key" + i] = i;
+}
+
+for (var i = 0; i < count; i++)
+{
+  assert (map["key" + i] === i);
+  assert (map.hasOwnProperty ("key" + i));
+}
+assert (map.key2000 === undefined);
+
+// Enumeration order is the insertion order
+var names = Object.keys (map);
+assert (names.length === count);
+for (var i = 0; i < count; i++)
+{
+  assert (names[i] === "key" + i);
+}
+
+// Deleting most of the properties
+for (var i = 0; i < count; i++)
+{
+  if (i % 10 != 0)
+  {
+    assert (delete map["key" + i]);
+  }
+}
+
+for (var i = 0; i < count; i++)
+{
+  assert (map["key" + i] === ((i % 10 != 0) ? undefined : i));
+}
+
+names = Object.keys (map);
+assert (names.length === count / 10);
+for (var i = 0; i < names.length; i++)
+{
+  assert (names[i] === "key" + (i * 10));
+}
+
+// Inserting and deleting repeatedly
+for (var i = 0; i < count; i++)
+{
+  map["tmp" + i] = i;
+  assert (map["tmp" + i] === i);
+  assert (delete map["tmp" + i]);
+  assert (map["tmp" + i] === undefined);
+}
+
+names = Object.keys (map);
+assert (names.length === count / 10);
+
+map.last = "last";
+names = Object.keys (map);
+assert (names[names.length - 1] === "last");
+
+// Accessors and attributes in large objects
+var obj = {};
+for (var i = 0; i < 100; i++)
+{
+  Object.defineProperty (obj, "p" + i, { value: i, writable: false, enumerable: (i % 2 == 0), configurable: true });
+}
+Object.defineProperty (obj, "acc", { get: function () { return this.p10 * 2; }, enumerable: true });
+
+assert (obj.acc === 20);
+obj.p10 = 5;
+assert (obj.p10 === 10);
+assert (Object.keys (obj).length === 51);
+assert (Object.getOwnPropertyNames (obj).length === 101);
+
+var keys = [];
+for (var name in obj)
+{
+  keys.push (name);
+}
+assert (keys.length === 51);
+assert (keys[0] === "p0" && keys[1] === "p2" && keys[50] === "acc");
+
+// Large objects with numeric names
+var nums = {};
+for (var i = 0; i < 100; i++)
+{
+  nums[i * 3] = i;
+}
+for (var i = 0; i < 100; i++)
+{
+  assert (nums[i * 3] === i);
+  assert (nums[i * 3 + 1] === undefined);
+}
+
+// Global variables
+for (var i = 0; i < 100; i++)
+{
+  this["global" + i] = i;
+}
+assert (global50 === 50);
+assert (delete this.global50);
+assert (typeof global50 === "undefined");
+assert (global99 === 99);
@@ -0,0 +1,125 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function keys (obj)
+{
+  var result = [];
+  for (var name in obj)
+  {
+    result.push (name);
+  }
+  return result.join ();
+}
+
+// Properties are created in the order of the items
+var a = 7;
+var o = { x: 1, y: "two", z: a, w: { inner: true } };
+assert (keys (o) === "x,y,z,w");
+assert (o.x === 1 && o.y === "two" && o.z === 7 && o.w.inner === true);
+assert (o.hasOwnProperty ("x") && o.hasOwnProperty ("w"));
+
+var desc = Object.getOwnPropertyDescriptor (o, "y");
+assert (desc.writable && desc.enumerable && desc.configurable);
+
+// Repeated names (the same name may be written in different forms)
+var d = { a: 1, "\x61": 2, 'a': 3, b: 4, a: 5 };
+assert (keys (d) === "a,b");
+assert (d.a === 5 && d.b === 4);
+
+// Number names are converted to strings
+var n1 = { 1: "a", "1": "b", 1.0: "c" };
+assert (keys (n1) === "1" && n1[1] === "c");
+
+var n2 = { "1": "a", 1: "b", x: "c" };
+assert (keys (n2) === "1,x" && n2[1] === "b" && n2.x === "c");
+
+var n3 = { 0.5: "a", "0.5": "b", 5e-1: "c" };
+assert (keys (n3) === "0.5" && n3[0.5] === "c");
+
+// Accessors
+var g = { get v () { return 10; }, set v (value) { this.w = value; }, u: 1 };
+assert (g.v === 10 && g.u === 1);
+g.v = 20;
+assert (g.w === 20);
+
+try
+{
+  eval ("({ x: 1, get x () { return 2; } })");
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof SyntaxError);
+}
+
+try
+{
+  eval ("'use strict'; ({ x: 1, x: 2 })");
+  assert (false);
+}
+catch (e)
+{
+  assert (e instanceof SyntaxError);
+}
+
+// Values are evaluated in order, and an exception stops the construction
+var log = [];
+try
+{
+  var t = { p: log.push ("p"), q: (function () { throw "q"; }) (), r: log.push ("r") };
+  assert (false);
+}
+catch (e)
+{
+  assert (e === "q");
+}
+assert (log.join () === "p");
+
+// Large literals
+for (var count = 10; count <= 300; count += 145)
+{
+  var src = "({";
+  for (var i = 0; i < count; i++)
+  {
+    src += "k" + i + ": " + i + ", ";
+  }
+  src += "})";
+
+  var big = eval (src);
+  var expected = 0;
+  for (var name in big)
+  {
+    assert (name === "k" + expected && big[name] === expected);
+    expected++;
+  }
+  assert (expected === count);
+
+  delete big.k3;
+  big.extra = "extra";
+  assert (!big.hasOwnProperty ("k3") && big.k4 === 4 && big.extra === "extra");
+}
+
+// Objects created by the same literal are independent
+function create (value)
+{
+  return { value: value, list: [value] };
+}
+
+var c1 = create (1);
+var c2 = create (2);
+c1.value = 10;
+c1.list.push (11);
+assert (c2.value === 2 && c2.list.length === 1);
+assert (c1.value === 10 && c1.list.length === 2);
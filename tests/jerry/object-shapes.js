@@ -0,0 +1,116 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+function keys (obj)
+{
+  var result = [];
+  for (var name in obj)
+  {
+    result.push (name);
+  }
+  return result.join (",");
+}
+
+// Objects built the same way
+var points = [];
+for (var i = 0; i < 10; i++)
+{
+  points.push ({ x: i, y: i * 2 });
+}
+
+for (var i = 0; i < 10; i++)
+{
+  assert (points[i].x === i);
+  assert (points[i].y === i * 2);
+  assert (points[i].z === undefined);
+  assert (keys (points[i]) === "x,y");
+}
+
+// Diverging shapes
+var a = { p: 1 };
+var b = { p: 2 };
+a.q = 3;
+b.r = 4;
+assert (keys (a) === "p,q");
+assert (keys (b) === "p,r");
+assert (a.r === undefined && b.q === undefined);
+
+// Deletion and addition in the original order
+var o = { a: 1, b: 2, c: 3 };
+assert (delete o.b);
+assert (o.b === undefined);
+assert (!o.hasOwnProperty ("b"));
+assert (keys (o) === "a,c");
+o.d = 4;
+assert (keys (o) === "a,c,d");
+o.b = 5;
+assert (keys (o) === "a,c,d,b");
+assert (o.a === 1 && o.b === 5 && o.c === 3 && o.d === 4);
+
+// Many properties
+var big = {};
+for (var i = 0; i < 100; i++)
+{
+  big["prop" + i] = i;
+}
+
+for (var i = 0; i < 100; i++)
+{
+  assert (big["prop" + i] === i);
+}
+assert (Object.keys (big).length === 100);
+assert (Object.keys (big)[99] === "prop99");
+
+// Many different properties added to the same shape
+var objs = [];
+for (var i = 0; i < 100; i++)
+{
+  var obj = { base: i };
+  obj["name" + i] = i;
+  objs.push (obj);
+}
+
+for (var i = 0; i < 100; i++)
+{
+  assert (objs[i].base === i);
+  assert (objs[i]["name" + i] === i);
+  assert (keys (objs[i]) === "base,name" + i);
+}
+
+// Accessors and attributes
+var acc = { v: 1 };
+Object.defineProperty (acc, "w", { get: function () { return this.v * 10; }, enumerable: true, configurable: true });
+Object.defineProperty (acc, "h", { value: 5, enumerable: false });
+assert (acc.w === 10);
+acc.v = 2;
+assert (acc.w === 20);
+assert (keys (acc) === "v,w");
+acc.h = 6;
+assert (acc.h === 5);
+
+Object.defineProperty (acc, "w", { value: 7 });
+assert (acc.w === 7);
+assert (keys (acc) === "v,w");
+
+// Frozen objects
+var frozen = Object.freeze ({ f: 1, g: 2 });
+frozen.f = 3;
+frozen.h = 4;
+assert (frozen.f === 1 && frozen.h === undefined);
+assert (Object.isFrozen (frozen));
+
+// Objects with internal properties
+var date = new Date (0);
+date.x = 1;
+assert (date.getTime () === 0 && date.x === 1);
@@ -0,0 +1,129 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+// Arrays
+var array = [1, 2, , 4];
+Array.prototype[2] = "inherited";
+assert (array[0] === 1 && array[2] === "inherited" && array[5] === undefined);
+delete Array.prototype[2];
+assert (array[2] === undefined);
+
+array[1] = "two";
+array[4] = 5;
+assert (array[1] === "two" && array[4] === 5 && array.length === 5);
+assert (array[-0] === 1 && array[1.5] === undefined && array["1"] === "two");
+
+var names = [];
+for (var name in array)
+{
+  names.push (array[name]);
+}
+assert (names.join () === "1,two,4,5");
+
+var frozen = Object.freeze ([1, 2]);
+frozen[0] = 10;
+assert (frozen[0] === 1);
+
+(function ()
+{
+  "use strict";
+
+  try
+  {
+    frozen[0] = 10;
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof TypeError);
+  }
+}) ();
+
+var sparse = [];
+sparse[1000000] = "far";
+sparse[1000000] = "farther";
+assert (sparse[1000000] === "farther" && sparse[0] === undefined);
+
+var accessor_array = [];
+var getter_calls = 0;
+Object.defineProperty (accessor_array, 0, { get: function () { getter_calls++; return 42; }, configurable: true });
+assert (accessor_array[0] === 42 && getter_calls === 1);
+
+// Objects
+var object = { 0: "zero", 7: "seven" };
+object[7] = "SEVEN";
+assert (object[0] === "zero" && object[7] === "SEVEN" && object[1] === undefined);
+
+Object.defineProperty (object, 3, { value: "fixed", writable: false });
+object[3] = "changed";
+assert (object[3] === "fixed");
+
+var proto = { 5: "from prototype" };
+var child = Object.create (proto);
+assert (child[5] === "from prototype");
+child[5] = "own";
+assert (child[5] === "own" && proto[5] === "from prototype");
+
+var setter_value;
+var setter_proto = {};
+Object.defineProperty (setter_proto, 1, { set: function (value) { setter_value = value; } });
+var with_setter = Object.create (setter_proto);
+with_setter[1] = "set";
+assert (setter_value === "set" && !with_setter.hasOwnProperty (1));
+
+// Arguments objects
+function mapped (a, b)
+{
+  arguments[0] = "changed";
+  b = "rebound";
+  return [a, arguments[0], arguments[1], arguments[2]];
+}
+
+var result = mapped (1, 2, 3);
+assert (result[0] === "changed" && result[1] === "changed" && result[2] === "rebound" && result[3] === 3);
+
+function unmapped ()
+{
+  var sum = 0;
+
+  for (var i = 0; i < arguments.length; i++)
+  {
+    arguments[i] *= 2;
+    sum += arguments[i];
+  }
+
+  return sum;
+}
+
+assert (unmapped (1, 2, 3) === 12);
+
+function strict_arguments (a)
+{
+  "use strict";
+  arguments[0] = "changed";
+  return a + arguments[0];
+}
+
+assert (strict_arguments ("a") === "achanged");
+
+// Strings
+var string = "abc";
+assert (string[0] === "a" && string[2] === "c" && string[3] === undefined);
+
+var string_object = new String ("xyz");
+assert (string_object[1] === "y" && string_object[5] === undefined);
+string_object[1] = "changed";
+assert (string_object[1] === "y");
+string_object[5] = "extra";
+assert (string_object[5] === "extra");
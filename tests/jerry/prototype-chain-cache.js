@@ -0,0 +1,93 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function Base () {}
+Base.prototype.value = function () { return "base"; };
+
+function Derived () {}
+Derived.prototype = new Base ();
+
+var obj = new Derived ();
+
+for (var i = 0; i < 3; i++)
+{
+  assert (obj.value () === "base");
+  assert (obj.missing === undefined);
+}
+
+/* Shadowing a property found on the chain */
+Derived.prototype.value = function () { return "derived"; };
+assert (obj.value () === "derived");
+
+/* Deleting the shadowing property */
+delete Derived.prototype.value;
+assert (obj.value () === "base");
+
+/* A missing property becomes available on the last object of the chain */
+Object.prototype.missing = 5;
+assert (obj.missing === 5);
+assert ("missing" in obj);
+
+delete Object.prototype.missing;
+assert (obj.missing === undefined);
+assert (!("missing" in obj));
+
+/* Changing the value or the type of a property found on the chain */
+Base.prototype.value = function () { return "changed"; };
+assert (obj.value () === "changed");
+
+Object.defineProperty (Base.prototype, "value", { get: function () { return function () { return "getter"; }; } });
+assert (obj.value () === "getter");
+
+/* Properties of the receiver are not cached */
+obj.value = function () { return "own"; };
+assert (obj.value () === "getter");
+
+Object.defineProperty (obj, "value", { value: function () { return "own"; } });
+assert (obj.value () === "own");
+
+var other = new Derived ();
+assert (other.value () === "getter");
+
+/* Built-in methods */
+var arr = [];
+for (var i = 0; i < 5; i++)
+{
+  arr.push (i);
+  assert (arr.toString () === arr.join (","));
+}
+
+Array.prototype.push = function () { return "replaced"; };
+assert (arr.push (1) === "replaced");
+assert (arr.length === 5);
+
+Object.prototype.join = function () { return "object join"; };
+delete Array.prototype.join;
+assert (arr.join () === "object join");
+
+/* Array index names are not cached, since they may be array elements */
+var proto = [1, 2, 3];
+var child = Object.create (proto);
+assert (child[1] === 2);
+proto[1] = 5;
+assert (child[1] === 5);
+proto.length = 1;
+assert (child[1] === undefined);
+assert (child["0"] === 1);
+
+/* Non-writable properties on the chain */
+var frozen = Object.create (Object.freeze ({ x: 1 }));
+frozen.x = 2;
+assert (frozen.x === 1);
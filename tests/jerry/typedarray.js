@@ -0,0 +1,161 @@
+// Copyright 2016 University of Szeged.
+//
+// Licensed under the Apache License, Version 2.0 (the "License");
+// you may not use this file except in compliance with the License.
+// You may obtain a copy of the License at
+//
+//     http://www.apache.org/licenses/LICENSE-2.0
+//
+// Unless required by applicable law or agreed to in writing, software
+// distributed under the License is distributed on an "AS IS" BASIS
+// WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+// See the License for the specific language governing permissions and
+// limitations under the License.
+
+
+function expect_error (func, error_type)
+{
+  try
+  {
+    func ();
+    assert (false);
+  }
+  catch (e)
+  {
+    assert (e instanceof error_type);
+  }
+}
+
+// ArrayBuffer
+var buffer = new ArrayBuffer (8);
+assert (buffer.byteLength === 8);
+assert (ArrayBuffer.isView (buffer) === false);
+assert (ArrayBuffer.isView (new Int8Array (2)) === true);
+assert (ArrayBuffer.isView (new DataView (buffer)) === true);
+assert (buffer.slice (2, -2).byteLength === 4);
+assert (buffer.slice (6, 2).byteLength === 0);
+assert (Object.getPrototypeOf (buffer) === ArrayBuffer.prototype);
+expect_error (function () { ArrayBuffer (8); }, TypeError);
+expect_error (function () { new ArrayBuffer (-1); }, RangeError);
+
+// Element types
+var int8 = new Int8Array (4);
+int8[0] = 127;
+int8[1] = 128;
+int8[2] = -129;
+int8[3] = 1.9;
+assert (int8[0] === 127 && int8[1] === -128 && int8[2] === 127 && int8[3] === 1);
+
+var uint8 = new Uint8Array ([-1, 256, 3.5, "7"]);
+assert (uint8.length === 4);
+assert (uint8[0] === 255 && uint8[1] === 0 && uint8[2] === 3 && uint8[3] === 7);
+
+var clamped = new Uint8ClampedArray ([-5, 300, 1.5, 2.5, NaN]);
+assert (clamped[0] === 0 && clamped[1] === 255 && clamped[2] === 2 && clamped[3] === 2 && clamped[4] === 0);
+
+var int16 = new Int16Array ([32768, -32769]);
+assert (int16[0] === -32768 && int16[1] === 32767);
+
+var uint16 = new Uint16Array ([-1]);
+assert (uint16[0] === 65535);
+
+var int32 = new Int32Array ([2147483648]);
+assert (int32[0] === -2147483648);
+
+var uint32 = new Uint32Array ([-1]);
+assert (uint32[0] === 4294967295);
+
+var float32 = new Float32Array ([0.1, Infinity]);
+assert (float32[0] !== 0.1 && Math.abs (float32[0] - 0.1) < 1e-7 && float32[1] === Infinity);
+
+var float64 = new Float64Array ([0.1, NaN]);
+assert (float64[0] === 0.1 && isNaN (float64[1]));
+
+assert (Int8Array.BYTES_PER_ELEMENT === 1 && Uint8ClampedArray.BYTES_PER_ELEMENT === 1);
+assert (Int16Array.prototype.BYTES_PER_ELEMENT === 2 && Float32Array.BYTES_PER_ELEMENT === 4);
+assert (Float64Array.BYTES_PER_ELEMENT === 8 && new Float64Array (1).BYTES_PER_ELEMENT === 8);
+assert (Int32Array.length === 3);
+expect_error (function () { Int32Array (4); }, TypeError);
+
+// Views sharing a buffer
+var shared = new ArrayBuffer (8);
+var bytes = new Uint8Array (shared);
+var words = new Uint16Array (shared, 2, 2);
+assert (words.buffer === shared && words.byteOffset === 2 && words.byteLength === 4 && words.length === 2);
+words[0] = 0x0101;
+assert (bytes[2] === 1 && bytes[3] === 1);
+expect_error (function () { new Uint16Array (shared, 1); }, RangeError);
+expect_error (function () { new Uint32Array (new ArrayBuffer (6)); }, RangeError);
+expect_error (function () { new Uint8Array (shared, 4, 5); }, RangeError);
+
+// Out of range elements and property names
+var small = new Int8Array (2);
+assert (small[2] === undefined && small[-1] === undefined);
+small[5] = 3;
+assert (small[5] === undefined && small.length === 2);
+small["1"] = 9;
+assert (small[1] === 9 && "1" in small && !("2" in small));
+small.foo = "bar";
+assert (small.foo === "bar");
+
+var names = [];
+for (var name in small)
+{
+  names.push (name);
+}
+assert (names.indexOf ("0") !== -1 && names.indexOf ("1") !== -1 && names.indexOf ("foo") !== -1);
+
+var descriptor = Object.getOwnPropertyDescriptor (small, 0);
+assert (descriptor.value === 0 && descriptor.writable && descriptor.enumerable && !descriptor.configurable);
+expect_error (function () { Object.defineProperty (small, 0, { get: function () { return 1; } }); }, TypeError);
+expect_error (function () { Object.defineProperty (small, 5, { value: 1 }); }, TypeError);
+Object.defineProperty (small, 0, { value: 100 });
+assert (small[0] === 100);
+assert (Object.prototype.toString.call (small) === "[object Int8Array]");
+assert (Object.prototype.toString.call (shared) === "[object ArrayBuffer]");
+
+(function ()
+{
+  "use strict";
+  expect_error (function () { small[10] = 1; }, TypeError);
+}) ();
+
+// set and subarray
+var target = new Int16Array (6);
+target.set ([1, 2, 3], 1);
+assert (target[0] === 0 && target[1] === 1 && target[3] === 3);
+target.set (new Int8Array ([-1, -2]), 4);
+assert (target[4] === -1 && target[5] === -2);
+expect_error (function () { target.set ([1, 2], 5); }, RangeError);
+
+var sub = target.subarray (1, -2);
+assert (sub.length === 3 && sub.byteOffset === 2 && sub[0] === 1);
+sub[0] = 50;
+assert (target[1] === 50);
+
+var overlap = new Uint8Array ([1, 2, 3, 4, 5, 6, 7, 8]);
+new Uint16Array (overlap.buffer, 0, 2).set (overlap.subarray (2, 4));
+assert (overlap[0] === 3 && overlap[1] === 0 && overlap[2] === 4 && overlap[3] === 0);
+
+var copy = new Float32Array (new Int8Array ([1, -1]));
+assert (copy.length === 2 && copy[1] === -1 && copy.buffer !== undefined);
+
+// DataView
+var view = new DataView (new ArrayBuffer (12), 2);
+assert (view.byteOffset === 2 && view.byteLength === 10);
+view.setUint16 (0, 0x1234);
+assert (view.getUint8 (0) === 0x12 && view.getUint8 (1) === 0x34);
+assert (view.getUint16 (0, true) === 0x3412);
+view.setInt32 (2, -2, true);
+assert (view.getInt32 (2, true) === -2 && view.getUint8 (2) === 0xfe && view.getUint32 (2) === 0xfeffffff);
+view.setFloat64 (0, Math.PI);
+assert (view.getFloat64 (0) === Math.PI);
+view.setFloat32 (6, 1.5, true);
+assert (view.getFloat32 (6, true) === 1.5);
+view.setInt8 (9, -1);
+assert (view.getInt8 (9) === -1 && view.getUint8 (9) === 255);
+expect_error (function () { view.getInt16 (9); }, RangeError);
+expect_error (function () { view.setFloat64 (3, 0); }, RangeError);
+expect_error (function () { DataView.prototype.getInt8.call (new Int8Array (1), 0); }, TypeError);
+expect_error (function () { new DataView ({}); }, TypeError);
+expect_error (function () { new DataView (new ArrayBuffer (4), 5); }, RangeError);
@@ -61,6 +61,11 @@ const char *test_source = (
                            );
 
 bool test_api_is_free_callback_was_called = false;
+uintptr_t test_api_freed_arraybuffer_data = 0;
+
+int test_api_gc_full_pauses_number = 0;
+bool test_api_is_gc_pause_started = false;
+size_t test_api_gc_swept_objects = 0;
 
 /**
  * Initialize Jerry API value with specified boolean value
@@ -165,6 +170,37 @@ handler_construct_freecb (uintptr_t native_p)
   test_api_is_free_callback_was_called = true;
 } /* handler_construct_freecb */
 
+static void
+handler_arraybuffer_freecb (uintptr_t native_p)
+{
+  JERRY_ASSERT (test_api_freed_arraybuffer_data == 0);
+
+  test_api_freed_arraybuffer_data = native_p;
+} /* handler_arraybuffer_freecb */
+
+static void
+handler_gc_event (const jerry_api_gc_event_t *event_p)
+{
+  /* Start and finish of a pause are reported in pairs */
+  JERRY_ASSERT (event_p->is_finished == test_api_is_gc_pause_started);
+  test_api_is_gc_pause_started = !event_p->is_finished;
+
+  if (!event_p->is_finished)
+  {
+    JERRY_ASSERT (event_p->marked_objects == 0
+                  && event_p->swept_objects == 0
+                  && event_p->freed_bytes == 0);
+    return;
+  }
+
+  if (event_p->kind == JERRY_API_GC_PAUSE_FULL)
+  {
+    test_api_gc_full_pauses_number++;
+  }
+
+  test_api_gc_swept_objects += event_p->swept_objects;
+} /* handler_gc_event */
+
 static bool
 handler_construct (const jerry_api_object_t *function_obj_p,
                    const jerry_api_value_t *this_p,
@@ -642,9 +678,63 @@ main (void)
 
   JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 10.5);
 
+  test_api_init_api_value_float64 (&v_in, 20.5);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "2", 1, &v_in, true);
+  JERRY_ASSERT (is_ok);
+  is_ok = jerry_api_add_object_field (array_obj_p, (jerry_api_char_t *) "5", 1, &v_in, true);
+  JERRY_ASSERT (!is_ok);
+  jerry_api_get_array_index_value (array_obj_p, 2, &v_out);
+
+  JERRY_ASSERT (v_out.type == JERRY_API_DATA_TYPE_FLOAT64 && v_out.u.v_float64 == 20.5);
+
   jerry_api_release_object (array_obj_p);
 
 
+  // Test: ArrayBuffer API
+  jerry_api_object_t *arraybuffer_obj_p = jerry_api_create_arraybuffer (16);
+  JERRY_ASSERT (arraybuffer_obj_p != NULL);
+
+  jerry_api_size_t arraybuffer_size;
+  uint8_t *arraybuffer_data_p = jerry_api_get_arraybuffer_pointer (arraybuffer_obj_p, &arraybuffer_size);
+  JERRY_ASSERT (arraybuffer_data_p != NULL && arraybuffer_size == 16);
+  JERRY_ASSERT (arraybuffer_data_p[0] == 0 && arraybuffer_data_p[15] == 0);
+  arraybuffer_data_p[3] = 42;
+
+  test_api_init_api_value_object (&v_in, arraybuffer_obj_p);
+  is_ok = jerry_api_set_object_field_value (global_obj_p, (jerry_api_char_t *) "arraybuffer", &v_in);
+  JERRY_ASSERT (is_ok);
+  jerry_api_release_value (&v_in);
+
+  const char *arraybuffer_code_src_p = "new Uint8Array (arraybuffer)[3] + new Uint8Array (arraybuffer).length";
+  jerry_completion_code_t arraybuffer_status = jerry_api_eval ((jerry_api_char_t *) arraybuffer_code_src_p,
+                                                               strlen (arraybuffer_code_src_p),
+                                                               false,
+                                                               false,
+                                                               &res);
+  JERRY_ASSERT (arraybuffer_status == JERRY_COMPLETION_CODE_OK);
+  JERRY_ASSERT (res.type == JERRY_API_DATA_TYPE_FLOAT64 && res.u.v_float64 == 58.0);
+  jerry_api_release_value (&res);
+
+  JERRY_ASSERT (jerry_api_get_arraybuffer_pointer (global_obj_p, &arraybuffer_size) == NULL);
+  jerry_api_release_object (arraybuffer_obj_p);
+
+  uint8_t external_data[4] = { 1, 2, 3, 4 };
+  arraybuffer_obj_p = jerry_api_create_external_arraybuffer (sizeof (external_data), external_data, NULL);
+  JERRY_ASSERT (jerry_api_get_arraybuffer_pointer (arraybuffer_obj_p, &arraybuffer_size) == external_data
+                && arraybuffer_size == sizeof (external_data));
+  jerry_api_release_object (arraybuffer_obj_p);
+
+  // The free callback receives the memory block, when the ArrayBuffer is freed
+  arraybuffer_obj_p = jerry_api_create_external_arraybuffer (sizeof (external_data),
+                                                             external_data,
+                                                             handler_arraybuffer_freecb);
+  JERRY_ASSERT (arraybuffer_obj_p != NULL);
+  jerry_api_release_object (arraybuffer_obj_p);
+  JERRY_ASSERT (test_api_freed_arraybuffer_data == 0);
+
+  jerry_api_gc ();
+  JERRY_ASSERT (test_api_freed_arraybuffer_data == (uintptr_t) external_data);
+
   // Test: eval
   const char *eval_code_src_p = "(function () { return 123; })";
   jerry_completion_code_t status = jerry_api_eval ((jerry_api_char_t *) eval_code_src_p,
@@ -671,8 +761,91 @@ main (void)
   jerry_api_release_object (global_obj_p);
 
   // TEST: run gc.
+  jerry_api_heap_stats_t heap_stats;
+  jerry_api_get_heap_stats (&heap_stats);
+  JERRY_ASSERT (heap_stats.allocated_bytes > 0
+                && heap_stats.allocated_bytes <= heap_stats.peak_allocated_bytes
+                && heap_stats.peak_allocated_bytes <= heap_stats.heap_size);
+  size_t swept_objects_before_gc = heap_stats.swept_objects;
+
+  jerry_api_set_gc_callback (handler_gc_event);
   jerry_api_gc ();
 
+  JERRY_ASSERT (test_api_gc_full_pauses_number == 1 && !test_api_is_gc_pause_started);
+
+  jerry_api_get_heap_stats (&heap_stats);
+  JERRY_ASSERT (heap_stats.full_gc_sessions > 0
+                && heap_stats.swept_objects == swept_objects_before_gc + test_api_gc_swept_objects);
+
+  // TEST: property cache statistics.
+  jerry_api_property_cache_stats_t cache_stats;
+  jerry_api_get_property_cache_stats (&cache_stats);
+  size_t get_hits_before = cache_stats.inline_cache_get_hits;
+  size_t put_hits_before = cache_stats.inline_cache_put_hits;
+  size_t lcache_hits_before = cache_stats.lcache_hits;
+
+  const char *ic_code_src_p = ("var point = { x: 1, y: 2 }; var sum = 0;"
+                               "for (var i = 0; i < 10; i++) { point.x = i; sum += point.x + point.y; }");
+  status = jerry_api_eval ((jerry_api_char_t *) ic_code_src_p,
+                           strlen (ic_code_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  jerry_api_get_property_cache_stats (&cache_stats);
+  JERRY_ASSERT (cache_stats.inline_cache_get_hits >= get_hits_before + 18
+                && cache_stats.inline_cache_put_hits >= put_hits_before + 9
+                && cache_stats.inline_cache_get_misses > 0
+                && cache_stats.inline_cache_put_misses > 0);
+
+  /* The global variables are looked up through the property lookup cache */
+  JERRY_ASSERT (cache_stats.lcache_hits >= lcache_hits_before + 10
+                && cache_stats.lcache_misses > 0);
+
+  size_t chain_hits_before = cache_stats.prototype_chain_cache_hits;
+
+  const char *chain_code_src_p = ("var strings = [];"
+                                  "for (var i = 0; i < 10; i++) { strings.push (point.toString ()); }");
+  status = jerry_api_eval ((jerry_api_char_t *) chain_code_src_p,
+                           strlen (chain_code_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  /* The methods are found on the prototypes through the prototype chain cache */
+  jerry_api_get_property_cache_stats (&cache_stats);
+  JERRY_ASSERT (cache_stats.prototype_chain_cache_hits >= chain_hits_before + 15
+                && cache_stats.prototype_chain_cache_misses > 0);
+
+  // TEST: set gc policy.
+  jerry_api_gc_policy_t gc_policy;
+  jerry_api_get_gc_policy (&gc_policy);
+
+  gc_policy.min_allocated_bytes = 0;
+  gc_policy.heap_growth_percent = 0;
+  jerry_api_set_gc_policy (&gc_policy);
+
+  jerry_api_gc_policy_t new_gc_policy;
+  jerry_api_get_gc_policy (&new_gc_policy);
+  JERRY_ASSERT (new_gc_policy.min_allocated_bytes == 0
+                && new_gc_policy.heap_growth_percent == 0);
+
+  const char *gc_code_src_p = "var chain = {}; for (var i = 0; i < 1000; i++) { chain = { next: chain }; }";
+  status = jerry_api_eval ((jerry_api_char_t *) gc_code_src_p,
+                           strlen (gc_code_src_p),
+                           false,
+                           false,
+                           &res);
+  JERRY_ASSERT (status == JERRY_COMPLETION_CODE_OK);
+  jerry_api_release_value (&res);
+
+  JERRY_ASSERT (test_api_gc_full_pauses_number > 1 && !test_api_is_gc_pause_started);
+  jerry_api_set_gc_callback (NULL);
+
   jerry_cleanup ();
 
   JERRY_ASSERT (test_api_is_free_callback_was_called);
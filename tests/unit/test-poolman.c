@@ -32,7 +32,8 @@ const uint32_t test_iters = 1024;
 #define TEST_MAX_SUB_ITERS  1024
 
 uint8_t *ptrs[TEST_MAX_SUB_ITERS];
-uint8_t data[TEST_MAX_SUB_ITERS][MEM_POOL_CHUNK_SIZE];
+size_t sizes[TEST_MAX_SUB_ITERS];
+uint8_t data[TEST_MAX_SUB_ITERS][MEM_POOLS_MAX_CHUNK_SIZE];
 
 int
 main (int __attr_unused___ argc,
@@ -48,16 +49,17 @@ main (int __attr_unused___ argc,
 
     for (size_t j = 0; j < subiters; j++)
     {
-      ptrs[j] = (uint8_t *) mem_pools_alloc ();
+      sizes[j] = ((size_t) rand () % MEM_POOLS_MAX_CHUNK_SIZE) + 1;
+      ptrs[j] = (uint8_t *) mem_pools_alloc (sizes[j]);
 
       if (ptrs[j] != NULL)
       {
-        for (size_t k = 0; k < MEM_POOL_CHUNK_SIZE; k++)
+        for (size_t k = 0; k < sizes[j]; k++)
         {
           ptrs[j][k] = (uint8_t) (rand () % 256);
         }
 
-        memcpy (data[j], ptrs[j], MEM_POOL_CHUNK_SIZE);
+        memcpy (data[j], ptrs[j], sizes[j]);
       }
     }
 
@@ -72,9 +74,9 @@ main (int __attr_unused___ argc,
 
       if (ptrs[j] != NULL)
       {
-        JERRY_ASSERT (!memcmp (data[j], ptrs[j], MEM_POOL_CHUNK_SIZE));
+        JERRY_ASSERT (!memcmp (data[j], ptrs[j], sizes[j]));
 
-        mem_pools_free (ptrs[j]);
+        mem_pools_free (ptrs[j], sizes[j]);
       }
     }
   }